@@ -62,11 +62,11 @@ AtomicString::StringKind GetStringKind(const SharedNativeString* native_string)
     return AtomicString::StringKind::kIsMixed;
   }
 
-  AtomicString::StringKind predictKind = std::islower(native_string->string()[0])
+  AtomicString::StringKind predictKind = std::islower(native_string->CharAt(0))
                                              ? AtomicString::StringKind::kIsLowerCase
                                              : AtomicString::StringKind::kIsUpperCase;
   for (int i = 0; i < native_string->length(); i++) {
-    uint16_t c = native_string->string()[i];
+    uint16_t c = native_string->CharAt(i);
     if (predictKind == AtomicString::StringKind::kIsUpperCase && !std::isupper(c)) {
       return AtomicString::StringKind::kIsMixed;
     } else if (predictKind == AtomicString::StringKind::kIsLowerCase && !std::islower(c)) {
@@ -100,14 +100,16 @@ AtomicString::AtomicString(JSContext* ctx, const uint16_t* str, size_t length) :
 }
 
 AtomicString::AtomicString(JSContext* ctx, const std::unique_ptr<AutoFreeNativeString>& native_string)
-    : runtime_(JS_GetRuntime(ctx)),
-      atom_(JS_NewUnicodeAtom(ctx, native_string->string(), native_string->length())),
-      kind_(GetStringKind(native_string.get())),
-      length_(native_string->length()){};
+    : runtime_(JS_GetRuntime(ctx)), kind_(GetStringKind(native_string.get())), length_(native_string->length()) {
+  JSValue string = nativeStringToJSValue(ctx, native_string.get());
+  atom_ = JS_ValueToAtom(ctx, string);
+  JS_FreeValue(ctx, string);
+}
 
 AtomicString::AtomicString(JSContext* ctx, JSValue value)
     : runtime_(JS_GetRuntime(ctx)), atom_(JS_ValueToAtom(ctx, value)) {
-  if (JS_IsString(value)) {
+  // Rope strings are not flat, their kind is read back from the atom.
+  if (JS_VALUE_GET_TAG(value) == JS_TAG_STRING) {
     kind_ = GetStringKind(value);
     length_ = JS_VALUE_GET_STRING(value)->len;
   } else {
@@ -182,10 +184,9 @@ std::unique_ptr<SharedNativeString> AtomicString::ToNativeString(JSContext* ctx)
     return built_in_string::kempty_string.ToNativeString(ctx);
   }
   JSValue stringValue = JS_AtomToValue(ctx, atom_);
-  uint32_t length;
-  uint16_t* bytes = JS_ToUnicode(ctx, stringValue, &length);
+  std::unique_ptr<SharedNativeString> result = JS_ToNativeString(ctx, stringValue);
   JS_FreeValue(ctx, stringValue);
-  return std::make_unique<SharedNativeString>(bytes, length);
+  return result;
 }
 
 StringView AtomicString::ToStringView() const {
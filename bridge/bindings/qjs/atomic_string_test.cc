@@ -78,16 +78,37 @@ TEST(AtomicString, ToNativeString) {
   TestAtomicString([](JSContext* ctx) {
     AtomicString&& value = AtomicString(ctx, "helloworld");
     auto native_string = value.ToNativeString(ctx);
-    const uint16_t* p = native_string->string();
+    const uint8_t* p = native_string->string8();
     EXPECT_EQ(native_string->length(), 10);
+    EXPECT_EQ(native_string->is_one_byte(), true);
 
-    uint16_t result[10] = {'h', 'e', 'l', 'l', 'o', 'w', 'o', 'r', 'l', 'd'};
+    uint8_t result[10] = {'h', 'e', 'l', 'l', 'o', 'w', 'o', 'r', 'l', 'd'};
     for (int i = 0; i < native_string->length(); i++) {
       EXPECT_EQ(result[i], p[i]);
     }
   });
 }
 
+TEST(AtomicString, ToNativeStringWide) {
+  TestAtomicString([](JSContext* ctx) {
+    const uint16_t chars[] = {0x4f60, 0x597d};
+    AtomicString&& value = AtomicString(ctx, chars, 2);
+    auto native_string = value.ToNativeString(ctx);
+    EXPECT_EQ(native_string->is_one_byte(), false);
+    EXPECT_EQ(native_string->length(), 2);
+    EXPECT_EQ(native_string->string()[0], 0x4f60);
+    EXPECT_EQ(native_string->string()[1], 0x597d);
+
+    // A one byte native string reads back as the same atom.
+    AtomicString latin1 = AtomicString(ctx, "caf\xc3\xa9");
+    std::unique_ptr<AutoFreeNativeString> copy{
+        static_cast<AutoFreeNativeString*>(latin1.ToNativeString(ctx).release())};
+    EXPECT_EQ(copy->is_one_byte(), true);
+    EXPECT_EQ(copy->CharAt(3), 0xe9);
+    EXPECT_EQ(AtomicString(ctx, copy) == latin1, true);
+  });
+}
+
 TEST(AtomicString, CopyAssignment) {
   TestAtomicString([](JSContext* ctx) {
     AtomicString str = AtomicString(ctx, "helloworld");
@@ -89,11 +89,15 @@
 #include "qjs_svg_text_element.h"
 #include "qjs_svg_text_positioning_element.h"
 #include "qjs_text.h"
+#include "qjs_text_decoder.h"
+#include "qjs_text_encoder.h"
 #include "qjs_touch.h"
 #include "qjs_touch_event.h"
 #include "qjs_touch_list.h"
 #include "qjs_transition_event.h"
 #include "qjs_ui_event.h"
+#include "qjs_url.h"
+#include "qjs_url_search_params.h"
 #include "qjs_widget_element.h"
 #include "qjs_window.h"
 #include "qjs_window_or_worker_global_scope.h"
@@ -179,6 +183,10 @@ void InstallBindings(ExecutingContext* context) {
   QJSPerformanceMeasure::Install(context);
   QJSHTMLCollection::Install(context);
   QJSHTMLAllCollection::Install(context);
+  QJSURLSearchParams::Install(context);
+  QJSURL::Install(context);
+  QJSTextEncoder::Install(context);
+  QJSTextDecoder::Install(context);
 
   // SVG
   QJSSVGElement::Install(context);
@@ -36,7 +36,8 @@ class Member {
     raw_ = other.raw_;
     runtime_ = other.runtime_;
     js_object_ptr_ = other.js_object_ptr_;
-    ((JSRefCountHeader*)other.js_object_ptr_)->ref_count++;
+    if (js_object_ptr_ != nullptr)
+      ((JSRefCountHeader*)js_object_ptr_)->ref_count++;
   }
   ~Member() {
     if (raw_ != nullptr) {
@@ -66,10 +67,14 @@ class Member {
 
   // Copy assignment.
   Member& operator=(const Member& other) {
+    if (other.raw_ == raw_)
+      return *this;
+    Clear();
     raw_ = other.raw_;
     runtime_ = other.runtime_;
     js_object_ptr_ = other.js_object_ptr_;
-    ((JSRefCountHeader*)other.js_object_ptr_)->ref_count++;
+    if (js_object_ptr_ != nullptr)
+      ((JSRefCountHeader*)js_object_ptr_)->ref_count++;
     return *this;
   }
   // Move assignment.
@@ -80,6 +85,9 @@ class Member {
   }
 
   Member& operator=(T* other) {
+    // Reassigning the same object would only drop and take back the same reference.
+    if (other == raw_)
+      return *this;
     Clear();
     SetRaw(other);
     return *this;
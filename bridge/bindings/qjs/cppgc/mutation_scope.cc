@@ -4,13 +4,14 @@
  */
 
 #include "mutation_scope.h"
+#include <vector>
 #include "bindings/qjs/script_wrappable.h"
 #include "core/executing_context.h"
 
 namespace webf {
 
 MemberMutationScope::MemberMutationScope(ExecutingContext* context)
-    : context_(context), runtime_(context->GetScriptState()->runtime()) {
+    : context_(context), runtime_(context->GetScriptState()->runtime()), log_start_(context->MemberFreeLog().size()) {
   context->SetMutationScope(*this);
 }
 
@@ -29,18 +30,18 @@ MemberMutationScope* MemberMutationScope::Parent() const {
 }
 
 void MemberMutationScope::RecordFree(ScriptWrappable* wrappable) {
-  if (mutation_records_.count(wrappable) == 0) {
-    mutation_records_.insert(std::make_pair(wrappable, 0));
-  }
-  mutation_records_[wrappable]--;
+  // Even when other references exist now, they may be released before the scope ends, e.g. by a ScriptValue or a
+  // JS_FreeValue() inside the mutation, so the free is always deferred.
+  context_->MemberFreeLog().emplace_back(JS_VALUE_GET_PTR(wrappable->ToQuickJSUnsafe()));
 }
 
 void MemberMutationScope::ApplyRecord() {
-  for (auto& entry : mutation_records_) {
-    for (int i = 0; i < -entry.second; i++) {
-      JS_FreeValueRT(runtime_, entry.first->ToQuickJSUnsafe());
-    }
+  std::vector<void*>& log = context_->MemberFreeLog();
+  // Finalizers run by these frees may record more entries, they are appended and applied by the same loop.
+  for (size_t i = log_start_; i < log.size(); i++) {
+    JS_FreeValueRT(runtime_, JS_MKPTR(JS_TAG_OBJECT, log[i]));
   }
+  log.resize(log_start_);
 }
 
 }  // namespace webf
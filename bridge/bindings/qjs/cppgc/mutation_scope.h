@@ -7,7 +7,7 @@
 #define BRIDGE_BINDINGS_QJS_CPPGC_MUTATION_SCOPE_H_
 
 #include <quickjs/quickjs.h>
-#include <unordered_map>
+#include <cstddef>
 #include "foundation/macros.h"
 
 namespace webf {
@@ -17,6 +17,10 @@ class ScriptWrappable;
 
 /**
  * A stack-allocated class that record all members mutations in stack scope.
+ *
+ * The frees of members are deferred to the end of the scope, so that no object is finalized in the middle of a tree
+ * mutation. They are appended to a log owned by the context and shared by the nested scopes, each scope applies and
+ * truncates the entries it appended. The log keeps its capacity between scopes, so recording does not allocate once it has grown.
  */
 class MemberMutationScope {
   WEBF_DISALLOW_NEW();
@@ -37,7 +41,8 @@ class MemberMutationScope {
   MemberMutationScope* parent_scope_{nullptr};
   ExecutingContext* context_;
   JSRuntime* runtime_{nullptr};
-  std::unordered_map<ScriptWrappable*, int> mutation_records_;
+  // The entries before this offset belong to the enclosing scopes.
+  size_t log_start_;
 };
 
 }  // namespace webf
@@ -4,6 +4,7 @@
  */
 
 #include "native_string_utils.h"
+#include <quickjs/cutils.h>
 #include "bindings/qjs/qjs_engine_patch.h"
 
 namespace webf {
@@ -18,9 +19,7 @@ std::unique_ptr<SharedNativeString> jsValueToNativeString(JSContext* ctx, JSValu
     isValueString = false;
   }
 
-  uint32_t length;
-  uint16_t* buffer = JS_ToUnicode(ctx, value, &length);
-  std::unique_ptr<SharedNativeString> ptr = std::make_unique<SharedNativeString>(buffer, length);
+  std::unique_ptr<SharedNativeString> ptr = JS_ToNativeString(ctx, value);
 
   if (!isValueString) {
     JS_FreeValue(ctx, value);
@@ -29,16 +28,57 @@ std::unique_ptr<SharedNativeString> jsValueToNativeString(JSContext* ctx, JSValu
 }
 
 std::unique_ptr<SharedNativeString> stringToNativeString(const std::string& string) {
-  std::u16string utf16;
-  fromUTF8(string, utf16);
-  SharedNativeString tmp{reinterpret_cast<const uint16_t*>(utf16.c_str()), static_cast<uint32_t>(utf16.size())};
-  return SharedNativeString::FromTemporaryString(tmp.string(), tmp.length());
+  auto* src = reinterpret_cast<const uint8_t*>(string.data());
+  size_t length;
+  int kind = utf8_scan(src, string.size(), &length, UTF8_STRICT);
+  if (kind == UTF8_PLAIN_ASCII) {
+    return SharedNativeString::FromTemporaryOneByteString(src, length);
+  }
+  // The FromTemporary*() helpers copy the result into a buffer allocated the way Dart frees it.
+  if (!(kind & UTF8_HAS_16BIT)) {
+    std::unique_ptr<uint8_t[]> buffer(new uint8_t[length]);
+    utf8_decode_buf8(buffer.get(), src, string.size());
+    return SharedNativeString::FromTemporaryOneByteString(buffer.get(), length);
+  }
+  std::unique_ptr<uint16_t[]> buffer(new uint16_t[length]);
+  utf8_decode_buf16(buffer.get(), src, string.size(), UTF8_STRICT);
+  return SharedNativeString::FromTemporaryString(buffer.get(), length);
 }
 
 std::string nativeStringToStdString(const SharedNativeString* native_string) {
-  std::u16string u16EventType =
-      std::u16string(reinterpret_cast<const char16_t*>(native_string->string()), native_string->length());
-  return toUTF8(u16EventType);
+  std::string result;
+  if (native_string->is_one_byte()) {
+    result.resize(utf8_encode_len8(native_string->string8(), native_string->length()));
+    utf8_encode_buf8(reinterpret_cast<uint8_t*>(result.data()), native_string->string8(), native_string->length());
+    return result;
+  }
+  result.resize(utf8_encode_len16(native_string->string(), native_string->length()));
+  utf8_encode_buf16(reinterpret_cast<uint8_t*>(result.data()), native_string->string(), native_string->length(),
+                    UTF8_STRICT);
+  return result;
+}
+
+JSValue nativeStringToJSValue(JSContext* ctx, const SharedNativeString* native_string) {
+  if (native_string->is_one_byte()) {
+    return JS_NewRawUTF8String(ctx, native_string->string8(), native_string->length());
+  }
+  return JS_NewUnicodeString(ctx, native_string->string(), native_string->length());
+}
+
+std::string toUTF8(const std::u16string& source) {
+  auto* src = reinterpret_cast<const uint16_t*>(source.data());
+  std::string result;
+  result.resize(utf8_encode_len16(src, source.size()));
+  utf8_encode_buf16(reinterpret_cast<uint8_t*>(result.data()), src, source.size(), UTF8_STRICT);
+  return result;
+}
+
+void fromUTF8(const std::string& source, std::u16string& result) {
+  auto* src = reinterpret_cast<const uint8_t*>(source.data());
+  size_t length;
+  utf8_scan(src, source.size(), &length, UTF8_STRICT);
+  result.resize(length);
+  utf8_decode_buf16(reinterpret_cast<uint16_t*>(result.data()), src, source.size(), UTF8_STRICT);
 }
 
 std::unique_ptr<SharedNativeString> atomToNativeString(JSContext* ctx, JSAtom atom) {
@@ -7,8 +7,6 @@
 #define BRIDGE_NATIVE_STRING_UTILS_H
 
 #include <quickjs/quickjs.h>
-#include <codecvt>
-#include <locale>
 #include <memory>
 #include <string>
 
@@ -24,21 +22,12 @@ std::unique_ptr<SharedNativeString> stringToNativeString(const std::string& stri
 
 std::string nativeStringToStdString(const SharedNativeString* native_string);
 
-template <typename T>
-std::string toUTF8(const std::basic_string<T, std::char_traits<T>, std::allocator<T>>& source) {
-  std::string result;
+// Create a JS string from a NativeString of either width.
+JSValue nativeStringToJSValue(JSContext* ctx, const SharedNativeString* native_string);
 
-  std::wstring_convert<std::codecvt_utf8_utf16<T>, T> convertor;
-  result = convertor.to_bytes(source);
-
-  return result;
-}
-
-template <typename T>
-void fromUTF8(const std::string& source, std::basic_string<T, std::char_traits<T>, std::allocator<T>>& result) {
-  std::wstring_convert<std::codecvt_utf8_utf16<T>, T> convertor;
-  result = convertor.from_bytes(source);
-}
+// Transcode between UTF-16 and UTF-8. Ill-formed input is replaced with U+FFFD.
+std::string toUTF8(const std::u16string& source);
+void fromUTF8(const std::string& source, std::u16string& result);
 
 }  // namespace webf
 
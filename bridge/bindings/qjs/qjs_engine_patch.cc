@@ -6,7 +6,9 @@
 #include "qjs_engine_patch.h"
 #include <quickjs/cutils.h>
 #include <quickjs/list.h>
+#include <algorithm>
 #include <cstring>
+#include <vector>
 
 #if WIN32
 #include <Windows.h>
@@ -253,29 +255,14 @@ uint16_t* JS_ToUnicode(JSContext* ctx, JSValueConst value, uint32_t* length) {
   JSString* string = JS_VALUE_GET_STRING(value);
 
   if (!string->is_wide_char) {
-    uint8_t* p = string->u.str8;
+    *length = string->len;
 #if WIN32
-    int utf16_str_len = MultiByteToWideChar(CP_ACP, 0, reinterpret_cast<const char*>(p), -1, NULL, 0) - 1;
-    if (utf16_str_len == -1) {
-      return nullptr;
-    }
-    // Allocate memory for the UTF-16 string, including the null terminator
-    buffer = (uint16_t*)CoTaskMemAlloc((utf16_str_len + 1) * sizeof(WCHAR));
-    if (buffer == nullptr) {
-      return nullptr;
-    }
-
-    // Convert the ASCII string to UTF-16
-    MultiByteToWideChar(CP_ACP, 0, reinterpret_cast<const char*>(p), -1, (WCHAR*)buffer, utf16_str_len + 1);
-    *length = utf16_str_len;
+    buffer = (uint16_t*)CoTaskMemAlloc(sizeof(uint16_t) * string->len);
 #else
-    uint32_t len = *length = string->len;
-    buffer = (uint16_t*)malloc(sizeof(uint16_t) * len * 2);
-    for (size_t i = 0; i < len; i++) {
-      buffer[i] = p[i];
-      buffer[i + 1] = 0x00;
-    }
+    buffer = (uint16_t*)malloc(sizeof(uint16_t) * string->len);
 #endif
+    // 8-bit strings hold Latin-1 code points, which map 1:1 to UTF-16 code units.
+    latin1_to_utf16(buffer, string->u.str8, string->len);
   } else {
     *length = string->len;
 #if WIN32
@@ -319,10 +306,17 @@ static JSString* js_alloc_string(JSRuntime* runtime, JSContext* ctx, int max_len
 
 JSValue JS_NewUnicodeString(JSContext* ctx, const uint16_t* code, uint32_t length) {
   JSString* str;
-  str = js_alloc_string(JS_GetRuntime(ctx), ctx, length, 1);
+  // Most strings coming from Dart fit in Latin-1, store them as 8-bit strings like QuickJS does for its own.
+  bool is_wide_char = utf16_latin1_len(code, length) != length;
+  str = js_alloc_string(JS_GetRuntime(ctx), ctx, length, is_wide_char);
   if (!str)
     return JS_EXCEPTION;
-  memcpy(str->u.str16, code, length * 2);
+  if (is_wide_char) {
+    memcpy(str->u.str16, code, length * 2);
+  } else {
+    utf16_to_latin1(str->u.str8, code, length);
+    str->u.str8[length] = '\0';
+  }
   return JS_MKPTR(JS_TAG_STRING, str);
 }
 
@@ -450,4 +444,144 @@ JSGCPhaseEnum JS_GetEnginePhase(JSRuntime* runtime) {
 webf::StringView JSAtomToStringView(JSRuntime* runtime, JSAtom atom) {
   JSString* string = runtime->atom_array[atom];
   return webf::StringView(string->u.str8, string->len, string->is_wide_char);
-}
\ No newline at end of file
+}
+
+std::unique_ptr<webf::SharedNativeString> JS_ToNativeString(JSContext* ctx, JSValueConst value) {
+  if (JS_VALUE_GET_TAG(value) != JS_TAG_STRING) {
+    value = JS_ToPropertyKey(ctx, value);
+    if (JS_IsException(value))
+      return nullptr;
+  } else {
+    value = JS_DupValue(ctx, value);
+  }
+
+  JSString* string = JS_VALUE_GET_STRING(value);
+  std::unique_ptr<webf::SharedNativeString> result =
+      string->is_wide_char ? webf::SharedNativeString::FromTemporaryString(string->u.str16, string->len)
+                           : webf::SharedNativeString::FromTemporaryOneByteString(string->u.str8, string->len);
+  JS_FreeValue(ctx, value);
+  return result;
+}
+
+JSValue JS_NewStringFromUTF8(JSContext* ctx, const uint8_t* buf, size_t length, bool fatal) {
+  if (length == 0)
+    return JS_AtomToString(ctx, JS_ATOM_empty_string);
+
+  size_t length16;
+  int kind = utf8_scan(buf, length, &length16, UTF8_STRICT);
+  if ((kind & UTF8_HAS_ERRORS) && fatal)
+    return JS_NULL;
+  // JS_STRING_LEN_MAX
+  if (length16 > (1 << 30) - 1)
+    return JS_ThrowRangeError(ctx, "invalid string length");
+
+  bool is_wide_char = kind & UTF8_HAS_16BIT;
+  JSString* str = js_alloc_string(JS_GetRuntime(ctx), ctx, length16, is_wide_char);
+  if (!str)
+    return JS_EXCEPTION;
+  if (is_wide_char) {
+    utf8_decode_buf16(str->u.str16, buf, length, UTF8_STRICT);
+  } else {
+    if (kind == UTF8_PLAIN_ASCII) {
+      memcpy(str->u.str8, buf, length);
+    } else {
+      utf8_decode_buf8(str->u.str8, buf, length);
+    }
+    str->u.str8[length16] = '\0';
+  }
+  return JS_MKPTR(JS_TAG_STRING, str);
+}
+
+size_t JS_StringUTF8Length(JSValueConst value) {
+  JSString* string = JS_VALUE_GET_STRING(value);
+  if (string->is_wide_char)
+    return utf8_encode_len16(string->u.str16, string->len);
+  return utf8_encode_len8(string->u.str8, string->len);
+}
+
+size_t JS_EncodeStringUTF8(JSValueConst value, uint8_t* buf, size_t capacity, size_t* read) {
+  JSString* string = JS_VALUE_GET_STRING(value);
+  if (string->is_wide_char)
+    return utf8_encode_buf16_partial(buf, capacity, string->u.str16, string->len, read, UTF8_STRICT);
+  return utf8_encode_buf8_partial(buf, capacity, string->u.str8, string->len, read);
+}
+
+JSValue JS_NewLatin1String(JSContext* ctx, size_t length, uint8_t** data) {
+  // JS_STRING_LEN_MAX
+  if (length > (1 << 30) - 1)
+    return JS_ThrowRangeError(ctx, "invalid string length");
+  JSString* str = js_alloc_string(JS_GetRuntime(ctx), ctx, length, 0);
+  if (!str)
+    return JS_EXCEPTION;
+  str->u.str8[length] = '\0';
+  *data = str->u.str8;
+  return JS_MKPTR(JS_TAG_STRING, str);
+}
+
+JSValue JS_Base64EncodeString(JSContext* ctx, JSValueConst value) {
+  JSString* string = JS_VALUE_GET_STRING(value);
+  size_t length = string->len;
+  if (string->is_wide_char && utf16_latin1_len(string->u.str16, length) != length)
+    return JS_NULL;
+
+  uint8_t* data;
+  JSValue result = JS_NewLatin1String(ctx, b64_encode_len(length), &data);
+  if (JS_IsException(result))
+    return result;
+  if (!string->is_wide_char) {
+    b64_encode(data, string->u.str8, length);
+    return result;
+  }
+  // The 16-bit strings are narrowed in chunks, a multiple of 3 bytes long to only pad the last one.
+  uint8_t chunk[3 * 1024];
+  for (size_t i = 0; i < length; i += sizeof(chunk)) {
+    size_t chunk_length = std::min(length - i, sizeof(chunk));
+    utf16_to_latin1(chunk, string->u.str16 + i, chunk_length);
+    data += b64_encode(data, chunk, chunk_length);
+  }
+  return result;
+}
+
+JSValue JS_Base64DecodeString(JSContext* ctx, JSValueConst value, bool to_bytes) {
+  JSString* string = JS_VALUE_GET_STRING(value);
+  size_t length = string->len;
+  const uint8_t* source = string->u.str8;
+  std::vector<uint8_t> narrowed;
+  if (string->is_wide_char) {
+    // The alphabet is ASCII, only 16-bit strings which fit in Latin-1 may be correctly encoded.
+    if (utf16_latin1_len(string->u.str16, length) != length)
+      return JS_NULL;
+    narrowed.resize(length);
+    utf16_to_latin1(narrowed.data(), string->u.str16, length);
+    source = narrowed.data();
+  }
+
+  // The output is decoded in place into an allocation sized for the input, the bytes of whitespace and padding are
+  // left unused at its end.
+  size_t capacity = b64_decode_len(length);
+  if (to_bytes) {
+    auto* data = static_cast<uint8_t*>(js_malloc(ctx, std::max<size_t>(capacity, 1)));
+    if (!data)
+      return JS_EXCEPTION;
+    size_t decoded_length = b64_decode(data, source, length);
+    if (decoded_length == B64_ERROR) {
+      js_free(ctx, data);
+      return JS_NULL;
+    }
+    return JS_NewUint8ArrayFromData(ctx, data, decoded_length);
+  }
+
+  uint8_t* data;
+  JSValue result = JS_NewLatin1String(ctx, capacity, &data);
+  if (JS_IsException(result))
+    return result;
+  size_t decoded_length = b64_decode(data, source, length);
+  if (decoded_length == B64_ERROR) {
+    JS_FreeValue(ctx, result);
+    return JS_NULL;
+  }
+  JSString* decoded = JS_VALUE_GET_STRING(result);
+  decoded->len = decoded_length;
+  decoded->u.str8[decoded_length] = '\0';
+  return result;
+}
@@ -149,5 +149,23 @@ static inline uint32_t JS_AtomToUInt32(JSAtom atom) {
 #endif
 
 webf::StringView JSAtomToStringView(JSRuntime* runtime, JSAtom atom);
+// Copy a string to a SharedNativeString, 8-bit strings are copied as one byte strings without widening.
+std::unique_ptr<webf::SharedNativeString> JS_ToNativeString(JSContext* ctx, JSValueConst value);
+// Decode UTF-8 as specified by the Encoding standard, ill-formed sequences and encoded surrogates are decoded as
+// U+FFFD. When |fatal| is set, an ill-formed input returns JS_NULL without throwing instead.
+JSValue JS_NewStringFromUTF8(JSContext* ctx, const uint8_t* buf, size_t length, bool fatal);
+// The UTF-8 length of the flat string |value|, as returned by JS_ToString, with lone surrogates encoded as U+FFFD.
+size_t JS_StringUTF8Length(JSValueConst value);
+// Encode the flat string |value| as UTF-8 into buf[0..capacity), stopping before the first code point which does
+// not fit. Returns the number of bytes written and stores the number of UTF-16 code units consumed in |read|.
+size_t JS_EncodeStringUTF8(JSValueConst value, uint8_t* buf, size_t capacity, size_t* read);
+// Create an 8-bit string of |length| characters, its contents are left uninitialized and must be filled by the
+// caller through |data|.
+JSValue JS_NewLatin1String(JSContext* ctx, size_t length, uint8_t** data);
+// Base64 encode the flat string |value| as btoa() does. Returns JS_NULL when it has characters above U+00FF.
+JSValue JS_Base64EncodeString(JSContext* ctx, JSValueConst value);
+// Forgiving-base64 decode the flat string |value| to a binary string as atob() does, or to a Uint8Array when
+// |to_bytes| is set. Returns JS_NULL when it is not correctly encoded.
+JSValue JS_Base64DecodeString(JSContext* ctx, JSValueConst value, bool to_bytes);
 
 #endif  // BRIDGE_QJS_PATCH_H
\ No newline at end of file
@@ -5,7 +5,9 @@
 
 #include "qjs_engine_patch.h"
 #include <codecvt>
+#include <cstdio>
 #include "gtest/gtest.h"
+#include "native_string_utils.h"
 
 TEST(JS_ToUnicode, asciiWords) {
   JSRuntime* runtime = JS_NewRuntime();
@@ -100,3 +102,424 @@ TEST(JS_NewUnicodeString, fromChieseCode) {
   JS_FreeContext(ctx);
   JS_FreeRuntime(runtime);
 }
+
+TEST(JS_ToUnicode, latin1Words) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  JSValue value = JS_NewString(ctx, "caf\xc3\xa9 na\xc3\xafve \xc2\xa0x");
+  uint32_t bufferLength;
+  uint16_t* buffer = JS_ToUnicode(ctx, value, &bufferLength);
+  std::u16string bufferString = std::u16string(reinterpret_cast<char16_t*>(buffer), bufferLength);
+
+  EXPECT_EQ(bufferString == u"caf\u00e9 na\u00efve \u00a0x", true);
+
+  JS_FreeValue(ctx, value);
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+  free(buffer);
+}
+
+TEST(JS_NewUnicodeString, fromLatin1) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  std::u16string source = u"r\u00e9sum\u00e9 of a very long line of text";
+  JSValue result = JS_NewUnicodeString(ctx, reinterpret_cast<const uint16_t*>(source.c_str()), source.length());
+  const char* str = JS_ToCString(ctx, result);
+  EXPECT_STREQ(str, "r\xc3\xa9sum\xc3\xa9 of a very long line of text");
+
+  uint32_t length;
+  uint16_t* buffer = JS_ToUnicode(ctx, result, &length);
+  EXPECT_EQ(std::u16string(reinterpret_cast<char16_t*>(buffer), length) == source, true);
+
+  free(buffer);
+  JS_FreeCString(ctx, str);
+  JS_FreeValue(ctx, result);
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+TEST(NativeStringUtils, transcoding) {
+  std::u16string utf16;
+  webf::fromUTF8("Hello, \xe4\xb8\x96\xe7\x95\x8c \xf0\x9f\x98\x80!", utf16);
+  EXPECT_EQ(utf16 == u"Hello, \u4e16\u754c \U0001F600!", true);
+  EXPECT_EQ(webf::toUTF8(utf16), "Hello, \xe4\xb8\x96\xe7\x95\x8c \xf0\x9f\x98\x80!");
+
+  // Ill-formed input is replaced with U+FFFD instead of throwing.
+  webf::fromUTF8("a\xe4\xb8" "b\xff" "c", utf16);
+  EXPECT_EQ(utf16 == u"a\ufffdb\ufffdc", true);
+  EXPECT_EQ(webf::toUTF8(std::u16string(u"x") + char16_t(0xd800) + u"y"), "x\xef\xbf\xbdy");
+
+  // Latin-1 text is decoded to a one byte native string.
+  auto native_string = webf::stringToNativeString("caf\xc3\xa9");
+  EXPECT_EQ(native_string->is_one_byte(), true);
+  EXPECT_EQ(native_string->length(), 4);
+  EXPECT_EQ(native_string->string8()[3], 0xe9);
+  EXPECT_EQ(webf::nativeStringToStdString(native_string.get()), "caf\xc3\xa9");
+  native_string = webf::stringToNativeString("\xe4\xb8\x96");
+  EXPECT_EQ(native_string->is_one_byte(), false);
+  EXPECT_EQ(native_string->string()[0], 0x4e16);
+}
+
+TEST(JS_RegExpCache, sharedByContexts) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  JSContext* ctx2 = JS_NewContext(runtime);
+  std::string code = "var n = 0; for (var i = 0; i < 100; i++) { if (new RegExp('row-' + (i % 4)).test('row-2')) n++; } n;";
+
+  JSValue result = JS_Eval(ctx, code.c_str(), code.size(), "vm://", JS_EVAL_TYPE_GLOBAL);
+  int32_t count;
+  JS_ToInt32(ctx, &count, result);
+  EXPECT_EQ(count, 25);
+  JS_FreeValue(ctx, result);
+
+  JSRegExpCacheStats stats;
+  JS_GetRegExpCacheStats(runtime, &stats);
+  EXPECT_EQ(stats.count, 4);
+  EXPECT_EQ(stats.miss_count, 4);
+  EXPECT_EQ(stats.hit_count, 96);
+
+  // Same source with other flags is another entry, the same source and flags hit from any context.
+  JS_FreeValue(ctx2, JS_Eval(ctx2, "new RegExp('row-1', 'g'); /row-1/;", 34, "vm://", JS_EVAL_TYPE_GLOBAL));
+  JS_GetRegExpCacheStats(runtime, &stats);
+  EXPECT_EQ(stats.miss_count, 5);
+  EXPECT_EQ(stats.hit_count, 97);
+
+  JS_SetRegExpCacheCapacity(runtime, 2);
+  JS_GetRegExpCacheStats(runtime, &stats);
+  EXPECT_EQ(stats.count, 2);
+  JS_SetRegExpCacheCapacity(runtime, 0);
+  JS_GetRegExpCacheStats(runtime, &stats);
+  EXPECT_EQ(stats.count, 0);
+
+  JS_FreeContext(ctx);
+  JS_FreeContext(ctx2);
+  JS_FreeRuntime(runtime);
+}
+
+TEST(JS_NewStringFromUTF8, strictDecoding) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  auto decode = [ctx](const char* bytes, bool fatal = false) -> std::u16string {
+    JSValue value = JS_NewStringFromUTF8(ctx, reinterpret_cast<const uint8_t*>(bytes), strlen(bytes), fatal);
+    if (JS_IsNull(value))
+      return u"<fatal>";
+    uint32_t length;
+    uint16_t* buffer = JS_ToUnicode(ctx, value, &length);
+    std::u16string result(reinterpret_cast<char16_t*>(buffer), length);
+    free(buffer);
+    JS_FreeValue(ctx, value);
+    return result;
+  };
+
+  EXPECT_EQ(decode("") == u"", true);
+  EXPECT_EQ(decode("plain ascii") == u"plain ascii", true);
+  EXPECT_EQ(decode("caf\xc3\xa9") == u"café", true);
+  EXPECT_EQ(decode("\xe4\xb8\x96 \xf0\x9f\x98\x80") == u"世 \U0001F600", true);
+  // Encoded surrogates and truncated sequences are replaced, one U+FFFD per maximal subpart.
+  EXPECT_EQ(decode("a\xed\xa0\x80" "b") == u"a���b", true);
+  EXPECT_EQ(decode("a\xf0\x9f\x98") == u"a�", true);
+  EXPECT_EQ(decode("a\xf0\x9f\x98", true) == u"<fatal>", true);
+  EXPECT_EQ(decode("caf\xc3\xa9", true) == u"café", true);
+
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+TEST(JS_EncodeStringUTF8, intoUint8Array) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  std::u16string source = u"aé世\U0001F600";
+  JSValue string = JS_NewUnicodeString(ctx, reinterpret_cast<const uint16_t*>(source.c_str()), source.length());
+  EXPECT_EQ(JS_StringUTF8Length(string), 10);
+
+  uint8_t* data;
+  JSValue array = JS_NewUint8Array(ctx, 10, &data);
+  size_t read;
+  EXPECT_EQ(JS_EncodeStringUTF8(string, data, 10, &read), 10);
+  EXPECT_EQ(read, 5);
+  EXPECT_EQ(std::string(reinterpret_cast<char*>(data), 10), "a\xc3\xa9\xe4\xb8\x96\xf0\x9f\x98\x80");
+
+  // Only whole code points are written.
+  EXPECT_EQ(JS_EncodeStringUTF8(string, data, 8, &read), 6);
+  EXPECT_EQ(read, 3);
+  EXPECT_EQ(JS_EncodeStringUTF8(string, data, 2, &read), 1);
+  EXPECT_EQ(read, 1);
+
+  uint8_t* bytes;
+  size_t length;
+  EXPECT_EQ(JS_GetBufferSourceBytes(ctx, &bytes, &length, array), 0);
+  EXPECT_EQ(bytes, data);
+  EXPECT_EQ(length, 10);
+  EXPECT_EQ(JS_GetBufferSourceBytes(ctx, &bytes, &length, string), -1);
+  JS_FreeValue(ctx, JS_GetException(ctx));
+
+  JS_FreeValue(ctx, array);
+  JS_FreeValue(ctx, string);
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+TEST(JS_Base64DecodeString, forgiving) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  auto decode = [ctx](const std::u16string& source, bool to_bytes = false) -> std::string {
+    JSValue string = JS_NewUnicodeString(ctx, reinterpret_cast<const uint16_t*>(source.c_str()), source.length());
+    JSValue value = JS_Base64DecodeString(ctx, string, to_bytes);
+    JS_FreeValue(ctx, string);
+    if (JS_IsNull(value))
+      return "<error>";
+    std::string result;
+    if (to_bytes) {
+      uint8_t* bytes;
+      size_t length;
+      JS_GetBufferSourceBytes(ctx, &bytes, &length, value);
+      result.assign(reinterpret_cast<char*>(bytes), length);
+    } else {
+      uint32_t length;
+      uint16_t* buffer = JS_ToUnicode(ctx, value, &length);
+      for (uint32_t i = 0; i < length; i++)
+        result += static_cast<char>(buffer[i]);
+      free(buffer);
+    }
+    JS_FreeValue(ctx, value);
+    return result;
+  };
+
+  EXPECT_EQ(decode(u""), "");
+  EXPECT_EQ(decode(u"aGVsbG8="), "hello");
+  EXPECT_EQ(decode(u"aGVsbG8"), "hello");
+  EXPECT_EQ(decode(u" aGV\nsbG8 = "), "hello");
+  EXPECT_EQ(decode(u"/w=="), "\xff");
+  EXPECT_EQ(decode(u"/w==", true), "\xff");
+  EXPECT_EQ(decode(u"YWJjZGVmZ2hpamtsbW5vcHFyc3R1dnd4eXo=", true), "abcdefghijklmnopqrstuvwxyz");
+  EXPECT_EQ(decode(u"a"), "<error>");
+  EXPECT_EQ(decode(u"abc=="), "<error>");
+  EXPECT_EQ(decode(u"ab=c"), "<error>");
+  EXPECT_EQ(decode(u"abcd=", true), "<error>");
+  EXPECT_EQ(decode(u"aGVsébG8="), "<error>");
+  EXPECT_EQ(decode(u"aGVs世bG8="), "<error>");
+
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+TEST(JS_Base64EncodeString, latin1) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  auto encode = [ctx](const std::u16string& source) -> std::string {
+    JSValue string = JS_NewUnicodeString(ctx, reinterpret_cast<const uint16_t*>(source.c_str()), source.length());
+    JSValue value = JS_Base64EncodeString(ctx, string);
+    JS_FreeValue(ctx, string);
+    if (JS_IsNull(value))
+      return "<error>";
+    const char* chars = JS_ToCString(ctx, value);
+    std::string result = chars;
+    JS_FreeCString(ctx, chars);
+    JS_FreeValue(ctx, value);
+    return result;
+  };
+
+  EXPECT_EQ(encode(u""), "");
+  EXPECT_EQ(encode(u"hello"), "aGVsbG8=");
+  EXPECT_EQ(encode(u"ÿÿÀ"), "///A");
+  EXPECT_EQ(encode(u"世"), "<error>");
+  // 16-bit strings are encoded in chunks.
+  std::u16string wide(10000, u'é');
+  wide += u'世';
+  EXPECT_EQ(encode(wide), "<error>");
+  wide.pop_back();
+  wide.push_back(u'a');
+  std::string expected;
+  for (int i = 0; i < 3333; i++)
+    expected += "6enp";
+  EXPECT_EQ(encode(wide), expected + "6WE=");
+
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+static std::string EvalToString(JSContext* ctx, const std::string& code) {
+  JSValue result = JS_Eval(ctx, code.c_str(), code.size(), "vm://", JS_EVAL_TYPE_GLOBAL);
+  if (JS_IsException(result)) {
+    JS_FreeValue(ctx, result);
+    result = JS_GetException(ctx);
+  }
+  const char* chars = JS_ToCString(ctx, result);
+  std::string string = chars;
+  JS_FreeCString(ctx, chars);
+  JS_FreeValue(ctx, result);
+  return string;
+}
+
+// 16 objects with distinct shapes overflow the 8 entry ring of an access site.
+static const char* kMegamorphicObjects =
+    "var objects = [];"
+    "for (var i = 0; i < 16; i++) { var o = {}; o['p' + i] = i; o.x = i; objects.push(o); }";
+
+TEST(JS_InlineCache, megamorphicGetField) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  std::string code = std::string(kMegamorphicObjects) +
+                     "function get(o) { return o.x; }"
+                     "var sum = 0;"
+                     "for (var n = 0; n < 4; n++) for (var i = 0; i < 16; i++) sum += get(objects[i]);"
+                     "objects[4].x = 100;"
+                     "var proto = { x: 'proto' };"
+                     "var inherited = Object.create(proto);"
+                     "[sum, get(objects[4]), get(inherited), get({ y: 1 })].join();";
+  EXPECT_EQ(EvalToString(ctx, code), "480,100,proto,");
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+TEST(JS_InlineCache, megamorphicSetField) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  std::string code = std::string(kMegamorphicObjects) +
+                     "function set(o, v) { o.x = v; }"
+                     "for (var n = 0; n < 4; n++) for (var i = 0; i < 16; i++) set(objects[i], i * n);"
+                     "Object.defineProperty(objects[5], 'x', { writable: false });"
+                     "set(objects[5], -1);"
+                     "var stored;"
+                     "Object.defineProperty(objects[6], 'x', { set(v) { stored = v; } });"
+                     "set(objects[6], 'setter');"
+                     "[objects[1].x, objects[15].x, objects[5].x, stored].join();";
+  EXPECT_EQ(EvalToString(ctx, code), "3,45,15,setter");
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+TEST(JS_InlineCache, megamorphicDeleteProperty) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  std::string code = std::string(kMegamorphicObjects) +
+                     "function get(o) { return o.x; }"
+                     "function set(o, v) { o.x = v; }"
+                     "for (var n = 0; n < 4; n++) for (var i = 0; i < 16; i++) set(objects[i], get(objects[i]));"
+                     "delete objects[3].x;"
+                     "var deleted = get(objects[3]);"
+                     "set(objects[3], 'again');"
+                     "delete objects[7].p7;"
+                     "[deleted, get(objects[3]), get(objects[7]), get(objects[8])].join();";
+  EXPECT_EQ(EvalToString(ctx, code), ",again,7,8");
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+TEST(JS_InlineCache, megamorphicFrozenObject) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  std::string code = std::string(kMegamorphicObjects) +
+                     "function set(o, v) { o.x = v; }"
+                     "function strictSet(o, v) { 'use strict'; o.x = v; }"
+                     "var twin = {}; twin.p2 = 2; twin.x = 2;"
+                     "for (var n = 0; n < 4; n++) for (var i = 0; i < 16; i++) { set(objects[i], i); strictSet(objects[i], i); }"
+                     "set(twin, 2); strictSet(twin, 2);"
+                     "Object.freeze(objects[2]);"
+                     "set(objects[2], 'frozen');"
+                     "var error;"
+                     "try { strictSet(objects[2], 'frozen'); } catch (e) { error = e.name; }"
+                     "set(twin, 'twin');"
+                     "[objects[2].x, error, twin.x].join();";
+  EXPECT_EQ(EvalToString(ctx, code), "2,TypeError,twin");
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+TEST(JS_InlineCache, functionStats) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  std::string code = std::string(kMegamorphicObjects) +
+                     "function get(o) { return o.x; }"
+                     "for (var n = 0; n < 4; n++) for (var i = 0; i < 16; i++) get(objects[i]);";
+  JS_FreeValue(ctx, JS_Eval(ctx, code.c_str(), code.size(), "vm://", JS_EVAL_TYPE_GLOBAL));
+
+  JSValue global = JS_GetGlobalObject(ctx);
+  JSValue get = JS_GetPropertyStr(ctx, global, "get");
+  JSValue objects = JS_GetPropertyStr(ctx, global, "objects");
+  JSInlineCacheStats stats;
+  EXPECT_EQ(JS_GetFunctionInlineCacheStats(ctx, objects, &stats), -1);
+  if (JS_GetFunctionInlineCacheStats(ctx, get, &stats) == 0) {
+    // The first call runs before the site uses its cache. The first 8 shapes fill the ring and hit
+    // it afterwards, the other 8 miss once and then hit the stub cache.
+    EXPECT_EQ(stats.hit_count, 24);
+    EXPECT_EQ(stats.megamorphic_count, 24);
+    EXPECT_EQ(stats.miss_count, 15);
+  }
+
+  JS_FreeValue(ctx, objects);
+  JS_FreeValue(ctx, get);
+  JS_FreeValue(ctx, global);
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+TEST(JS_InlineCache, dumpStats) {
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  std::string code = std::string(kMegamorphicObjects) +
+                     "function get(o) { return o.x; }"
+                     "for (var i = 0; i < 16; i++) get(objects[i]);";
+  JS_FreeValue(ctx, JS_Eval(ctx, code.c_str(), code.size(), "vm://", JS_EVAL_TYPE_GLOBAL));
+
+  FILE* fp = tmpfile();
+  JS_DumpInlineCacheStats(runtime, fp);
+  std::string dump(ftell(fp), '\0');
+  rewind(fp);
+  dump.resize(fread(&dump[0], 1, dump.size(), fp));
+  fclose(fp);
+
+  JSValue global = JS_GetGlobalObject(ctx);
+  JSValue get = JS_GetPropertyStr(ctx, global, "get");
+  JSInlineCacheStats stats;
+  if (JS_GetFunctionInlineCacheStats(ctx, get, &stats) == 0) {
+    EXPECT_NE(dump.find("HITS"), std::string::npos);
+    EXPECT_NE(dump.find(" get (vm://:1)"), std::string::npos);
+  } else {
+    EXPECT_NE(dump.find("CONFIG_IC_STATS"), std::string::npos);
+  }
+
+  JS_FreeValue(ctx, get);
+  JS_FreeValue(ctx, global);
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+// Runs the QuickJS test suite against the engine as configured for WebF, so that
+// optional interpreter features like CONFIG_SUPERINSTRUCTIONS are covered by the unit tests.
+TEST(JS_TestSuite, passes) {
+  const char* suite[] = {"test_closure.js",         "test_language.js",     "test_builtin.js",         "test_loop.js",
+                         "test_line_column_num.js", "test_ic_atom_free.js", "test_promise_gc_crash.js"};
+  for (const char* name : suite) {
+    std::string path = std::string(SPEC_FILE_PATH) + "/third_party/quickjs/tests/" + name;
+    FILE* fp = fopen(path.c_str(), "rb");
+    ASSERT_NE(fp, nullptr) << path;
+    std::string source;
+    char buffer[4096];
+    size_t size;
+    while ((size = fread(buffer, 1, sizeof(buffer), fp)) > 0)
+      source.append(buffer, size);
+    fclose(fp);
+
+    JSRuntime* runtime = JS_NewRuntime();
+    JSContext* ctx = JS_NewContext(runtime);
+    JSValue result = JS_Eval(ctx, source.c_str(), source.size(), name, JS_EVAL_TYPE_GLOBAL);
+    if (JS_IsException(result)) {
+      JSValue exception = JS_GetException(ctx);
+      JSValue stack = JS_GetPropertyStr(ctx, exception, "stack");
+      const char* message = JS_ToCString(ctx, exception);
+      const char* trace = JS_ToCString(ctx, stack);
+      ADD_FAILURE() << name << ": " << message << "\n" << (trace ? trace : "");
+      JS_FreeCString(ctx, trace);
+      JS_FreeCString(ctx, message);
+      JS_FreeValue(ctx, stack);
+      JS_FreeValue(ctx, exception);
+    }
+    JS_FreeValue(ctx, result);
+    JSContext* pending;
+    while (JS_ExecutePendingJob(runtime, &pending) > 0) {
+    }
+    JS_FreeContext(ctx);
+    JS_FreeRuntime(runtime);
+  }
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "script_compiler.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+namespace webf {
+
+// QuickJS stops parsing at its own stack limit, the helper threads get a stack well above it instead of the platform
+// default for secondary threads, which is only 512 KB on Apple platforms.
+static constexpr size_t kCompilerThreadStackSize = 4 * 1024 * 1024;
+
+CompiledScript::~CompiledScript() {
+  free(bytecode);
+}
+
+uint8_t* CompiledScript::Release() {
+  uint8_t* result = bytecode;
+  bytecode = nullptr;
+  bytecode_len = 0;
+  return result;
+}
+
+ScriptCompileJob::ScriptCompileJob(const char* code, size_t code_len, const char* source_url)
+    : code_(code, code_len), source_url_(source_url) {}
+
+std::unique_ptr<CompiledScript> ScriptCompileJob::TakeResult() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (state_ == State::kQueued) {
+    state_ = State::kCancelled;
+    return nullptr;
+  }
+  cv_.wait(lock, [this] { return state_ != State::kCompiling; });
+  if (result_ == nullptr || !result_->success)
+    return nullptr;
+  return std::move(result_);
+}
+
+bool ScriptCompileJob::Start() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (state_ != State::kQueued)
+    return false;
+  state_ = State::kCompiling;
+  return true;
+}
+
+void ScriptCompileJob::Finish(std::unique_ptr<CompiledScript> result) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    result_ = std::move(result);
+    state_ = State::kDone;
+  }
+  cv_.notify_all();
+}
+
+void ScriptCompileJob::Cancel() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (state_ == State::kQueued)
+    state_ = State::kCancelled;
+}
+
+ScriptCompiler::ScriptCompiler(size_t thread_count) {
+  pthread_attr_t attr;
+  pthread_attr_init(&attr);
+  pthread_attr_setstacksize(&attr, kCompilerThreadStackSize);
+  for (size_t i = 0; i < std::max<size_t>(thread_count, 1); i++) {
+    pthread_t thread;
+    // Without helper threads every script is cancelled and compiled by the page itself.
+    if (pthread_create(&thread, &attr, ThreadMain, this) == 0) {
+      threads_.push_back(thread);
+    }
+  }
+  pthread_attr_destroy(&attr);
+}
+
+ScriptCompiler::~ScriptCompiler() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+  }
+  cv_.notify_all();
+  for (auto& thread : threads_) {
+    pthread_join(thread, nullptr);
+  }
+  // The jobs still queued are released here, a page waiting for one compiles the script itself.
+  while (!jobs_.empty()) {
+    jobs_.front()->Cancel();
+    jobs_.pop();
+  }
+}
+
+size_t ScriptCompiler::DefaultThreadCount() {
+  // Leave one core to the JS and UI threads.
+  size_t cores = std::thread::hardware_concurrency();
+  return std::clamp<size_t>(cores > 1 ? cores - 1 : 1, 1, 4);
+}
+
+std::shared_ptr<ScriptCompileJob> ScriptCompiler::Compile(const char* code, size_t code_len, const char* source_url) {
+  auto job = std::make_shared<ScriptCompileJob>(code, code_len, source_url);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    jobs_.push(job);
+  }
+  cv_.notify_one();
+  return job;
+}
+
+void ScriptCompiler::WaitUntilIdle() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  idle_cv_.wait(lock, [this] { return jobs_.empty() && compiling_count_ == 0; });
+}
+
+void* ScriptCompiler::ThreadMain(void* compiler) {
+  static_cast<ScriptCompiler*>(compiler)->Run();
+  return nullptr;
+}
+
+void ScriptCompiler::Run() {
+  // The scratch runtime is created on the helper thread, which also sets its stack top.
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+
+  while (true) {
+    std::shared_ptr<ScriptCompileJob> job;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      cv_.wait(lock, [this] { return !running_ || !jobs_.empty(); });
+      if (!running_)
+        break;
+      job = std::move(jobs_.front());
+      jobs_.pop();
+      compiling_count_++;
+    }
+    if (job->Start()) {
+      job->Finish(CompileScript(ctx, *job));
+    }
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      compiling_count_--;
+    }
+    idle_cv_.notify_all();
+  }
+
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+std::unique_ptr<CompiledScript> ScriptCompiler::CompileScript(JSContext* ctx, const ScriptCompileJob& job) {
+  auto result = std::make_unique<CompiledScript>();
+  JSValue byte_object = JS_Eval(ctx, job.code_.c_str(), job.code_.size(), job.source_url_.c_str(),
+                                JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
+  if (JS_IsException(byte_object)) {
+    // Syntax errors are reported by compiling again on the JS thread, with the error handlers of the page.
+    JS_FreeValue(ctx, JS_GetException(ctx));
+    return result;
+  }
+
+  size_t len;
+  uint8_t* bytes = JS_WriteObject(ctx, &len, byte_object, JS_WRITE_OBJ_BYTECODE);
+  JS_FreeValue(ctx, byte_object);
+  if (bytes == nullptr) {
+    JS_FreeValue(ctx, JS_GetException(ctx));
+    return result;
+  }
+
+  result->bytecode = static_cast<uint8_t*>(malloc(len));
+  if (result->bytecode != nullptr) {
+    memcpy(result->bytecode, bytes, len);
+    result->bytecode_len = len;
+    result->success = true;
+  }
+  js_free(ctx, bytes);
+  return result;
+}
+
+}  // namespace webf
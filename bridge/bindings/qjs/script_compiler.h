@@ -0,0 +1,92 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_BINDINGS_QJS_SCRIPT_COMPILER_H_
+#define BRIDGE_BINDINGS_QJS_SCRIPT_COMPILER_H_
+
+#include <pthread.h>
+#include <quickjs/quickjs.h>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <vector>
+
+namespace webf {
+
+// The bytecode of one script compiled by ScriptCompiler. The buffer is allocated with malloc() and is not tied
+// to any JSRuntime, it can be read into the page runtime with JS_ReadObject() and handed over to Dart.
+struct CompiledScript {
+  ~CompiledScript();
+
+  // Give up the ownership of the bytecode buffer.
+  uint8_t* Release();
+
+  bool success{false};
+  uint8_t* bytecode{nullptr};
+  size_t bytecode_len{0};
+};
+
+// A script queued on ScriptCompiler. The job keeps a copy of the source, so the buffers of the caller may go away
+// before it is compiled, and it does not know about the page: the page takes the result from its own JS thread.
+class ScriptCompileJob {
+ public:
+  ScriptCompileJob(const char* code, size_t code_len, const char* source_url);
+
+  // Called by the thread which evaluates the script, when the script is due. Waits for a compilation in progress.
+  // Returns nullptr when the caller has to compile the script itself: the compilation failed, or it had not started
+  // yet and is cancelled, since compiling right away is faster than waiting for a helper thread.
+  std::unique_ptr<CompiledScript> TakeResult();
+
+ private:
+  friend class ScriptCompiler;
+
+  enum class State { kQueued, kCompiling, kDone, kCancelled };
+
+  // Return false if the job was cancelled before a helper thread picked it up.
+  bool Start();
+  void Finish(std::unique_ptr<CompiledScript> result);
+  void Cancel();
+
+  std::string code_;
+  std::string source_url_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  State state_{State::kQueued};
+  std::unique_ptr<CompiledScript> result_;
+};
+
+// Compiles scripts to QuickJS bytecode on helper threads, so that parsing a big bundle overlaps with the tasks the
+// JS thread of the page runs before the script. Every helper thread owns a scratch JSRuntime, nothing but the
+// serialized bytecode leaves it. Scripts queued together are compiled in parallel, up to the number of helper threads.
+class ScriptCompiler {
+ public:
+  explicit ScriptCompiler(size_t thread_count);
+  ~ScriptCompiler();
+
+  std::shared_ptr<ScriptCompileJob> Compile(const char* code, size_t code_len, const char* source_url);
+
+  // Block until every queued script has been compiled. For tests.
+  void WaitUntilIdle();
+
+  static size_t DefaultThreadCount();
+
+ private:
+  static void* ThreadMain(void* compiler);
+  void Run();
+  static std::unique_ptr<CompiledScript> CompileScript(JSContext* ctx, const ScriptCompileJob& job);
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::condition_variable idle_cv_;
+  std::queue<std::shared_ptr<ScriptCompileJob>> jobs_;
+  std::vector<pthread_t> threads_;
+  size_t compiling_count_{0};
+  bool running_{true};
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_BINDINGS_QJS_SCRIPT_COMPILER_H_
@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "script_compiler.h"
+#include "gtest/gtest.h"
+
+using namespace webf;
+
+TEST(ScriptCompiler, compileInParallel) {
+  std::shared_ptr<ScriptCompileJob> jobs[8];
+  {
+    ScriptCompiler compiler(4);
+    for (int i = 0; i < 8; i++) {
+      std::string source = "function f(n) { return n * " + std::to_string(i) + "; } f(2);";
+      jobs[i] = compiler.Compile(source.c_str(), source.size(), "file://");
+    }
+    compiler.WaitUntilIdle();
+  }
+
+  JSRuntime* runtime = JS_NewRuntime();
+  JSContext* ctx = JS_NewContext(runtime);
+  for (int i = 0; i < 8; i++) {
+    std::unique_ptr<CompiledScript> script = jobs[i]->TakeResult();
+    ASSERT_NE(script, nullptr);
+    EXPECT_EQ(script->success, true);
+    JSValue function = JS_ReadObject(ctx, script->bytecode, script->bytecode_len, JS_READ_OBJ_BYTECODE);
+    JSValue value = JS_EvalFunction(ctx, function);
+    int32_t number;
+    JS_ToInt32(ctx, &number, value);
+    EXPECT_EQ(number, i * 2);
+    JS_FreeValue(ctx, value);
+  }
+  JS_FreeContext(ctx);
+  JS_FreeRuntime(runtime);
+}
+
+TEST(ScriptCompiler, syntaxError) {
+  std::string source = "function f( { return 1; }";
+  ScriptCompiler compiler(1);
+  std::shared_ptr<ScriptCompileJob> job = compiler.Compile(source.c_str(), source.size(), "file://");
+  compiler.WaitUntilIdle();
+  EXPECT_EQ(job->TakeResult(), nullptr);
+}
+
+TEST(ScriptCompiler, resultIsTakenOnlyOnce) {
+  std::string source = "1 + 1;";
+  ScriptCompiler compiler(1);
+  std::shared_ptr<ScriptCompileJob> job = compiler.Compile(source.c_str(), source.size(), "file://");
+  compiler.WaitUntilIdle();
+  EXPECT_NE(job->TakeResult(), nullptr);
+  EXPECT_EQ(job->TakeResult(), nullptr);
+}
+
+TEST(ScriptCompiler, queuedJobsAreReleasedOnShutdown) {
+  std::string source;
+  for (int i = 0; i < 10000; i++) {
+    source += "function f" + std::to_string(i) + "() { return " + std::to_string(i) + "; }\n";
+  }
+  std::weak_ptr<ScriptCompileJob> queued[16];
+  std::shared_ptr<ScriptCompileJob> kept;
+  {
+    ScriptCompiler compiler(1);
+    for (auto& job : queued) {
+      job = compiler.Compile(source.c_str(), source.size(), "file://");
+    }
+    kept = compiler.Compile(source.c_str(), source.size(), "file://");
+  }
+  // The compiler does not keep any job alive once destroyed.
+  for (auto& job : queued) {
+    EXPECT_TRUE(job.expired());
+  }
+  // A job the page still holds does not block, the page compiles it itself when there is no result.
+  EXPECT_EQ(kept->TakeResult(), nullptr);
+}
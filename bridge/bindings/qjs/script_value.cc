@@ -30,13 +30,13 @@ static JSValue FromNativeValue(ExecutingContext* context,
         auto* string = static_cast<SharedNativeString*>(native_value.u.ptr);
         if (string == nullptr)
           return JS_NULL;
-        JSValue returnedValue = JS_NewUnicodeString(context->ctx(), string->string(), string->length());
+        JSValue returnedValue = nativeStringToJSValue(context->ctx(), string);
         return returnedValue;
       } else {
         std::unique_ptr<AutoFreeNativeString> string{static_cast<AutoFreeNativeString*>(native_value.u.ptr)};
         if (string == nullptr)
           return JS_NULL;
-        JSValue returnedValue = JS_NewUnicodeString(context->ctx(), string->string(), string->length());
+        JSValue returnedValue = nativeStringToJSValue(context->ctx(), string.get());
         return returnedValue;
       }
     }
@@ -213,6 +213,7 @@ NativeValue ScriptValue::ToNative(JSContext* ctx, ExceptionState& exception_stat
       return Native_NewInt64(v);
     }
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
       // NativeString owned by NativeValue will be freed by users.
       return NativeValueConverter<NativeTypeString>::ToNativeValue(ctx, ToString(ctx));
     case JS_TAG_OBJECT: {
@@ -13,6 +13,7 @@
 #include "foundation/macros.h"
 #include "foundation/native_string.h"
 #include "foundation/native_value.h"
+#include "native_string_utils.h"
 #include "qjs_engine_patch.h"
 
 namespace webf {
@@ -43,7 +44,7 @@ class ScriptValue final {
   explicit ScriptValue(JSContext* ctx, const AtomicString& value)
       : value_(JS_AtomToString(ctx, value.Impl())), runtime_(JS_GetRuntime(ctx)){};
   explicit ScriptValue(JSContext* ctx, const SharedNativeString* string)
-      : value_(JS_NewUnicodeString(ctx, string->string(), string->length())), runtime_(JS_GetRuntime(ctx)) {}
+      : value_(nativeStringToJSValue(ctx, string)), runtime_(JS_GetRuntime(ctx)) {}
   explicit ScriptValue(JSContext* ctx, double v) : value_(JS_NewFloat64(ctx, v)), runtime_(JS_GetRuntime(ctx)) {}
   explicit ScriptValue(JSContext* ctx) : runtime_(JS_GetRuntime(ctx)){};
   explicit ScriptValue(JSContext* ctx, const NativeValue& native_value, bool shared_js_value = false);
@@ -36,10 +36,10 @@ inline JSValue toQuickJS(JSContext* ctx, const char* str) {
   return JS_NewString(ctx, str);
 }
 inline JSValue toQuickJS(JSContext* ctx, std::unique_ptr<SharedNativeString>& str) {
-  return JS_NewUnicodeString(ctx, str->string(), str->length());
+  return nativeStringToJSValue(ctx, str.get());
 }
 inline JSValue toQuickJS(JSContext* ctx, SharedNativeString* str) {
-  return JS_NewUnicodeString(ctx, str->string(), str->length());
+  return nativeStringToJSValue(ctx, str);
 }
 
 // ScriptWrapper
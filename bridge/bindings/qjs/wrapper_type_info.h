@@ -91,6 +91,10 @@ enum {
 
   JS_CLASS_DOM_TOKEN_LIST,
   JS_CLASS_DOM_STRING_MAP,
+  JS_CLASS_URL,
+  JS_CLASS_URL_SEARCH_PARAMS,
+  JS_CLASS_TEXT_ENCODER,
+  JS_CLASS_TEXT_DECODER,
 
   // SVG
   JS_CLASS_SVG_ELEMENT,
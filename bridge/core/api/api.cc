@@ -34,6 +34,35 @@ void evaluateScriptsInternal(void* page_,
                                                        persistent_handle, result_callback, is_success);
 }
 
+void evaluateCompiledScriptInternal(void* page_,
+                                    std::shared_ptr<ScriptCompileJob> job,
+                                    const char* code,
+                                    uint64_t code_len,
+                                    uint8_t** parsed_bytecodes,
+                                    uint64_t* bytecode_len,
+                                    const char* bundleFilename,
+                                    int32_t startLine,
+                                    Dart_Handle persistent_handle,
+                                    EvaluateScriptsCallback result_callback) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  assert(std::this_thread::get_id() == page->currentThread());
+  std::unique_ptr<CompiledScript> script = job->TakeResult();
+  if (script == nullptr) {
+    // Not compiled yet or failed to compile: compile on this thread, which also reports the syntax errors to the page.
+    evaluateScriptsInternal(page_, code, code_len, parsed_bytecodes, bytecode_len, bundleFilename, startLine,
+                            persistent_handle, result_callback);
+    return;
+  }
+  bool is_success = page->evaluateByteCode(script->bytecode, script->bytecode_len);
+  if (parsed_bytecodes != nullptr) {
+    // The bytecode was produced off thread already, hand it over to the Dart side for caching.
+    *bytecode_len = script->bytecode_len;
+    *parsed_bytecodes = script->Release();
+  }
+  page->dartIsolateContext()->dispatcher()->PostToDart(page->isDedicated(), ReturnEvaluateScriptsInternal,
+                                                       persistent_handle, result_callback, is_success);
+}
+
 static void ReturnEvaluateQuickjsByteCodeResultToDart(Dart_PersistentHandle persistent_handle,
                                                       EvaluateQuickjsByteCodeCallback result_callback,
                                                       bool is_success) {
@@ -61,6 +90,30 @@ void parseHTMLInternal(void* page_, const char* code, int32_t length) {
   delete code;
 }
 
+void getPageMemoryUsageInternal(void* page_, NativePageMemoryUsage* usage) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  assert(std::this_thread::get_id() == page->currentThread());
+  JSContextMemoryUsage context_usage;
+  page->executingContext()->GetMemoryUsage(&context_usage);
+  usage->malloc_size = context_usage.malloc_size;
+  usage->malloc_count = context_usage.malloc_count;
+  usage->soft_limit = context_usage.soft_limit;
+  usage->hard_limit = context_usage.hard_limit;
+  usage->soft_limit_exceeded = context_usage.soft_limit_exceeded ? 1 : 0;
+}
+
+void setPageMemoryLimitInternal(void* page_, int64_t soft_limit, int64_t hard_limit) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  assert(std::this_thread::get_id() == page->currentThread());
+  page->executingContext()->SetMemoryLimit(soft_limit, hard_limit);
+}
+
+void setPageLazyFunctionCompilationInternal(void* page_, int8_t enabled) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  assert(std::this_thread::get_id() == page->currentThread());
+  page->executingContext()->SetLazyFunctionCompilation(enabled == 1);
+}
+
 static void ReturnInvokeEventResultToDart(Dart_Handle persistent_handle,
                                           InvokeModuleEventCallback result_callback,
                                           webf::NativeValue* result) {
@@ -6,10 +6,13 @@
 #define WEBF_CORE_API_API_H_
 
 #include <cassert>
+#include <memory>
 #include "include/webf_bridge.h"
 
 namespace webf {
 
+class ScriptCompileJob;
+
 void evaluateScriptsInternal(void* page_,
                              const char* code,
                              uint64_t code_len,
@@ -20,6 +23,17 @@ void evaluateScriptsInternal(void* page_,
                              Dart_Handle dart_handle,
                              EvaluateScriptsCallback result_callback);
 
+void evaluateCompiledScriptInternal(void* page_,
+                                    std::shared_ptr<ScriptCompileJob> job,
+                                    const char* code,
+                                    uint64_t code_len,
+                                    uint8_t** parsed_bytecodes,
+                                    uint64_t* bytecode_len,
+                                    const char* bundleFilename,
+                                    int32_t startLine,
+                                    Dart_Handle persistent_handle,
+                                    EvaluateScriptsCallback result_callback);
+
 void evaluateQuickjsByteCodeInternal(void* page_,
                                      uint8_t* bytes,
                                      int32_t byteLen,
@@ -27,6 +41,10 @@ void evaluateQuickjsByteCodeInternal(void* page_,
                                      EvaluateQuickjsByteCodeCallback result_callback);
 void parseHTMLInternal(void* page_, const char* code, int32_t length);
 
+void getPageMemoryUsageInternal(void* page_, NativePageMemoryUsage* usage);
+void setPageMemoryLimitInternal(void* page_, int64_t soft_limit, int64_t hard_limit);
+void setPageLazyFunctionCompilationInternal(void* page_, int8_t enabled);
+
 void invokeModuleEventInternal(void* page_,
                                void* module_name,
                                const char* eventType,
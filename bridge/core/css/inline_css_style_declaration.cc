@@ -146,6 +146,10 @@ void InlineCssStyleDeclaration::CopyWith(InlineCssStyleDeclaration* inline_style
   }
 }
 
+std::string InlineCssStyleDeclaration::CSSPropertyName(const std::string& property_name) {
+  return convertCamelCaseToKebabCase(property_name);
+}
+
 AtomicString InlineCssStyleDeclaration::cssText() const {
   std::string result;
   size_t index = 0;
@@ -193,20 +197,6 @@ void InlineCssStyleDeclaration::Trace(GCVisitor* visitor) const {
   visitor->TraceMember(owner_element_);
 }
 
-std::string InlineCssStyleDeclaration::ToString() const {
-  if (properties_.empty())
-    return "";
-
-  std::string s;
-
-  for (auto& attr : properties_) {
-    s += attr.first + ": " + attr.second.ToStdString(ctx()) + ";";
-  }
-
-  s += "\"";
-  return s;
-}
-
 void InlineCssStyleDeclaration::InlineStyleChanged() {
   assert(owner_element_->IsStyledElement());
 
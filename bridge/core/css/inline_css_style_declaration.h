@@ -35,7 +35,9 @@ class InlineCssStyleDeclaration : public CSSStyleDeclaration {
   void setProperty(const AtomicString& key, const ScriptValue& value, ExceptionState& exception_state) override;
   AtomicString removeProperty(const AtomicString& key, ExceptionState& exception_state) override;
 
-  [[nodiscard]] std::string ToString() const;
+  const std::unordered_map<std::string, AtomicString>& Properties() const { return properties_; }
+  // The keys of Properties() are camelCased, this returns the name to write in CSS text.
+  static std::string CSSPropertyName(const std::string& property_name);
 
   void InlineStyleChanged();
 
@@ -57,8 +57,9 @@ document.body.style.setProperty('--main-color', 'lightblue'); console.assert(doc
 
   UICommandItem& last = buffer[commandSize - 2];
 
-  EXPECT_EQ(last.type, (int32_t)UICommand::kSetStyle);
-  uint16_t* last_key = (uint16_t*)last.string_01;
+  // ASCII property names are sent as one byte strings.
+  EXPECT_EQ(last.type, (int32_t)UICommand::kSetStyle | UI_COMMAND_ONE_BYTE_ARGS_FLAG);
+  auto* last_key = (uint8_t*)last.string_01;
 
   auto native_str = new webf::SharedNativeString(last_key, last.args_01_length);
   EXPECT_STREQ(AtomicString(context->ctx(),
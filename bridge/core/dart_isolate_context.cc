@@ -73,7 +73,9 @@ void InitializeBuiltInStrings(JSContext* ctx) {
 void DartIsolateContext::InitializeJSRuntime() {
   if (runtime_ != nullptr)
     return;
-  runtime_ = JS_NewRuntime();
+  // Pages on this thread share the runtime, charge allocations to each page's JSContext so that one page can be
+  // measured and limited without affecting the others.
+  runtime_ = JS_NewRuntimeWithMemoryAccounting();
   // Avoid stack overflow when running in multiple threads.
   JS_UpdateStackTop(runtime_);
   // Bump up the built-in classId. To make sure the created classId are larger than JS_CLASS_CUSTOM_CLASS_INIT_COUNT.
@@ -112,9 +114,18 @@ JSRuntime* DartIsolateContext::runtime() {
   return runtime_;
 }
 
+ScriptCompiler* DartIsolateContext::scriptCompiler() {
+  if (script_compiler_ == nullptr) {
+    script_compiler_ = std::make_unique<ScriptCompiler>(ScriptCompiler::DefaultThreadCount());
+  }
+  return script_compiler_.get();
+}
+
 DartIsolateContext::~DartIsolateContext() {}
 
 void DartIsolateContext::Dispose(multi_threading::Callback callback) {
+  // Queued scripts are cancelled, the pages waiting for one compile it themselves.
+  script_compiler_.reset();
   dispatcher_->Dispose([this, &callback]() {
     is_valid_ = false;
     data_.reset();
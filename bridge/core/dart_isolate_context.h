@@ -6,6 +6,7 @@
 #define WEBF_DART_CONTEXT_H_
 
 #include <set>
+#include "bindings/qjs/script_compiler.h"
 #include "bindings/qjs/script_value.h"
 #include "dart_context_data.h"
 #include "dart_methods.h"
@@ -53,6 +54,8 @@ class DartIsolateContext {
   }
 
   const std::unique_ptr<DartContextData>& EnsureData() const;
+  // Helper threads compiling the scripts of dedicated thread pages, created on first use.
+  ScriptCompiler* scriptCompiler();
 
   void* AddNewPage(double thread_identity, Dart_Handle dart_handle, AllocateNewPageCallback result_callback);
   void* AddNewPageSync(double thread_identity);
@@ -94,6 +97,7 @@ class DartIsolateContext {
   mutable std::unique_ptr<DartContextData> data_;
   std::set<std::unique_ptr<WebFPage>> pages_in_ui_thread_;
   std::unique_ptr<multi_threading::Dispatcher> dispatcher_ = nullptr;
+  std::unique_ptr<ScriptCompiler> script_compiler_ = nullptr;
   // Dart methods ptr should keep alive when ExecutingContext is disposing.
   const std::unique_ptr<DartMethodPointer> dart_method_ptr_ = nullptr;
 };
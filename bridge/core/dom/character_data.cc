@@ -15,10 +15,8 @@ void CharacterData::setData(const AtomicString& data, ExceptionState& exception_
   AtomicString old_data = data_;
   data_ = data;
 
-  std::unique_ptr<SharedNativeString> args_01 = data.ToNativeString(ctx());
-  std::unique_ptr<SharedNativeString> args_02 = stringToNativeString("data");
-  GetExecutingContext()->uiCommandBuffer()->addCommand(UICommand::kSetAttribute, std::move(args_01),
-                                                       (void*)bindingObject(), args_02.release());
+  GetExecutingContext()->uiCommandBuffer()->addCommand(UICommand::kSetTextData, data.ToNativeString(ctx()),
+                                                       (void*)bindingObject(), nullptr);
 
   DidModifyData(old_data);
 }
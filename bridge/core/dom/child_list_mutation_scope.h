@@ -62,7 +62,8 @@ class ChildListMutationScope final {
 
  public:
   explicit ChildListMutationScope(Node& target) {
-    if (!target.IsDocumentNode() && target.ownerDocument()->HasMutationObserversOfType(kMutationTypeChildList)) {
+    if (!target.IsDocumentNode() && target.ownerDocument()->HasMutationObserversOfType(kMutationTypeChildList) &&
+        (target.MutationObserverInterest() & kMutationTypeChildList)) {
       accumulator_ = ChildListMutationAccumulator::GetOrCreate(target);
       // Register another user of the accumulator.
       accumulator_->EnterMutationScope();
@@ -16,16 +16,16 @@ Node* ChildNodeList::VirtualOwnerNode() const {
 }
 
 Node* ChildNodeList::item(unsigned index, ExceptionState& exception_state) const {
-  return collection_index_cache_.NodeAt(*this, index);
+  return collection_items_cache_.NodeAt(*this, index);
 }
 
 bool ChildNodeList::NamedPropertyQuery(const AtomicString& key, ExceptionState& exception_state) {
   int32_t index = std::stoi(key.ToStdString(ctx()));
-  return collection_index_cache_.NodeAt(*this, index);
+  return collection_items_cache_.NodeAt(*this, index);
 }
 
 void ChildNodeList::NamedPropertyEnumerator(std::vector<AtomicString>& names, ExceptionState& exception_state) {
-  uint32_t size = collection_index_cache_.NodeCount(*this);
+  uint32_t size = collection_items_cache_.NodeCount(*this);
   for (int i = 0; i < size; i++) {
     names.emplace_back(AtomicString(ctx(), std::to_string(i)));
   }
@@ -33,11 +33,11 @@ void ChildNodeList::NamedPropertyEnumerator(std::vector<AtomicString>& names, Ex
 
 void ChildNodeList::ChildrenChanged(const ContainerNode::ChildrenChange& change) {
   if (change.IsChildInsertion()) {
-    collection_index_cache_.NodeInserted();
+    collection_items_cache_.NodeInserted(*change.sibling_changed, change.sibling_changed->previousSibling());
   } else if (change.IsChildRemoval()) {
-    collection_index_cache_.NodeRemoved();
+    collection_items_cache_.NodeRemoved(*change.sibling_changed);
   } else {
-    collection_index_cache_.Invalidate();
+    collection_items_cache_.Invalidate();
   }
 }
 
@@ -65,7 +65,7 @@ Node* ChildNodeList::TraverseBackwardToOffset(unsigned offset, Node& current_nod
 
 void ChildNodeList::Trace(GCVisitor* visitor) const {
   visitor->TraceMember(parent_);
-  collection_index_cache_.Trace(visitor);
+  collection_items_cache_.Trace(visitor);
   NodeList::Trace(visitor);
 }
 
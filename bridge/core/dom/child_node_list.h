@@ -36,7 +36,7 @@
 #define BRIDGE_CORE_DOM_CHILD_NODE_LIST_H_
 
 #include "bindings/qjs/cppgc/gc_visitor.h"
-#include "core/dom/collection_index_cache.h"
+#include "core/dom/collection_items_cache.h"
 #include "core/dom/node_list.h"
 
 namespace webf {
@@ -50,7 +50,7 @@ class ChildNodeList : public NodeList {
   ~ChildNodeList() override;
 
   // DOM API.
-  unsigned length() const override { return collection_index_cache_.NodeCount(*this); }
+  unsigned length() const override { return collection_items_cache_.NodeCount(*this); }
 
   Node* item(unsigned index, ExceptionState& exception_state) const override;
 
@@ -60,7 +60,7 @@ class ChildNodeList : public NodeList {
   // Non-DOM API.
   void ChildrenChanged(const ContainerNode::ChildrenChange&);
   void InvalidateCache() override {
-    collection_index_cache_.Invalidate();
+    collection_items_cache_.Invalidate();
     NodeList::InvalidateCache();
   }
   ContainerNode& OwnerNode() const { return *parent_.Get(); }
@@ -81,7 +81,8 @@ class ChildNodeList : public NodeList {
   Node* VirtualOwnerNode() const override;
 
   Member<ContainerNode> parent_;
-  mutable CollectionIndexCache<ChildNodeList, Node> collection_index_cache_;
+  // Indexes the children lazily, appending or removing the last child keeps the index.
+  mutable CollectionItemsCache<ChildNodeList, Node> collection_items_cache_;
 };
 
 }  // namespace webf
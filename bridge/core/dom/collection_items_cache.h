@@ -57,7 +57,15 @@ class CollectionItemsCache : public CollectionIndexCache<Collection, NodeType> {
   NodeType* NodeAt(const Collection&, unsigned index);
   void Invalidate() override;
 
+  // |node| was added to the collection right after |previous|. Appending to the end keeps the list valid, other
+  // changes drop it and it is rebuilt on the next random access.
+  void NodeInserted(NodeType& node, NodeType* previous);
+  void NodeRemoved(NodeType& node);
+
  private:
+  void BuildList(const Collection&);
+  void InvalidateList();
+
   bool list_valid_;
   std::vector<Member<NodeType>> cached_list_;
 };
@@ -71,27 +79,59 @@ CollectionItemsCache<Collection, NodeType>::~CollectionItemsCache() = default;
 template <typename Collection, typename NodeType>
 void CollectionItemsCache<Collection, NodeType>::Invalidate() {
   Base::Invalidate();
+  InvalidateList();
+}
+
+template <typename Collection, typename NodeType>
+void CollectionItemsCache<Collection, NodeType>::InvalidateList() {
   if (list_valid_) {
     cached_list_.clear();
     list_valid_ = false;
   }
 }
 
-template <class Collection, class NodeType>
-unsigned CollectionItemsCache<Collection, NodeType>::NodeCount(const Collection& collection) {
-  if (this->IsCachedNodeCountValid())
-    return this->CachedNodeCount();
+template <typename Collection, typename NodeType>
+void CollectionItemsCache<Collection, NodeType>::NodeInserted(NodeType& node, NodeType* previous) {
+  Base::NodeInserted();
+  if (list_valid_ && (cached_list_.empty() ? previous == nullptr : cached_list_.back() == previous)) {
+    cached_list_.emplace_back(&node);
+    assert(this->CachedNodeCount() == cached_list_.size());
+    return;
+  }
+  InvalidateList();
+}
 
+template <typename Collection, typename NodeType>
+void CollectionItemsCache<Collection, NodeType>::NodeRemoved(NodeType& node) {
+  Base::NodeRemoved();
+  if (list_valid_ && !cached_list_.empty() && cached_list_.back() == &node) {
+    cached_list_.pop_back();
+    assert(this->CachedNodeCount() == cached_list_.size());
+    return;
+  }
+  InvalidateList();
+}
+
+template <typename Collection, typename NodeType>
+void CollectionItemsCache<Collection, NodeType>::BuildList(const Collection& collection) {
+  assert(!list_valid_ && cached_list_.empty());
   NodeType* current_node = collection.TraverseToFirst();
   unsigned current_index = 0;
   while (current_node) {
     cached_list_.emplace_back(current_node);
-    //    cached_list_.push_back(current_node);
     current_node = collection.TraverseForwardToOffset(current_index + 1, *current_node, current_index);
   }
 
   this->SetCachedNodeCount(cached_list_.size());
   list_valid_ = true;
+}
+
+template <class Collection, class NodeType>
+unsigned CollectionItemsCache<Collection, NodeType>::NodeCount(const Collection& collection) {
+  if (this->IsCachedNodeCountValid())
+    return this->CachedNodeCount();
+
+  BuildList(collection);
   return this->CachedNodeCount();
 }
 
@@ -101,7 +141,18 @@ inline NodeType* CollectionItemsCache<Collection, NodeType>::NodeAt(const Collec
     assert(this->IsCachedNodeCountValid());
     return index < this->CachedNodeCount() ? cached_list_[index] : nullptr;
   }
-  return Base::NodeAt(collection, index);
+  if (this->IsCachedNodeCountValid() && index >= this->CachedNodeCount())
+    return nullptr;
+
+  // The first item and the neighbours of the cached node are reached in a step. Anything further builds the list
+  // once, so random access stays O(1) until the collection changes.
+  bool is_near_cached_node = this->CachedNode() && index + 1 >= this->CachedNodeIndex() &&
+                             index <= this->CachedNodeIndex() + 1;
+  if (index == 0 || is_near_cached_node)
+    return Base::NodeAt(collection, index);
+
+  BuildList(collection);
+  return index < this->CachedNodeCount() ? cached_list_[index] : nullptr;
 }
 
 }  // namespace webf
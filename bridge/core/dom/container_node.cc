@@ -34,6 +34,7 @@
 #include "core/html/html_all_collection.h"
 #include "document.h"
 #include "document_fragment.h"
+#include "foundation/native_type.h"
 #include "node_traversal.h"
 
 namespace webf {
@@ -44,6 +45,13 @@ HTMLCollection* ContainerNode::Children() {
 }
 
 unsigned ContainerNode::CountChildren() const {
+  // The child node list already knows its length once it has been indexed.
+  if (HasNodeData()) {
+    if (NodeList* lists = Data()->NodeLists()) {
+      if (lists->IsChildNodeList())
+        return lists->length();
+    }
+  }
   unsigned count = 0;
   for (Node* node = firstChild(); node; node = node->nextSibling())
     count++;
@@ -304,6 +312,18 @@ Node* ContainerNode::AppendChild(Node* new_child) {
   return AppendChild(new_child, ASSERT_NO_EXCEPTION());
 }
 
+void ContainerNode::AppendNewChildren(const NodeVector& new_children) {
+  if (new_children.empty())
+    return;
+
+  NodeVector post_insertion_notification_targets;
+  {
+    ChildListMutationScope mutation_scope(*this);
+    InsertNodeVector(new_children, nullptr, AdoptAndAppendChild(), &post_insertion_notification_targets);
+  }
+  DidInsertNodeVector(new_children, nullptr, post_insertion_notification_targets);
+}
+
 void ContainerNode::WillRemoveChild(Node& child) {
   assert(child.parentNode() == this);
   ChildListMutationScope(*this).WillRemoveChild(child);
@@ -315,6 +335,10 @@ void ContainerNode::WillRemoveChild(Node& child) {
 }
 
 void ContainerNode::WillRemoveChildren() {
+  // Nothing records the removal without observers, so skip collecting the children.
+  if (!GetDocument().HasMutationObservers())
+    return;
+
   NodeVector children;
   GetChildNodes(*this, children);
 
@@ -389,13 +413,23 @@ void ContainerNode::RemoveChildren() {
 
   bool has_element_child = false;
 
+  // The children are unlinked in one pass and Dart removes them with a single command.
   while (Node* child = first_child_) {
     if (child->IsElementNode()) {
       has_element_child = true;
     }
-    RemoveBetween(nullptr, child->nextSibling(), *child);
+    Node* next_child = child->nextSibling();
+    if (next_child)
+      next_child->SetPreviousSibling(nullptr);
+    SetFirstChild(next_child);
+    child->SetNextSibling(nullptr);
+    child->SetParentOrShadowHostNode(nullptr);
     NotifyNodeRemoved(*child);
   }
+  SetLastChild(nullptr);
+
+  GetExecutingContext()->uiCommandBuffer()->addCommand(UICommand::kRemoveAllChildren, nullptr, bindingObject(),
+                                                       nullptr);
 
   ChildrenChange change = {
       .type = ChildrenChangeType::kAllChildrenRemoved,
@@ -406,9 +440,11 @@ void ContainerNode::RemoveChildren() {
 
 void ContainerNode::CloneChildNodesFrom(const ContainerNode& node, CloneChildrenFlag flag) {
   assert(flag != CloneChildrenFlag::kSkip);
+  NodeVector clones;
   for (const Node& child : NodeTraversal::ChildrenOf(node)) {
-    AppendChild(child.Clone(GetDocument(), flag));
+    clones.emplace_back(child.Clone(GetDocument(), flag));
   }
+  AppendNewChildren(clones);
 }
 
 AtomicString ContainerNode::nodeValue() const {
@@ -456,6 +492,7 @@ void ContainerNode::InsertNodeVector(const NodeVector& targets,
       NotifyNodeInsertedInternal(child);
     }
   }
+  AddInsertionCommand(targets, next);
 }
 
 void ContainerNode::DidInsertNodeVector(const webf::NodeVector& targets,
@@ -488,10 +525,6 @@ void ContainerNode::InsertBeforeCommon(Node& next_child, Node& new_child) {
   new_child.SetParentOrShadowHostNode(this);
   new_child.SetPreviousSibling(prev);
   new_child.SetNextSibling(&next_child);
-
-  std::unique_ptr<SharedNativeString> args_01 = stringToNativeString("beforebegin");
-  GetExecutingContext()->uiCommandBuffer()->addCommand(UICommand::kInsertAdjacentNode, std::move(args_01),
-                                                       next_child.bindingObject(), new_child.bindingObject());
 }
 
 void ContainerNode::AppendChildCommon(Node& child) {
@@ -503,10 +536,26 @@ void ContainerNode::AppendChildCommon(Node& child) {
     SetFirstChild(&child);
   }
   SetLastChild(&child);
+}
+
+void ContainerNode::AddInsertionCommand(const NodeVector& nodes, Node* next) {
+  if (nodes.empty())
+    return;
+  auto* command_buffer = GetExecutingContext()->uiCommandBuffer();
+  void* target = next ? next->bindingObject() : bindingObject();
+  auto position = static_cast<int32_t>(next ? AdjacentPosition::kBeforeBegin : AdjacentPosition::kBeforeEnd);
+  if (nodes.size() == 1) {
+    command_buffer->addCommand(UICommand::kInsertAdjacentNode, position, target, nodes[0]->bindingObject());
+    return;
+  }
 
-  std::unique_ptr<SharedNativeString> args_01 = stringToNativeString("beforeend");
-  GetExecutingContext()->uiCommandBuffer()->addCommand(UICommand::kInsertAdjacentNode, std::move(args_01),
-                                                       bindingObject(), child.bindingObject());
+  // The nodes are sent as a null terminated list, which is freed by Dart.
+  auto** list = static_cast<NativeBindingObject**>(dart_malloc(sizeof(NativeBindingObject*) * (nodes.size() + 1)));
+  for (size_t i = 0; i < nodes.size(); i++) {
+    list[i] = nodes[i]->bindingObject();
+  }
+  list[nodes.size()] = nullptr;
+  command_buffer->addCommand(UICommand::kInsertAdjacentNodes, position, target, list);
 }
 
 void ContainerNode::NotifyNodeInsertedInternal(Node& root) {
@@ -531,6 +580,9 @@ void ContainerNode::NotifyNodeRemoved(Node& root) {
 }
 
 void ContainerNode::ChildrenChanged(const webf::ContainerNode::ChildrenChange& change) {
+  // The nodes inserted or removed now have other ancestors, and so other subtree observers.
+  if (change.type != ChildrenChangeType::kTextChanged && GetDocument().HasMutationObservers())
+    GetDocument().InvalidateMutationObserverInterest();
   InvalidateNodeListCachesInAncestors(&change);
 }
 
@@ -558,10 +610,12 @@ void ContainerNode::InvalidateNodeListCachesInAncestors(const webf::ContainerNod
   if (change && change->affects_elements == ChildrenChangeAffectsElements::kNo)
     return;
 
+  // Only the element collections hanging off the lists depend on the descendants, the child indexes of the ancestors
+  // are still valid. Lists are not created for nodes that have none.
   for (ContainerNode* node = this; node; node = node->parentNode()) {
-    NodeList* lists = node->childNodes();
-    if (lists->IsChildNodeList()) {
-      reinterpret_cast<ChildNodeList*>(lists)->InvalidateCache();
+    if (node->HasNodeData()) {
+      if (NodeList* lists = node->Data()->NodeLists())
+        lists->NodeList::InvalidateCache();
     }
   }
 }
@@ -41,6 +41,9 @@ class ContainerNode : public Node {
   Node* RemoveChild(Node* child, ExceptionState&);
   Node* AppendChild(Node* new_child, ExceptionState&);
   Node* AppendChild(Node* new_child);
+  // Appends nodes which have no parent yet, such as the output of the parser or of cloning. They reach Dart as one
+  // UI command.
+  void AppendNewChildren(const NodeVector& new_children);
   void WillRemoveChildren();
   void WillRemoveChild(Node& child);
   bool EnsurePreInsertionValidity(const Node& new_child,
@@ -182,6 +185,8 @@ class ContainerNode : public Node {
 
   void InsertBeforeCommon(Node& next_child, Node& new_child);
   void AppendChildCommon(Node& child);
+  // Sends the insertion of |nodes| before |next|, or at the end when it is null, to Dart.
+  void AddInsertionCommand(const NodeVector& nodes, Node* next);
 
   void NotifyNodeInsertedInternal(Node&);
   void NotifyNodeRemoved(Node&);
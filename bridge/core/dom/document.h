@@ -103,6 +103,14 @@ class Document : public ContainerNode, public TreeScope {
   bool HasMutationObserversOfType(MutationType type) const { return mutation_observer_types_ & type; }
   bool HasMutationObservers() const { return mutation_observer_types_; }
   void AddMutationObserverTypes(MutationType types) { mutation_observer_types_ |= types; }
+  // The mutation observer interest cached on the nodes is valid while the generation is unchanged. It changes when
+  // a registration changes, or when the tree changes while there are observers.
+  uint32_t MutationObserverInterestGeneration() const { return mutation_observer_interest_generation_; }
+  void InvalidateMutationObserverInterest() {
+    // Zero marks a node whose interest was never computed.
+    if (++mutation_observer_interest_generation_ == 0)
+      mutation_observer_interest_generation_ = 1;
+  }
 
   // nodeWillBeRemoved is only safe when removing one node at a time.
   void NodeWillBeRemoved(Node&);
@@ -130,7 +138,8 @@ class Document : public ContainerNode, public TreeScope {
  private:
   int node_count_{0};
   ScriptAnimationController script_animation_controller_;
-  MutationObserverOptions mutation_observer_types_;
+  MutationObserverOptions mutation_observer_types_{0};
+  uint32_t mutation_observer_interest_generation_{1};
 };
 
 template <>
@@ -27,7 +27,9 @@
  */
 
 #include "dom_token_list.h"
+#include "core/executing_context.h"
 #include "element.h"
+#include "html_names.h"
 
 namespace webf {
 
@@ -241,19 +243,27 @@ bool DOMTokenList::supports(const AtomicString& token, ExceptionState& exception
 // https://dom.spec.whatwg.org/#dom-domtokenlist-add
 void DOMTokenList::AddTokens(const std::vector<AtomicString>& tokens) {
   // 2. For each token in tokens, append token to context object’s token set.
-  for (const auto& token : tokens)
-    token_set_.Add(element_->ctx(), AtomicString(token));
+  std::vector<AtomicString> added_tokens;
+  for (const auto& token : tokens) {
+    if (token_set_.Contains(token))
+      continue;
+    token_set_.Add(element_->ctx(), token);
+    added_tokens.push_back(token);
+  }
   // 3. Run the update steps.
-  UpdateWithTokenSet(token_set_);
+  UpdateWithChangedTokens(UICommand::kAddClass, added_tokens);
 }
 
 // https://dom.spec.whatwg.org/#dom-domtokenlist-remove
 void DOMTokenList::RemoveTokens(const std::vector<AtomicString>& tokens) {
   // 2. For each token in tokens, remove token from context object’s token set.
-  for (const auto& token : tokens)
-    token_set_.Remove(AtomicString(token));
+  std::vector<AtomicString> removed_tokens;
+  for (const auto& token : tokens) {
+    if (token_set_.Remove(token))
+      removed_tokens.push_back(token);
+  }
   // 3. Run the update steps.
-  UpdateWithTokenSet(token_set_);
+  UpdateWithChangedTokens(UICommand::kRemoveClass, removed_tokens);
 }
 
 // https://dom.spec.whatwg.org/#concept-dtl-update
@@ -263,15 +273,32 @@ void DOMTokenList::UpdateWithTokenSet(const SpaceSplitString& token_set) {
   is_in_update_step_ = false;
 }
 
+// The update steps of add() and remove() on the class list. Dart only receives the tokens which were added or removed,
+// instead of the serialized token set.
+void DOMTokenList::UpdateWithChangedTokens(UICommand command, const std::vector<AtomicString>& tokens) {
+  if (attribute_name_ != html_names::kClassAttr) {
+    UpdateWithTokenSet(token_set_);
+    return;
+  }
+
+  is_in_update_step_ = true;
+  element_->SetTokenListAttribute(attribute_name_, token_set_.SerializeToString(element_->ctx()));
+  is_in_update_step_ = false;
+
+  for (const auto& token : tokens) {
+    GetExecutingContext()->uiCommandBuffer()->addCommand(command, token.ToNativeString(element_->ctx()),
+                                                         element_->bindingObject(), nullptr);
+  }
+}
+
 AtomicString DOMTokenList::value() const {
   AtomicString result = element_->getAttribute(attribute_name_, ASSERT_NO_EXCEPTION());
   return result == AtomicString::Null() ? AtomicString::Empty() : result;
 }
 
+// The token set is updated by the element when the attribute changes.
 void DOMTokenList::setValue(const AtomicString& new_value, ExceptionState& exception_state) {
-  AtomicString old_value = value();
   element_->setAttribute(attribute_name_, new_value);
-  DidUpdateAttributeValue(old_value, new_value);
 }
 
 // https://dom.spec.whatwg.org/#concept-domtokenlist-validation
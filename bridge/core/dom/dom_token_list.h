@@ -8,6 +8,7 @@
 #include "bindings/qjs/cppgc/gc_visitor.h"
 #include "bindings/qjs/cppgc/member.h"
 #include "bindings/qjs/script_wrappable.h"
+#include "foundation/ui_command_buffer.h"
 #include "space_split_string.h"
 
 namespace webf {
@@ -55,6 +56,7 @@ class DOMTokenList : public ScriptWrappable {
   void AddTokens(const std::vector<AtomicString>&);
   void RemoveTokens(const std::vector<AtomicString>&);
   void UpdateWithTokenSet(const SpaceSplitString&);
+  void UpdateWithChangedTokens(UICommand command, const std::vector<AtomicString>& tokens);
 
   Member<Element> element_;
   AtomicString attribute_name_;
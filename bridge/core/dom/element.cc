@@ -13,6 +13,7 @@
 #include "comment.h"
 #include "core/dom/document_fragment.h"
 #include "core/fileapi/blob.h"
+#include "core/html/html_serializer.h"
 #include "core/html/html_template_element.h"
 #include "core/html/parser/html_parser.h"
 #include "element_attribute_names.h"
@@ -69,10 +70,24 @@ void Element::setAttribute(const AtomicString& name, const AtomicString& value,
   SetAttributeInternal(name, value, AttributeModificationReason::kDirectly, exception_state);
 }
 
+void Element::SetTokenListAttribute(const AtomicString& name, const AtomicString& value) {
+  SetAttributeInternal(name, value, AttributeModificationReason::kByTokenList, ASSERT_NO_EXCEPTION());
+}
+
 void Element::removeAttribute(const AtomicString& name, ExceptionState& exception_state) {
   EnsureElementAttributes().removeAttribute(name, exception_state);
 }
 
+void Element::ParserSetAttributes(const ElementAttributes::SharedAttributeVector& attributes) {
+  assert(!parentNode());
+  EnsureElementAttributes().AdoptSharedAttributes(attributes);
+  for (auto& attribute : *attributes) {
+    AttributeChanged(
+        AttributeModificationParams(attribute.first, AtomicString::Null(), attribute.second,
+                                    AttributeModificationReason::kByParser));
+  }
+}
+
 BoundingClientRect* Element::getBoundingClientRect(ExceptionState& exception_state) {
   NativeValue result = InvokeBindingMethod(
       binding_call_methods::kgetBoundingClientRect, 0, nullptr,
@@ -366,6 +381,8 @@ Node* Element::Clone(Document& factory, CloneChildrenFlag flag) const {
 }
 
 Element& Element::CloneWithoutAttributesAndChildren(Document& factory) const {
+  if (namespace_uri_ != element_namespace_uris::khtml)
+    return *(factory.createElementNS(namespace_uri_, local_name_, ASSERT_NO_EXCEPTION()));
   return *(factory.createElement(local_name_, ASSERT_NO_EXCEPTION()));
 }
 
@@ -464,7 +481,13 @@ void Element::DidModifyAttribute(const AtomicString& name,
   AttributeChanged(AttributeModificationParams(name, old_value, new_value, reason));
 }
 
-void Element::DidRemoveAttribute(const AtomicString& name, const AtomicString& old_value) {}
+void Element::DidRemoveAttribute(const AtomicString& name, const AtomicString& old_value) {
+  // The class list serializes its tokens into the attribute on the next change, it must not keep the removed ones.
+  if (name == html_names::kClassAttr && HasElementData()) {
+    if (DOMTokenList* class_list = GetElementData()->GetClassList())
+      class_list->DidUpdateAttributeValue(old_value, AtomicString::Null());
+  }
+}
 
 void Element::SynchronizeStyleAttributeInternal() {
   assert(IsStyledElement());
@@ -481,6 +504,7 @@ void Element::SetAttributeInternal(const webf::AtomicString& name,
                                    const webf::AtomicString& value,
                                    AttributeModificationReason reason,
                                    ExceptionState& exception_state) {
+  bool sync_to_dart = reason != AttributeModificationReason::kByTokenList;
   if (EnsureElementAttributes().hasAttribute(name, exception_state)) {
     AtomicString&& oldAttribute = EnsureElementAttributes().getAttribute(name, exception_state);
 
@@ -488,7 +512,7 @@ void Element::SetAttributeInternal(const webf::AtomicString& name,
       WillModifyAttribute(name, oldAttribute, value);
     }
 
-    if (!EnsureElementAttributes().setAttribute(name, value, exception_state)) {
+    if (!EnsureElementAttributes().setAttribute(name, value, exception_state, sync_to_dart)) {
       return;
     }
     if (reason != AttributeModificationReason::kBySynchronizationOfLazyAttribute) {
@@ -499,7 +523,7 @@ void Element::SetAttributeInternal(const webf::AtomicString& name,
       WillModifyAttribute(name, AtomicString::Null(), value);
     }
 
-    if (!EnsureElementAttributes().setAttribute(name, value, exception_state)) {
+    if (!EnsureElementAttributes().setAttribute(name, value, exception_state, sync_to_dart)) {
       return;
     }
 
@@ -527,6 +551,11 @@ void Element::InvalidateStyleAttribute() {
 void Element::AttributeChanged(const AttributeModificationParams& params) {
   const AtomicString& name = params.name;
 
+  if (name == html_names::kClassAttr && HasElementData()) {
+    if (DOMTokenList* class_list = GetElementData()->GetClassList())
+      class_list->DidUpdateAttributeValue(params.old_value, params.new_value);
+  }
+
   if (IsStyledElement()) {
     if (name == html_names::kStyleAttr) {
       StyleAttributeChanged(params.new_value, params.reason);
@@ -550,52 +579,11 @@ void Element::SetInlineStyleFromString(const webf::AtomicString& new_style_strin
 }
 
 std::string Element::outerHTML() {
-  std::string tagname = local_name_.ToStdString(ctx());
-  std::string s = "<" + tagname;
-
-  // Read attributes
-  if (attributes_ != nullptr) {
-    s += " " + attributes_->ToString();
-  }
-  if (cssom_wrapper_ != nullptr) {
-    s += " style=\"" + cssom_wrapper_->ToString();
-  }
-
-  s += ">";
-
-  std::string childHTML = innerHTML();
-  s += childHTML;
-  s += "</" + tagname + ">";
-
-  return s;
+  return HTMLSerializer::SerializeNode(*this);
 }
 
 std::string Element::innerHTML() {
-  std::string s;
-
-  // If Element is TemplateElement, the innerHTML content is the content of documentFragment.
-  Node* parent = To<Node>(this);
-
-  if (auto* template_element = DynamicTo<HTMLTemplateElement>(this)) {
-    parent = To<Node>(template_element->content());
-  }
-
-  if (parent->firstChild() == nullptr)
-    return s;
-
-  auto* child = parent->firstChild();
-  while (child != nullptr) {
-    if (auto* element = DynamicTo<Element>(child)) {
-      s += element->outerHTML();
-    } else if (auto* text = DynamicTo<Text>(child)) {
-      s += text->data().ToStdString(ctx());
-    } else if (auto* comment = DynamicTo<Comment>(child)) {
-      s += "<!--" + comment->data().ToStdString(ctx()) + "-->";
-    }
-    child = child->nextSibling();
-  }
-
-  return s;
+  return HTMLSerializer::SerializeChildren(*this);
 }
 
 void Element::setInnerHTML(const AtomicString& value, ExceptionState& exception_state) {
@@ -28,7 +28,9 @@ class Element : public ContainerNode {
     kByParser,
     kByCloning,
     kByMoveToNewDocument,
-    kBySynchronizationOfLazyAttribute
+    kBySynchronizationOfLazyAttribute,
+    // The DOMTokenList sends the changed tokens to Dart instead of the attribute.
+    kByTokenList
   };
 
   struct AttributeModificationParams {
@@ -55,6 +57,7 @@ class Element : public ContainerNode {
 
   ElementAttributes* attributes() const { return &EnsureElementAttributes(); }
   ElementAttributes& EnsureElementAttributes() const;
+  ElementAttributes* AttributesIfExists() const { return attributes_.Get(); }
 
   bool hasAttribute(const AtomicString&, ExceptionState& exception_state);
   AtomicString getAttribute(const AtomicString&, ExceptionState& exception_state) const;
@@ -63,7 +66,12 @@ class Element : public ContainerNode {
   // calling either of these set methods.
   void setAttribute(const AtomicString&, const AtomicString& value);
   void setAttribute(const AtomicString&, const AtomicString& value, ExceptionState&);
+  // Sets the attribute of a DOMTokenList which sends its own commands to Dart.
+  void SetTokenListAttribute(const AtomicString&, const AtomicString& value);
   void removeAttribute(const AtomicString&, ExceptionState& exception_state);
+  // Sets the attributes of an element created by the parser, before it is inserted into the tree. |attributes| may be
+  // shared with other elements.
+  void ParserSetAttributes(const ElementAttributes::SharedAttributeVector& attributes);
   BoundingClientRect* getBoundingClientRect(ExceptionState& exception_state);
   std::vector<BoundingClientRect*> getClientRects(ExceptionState& exception_state);
   void click(ExceptionState& exception_state);
@@ -125,6 +133,7 @@ class Element : public ContainerNode {
 
   InlineCssStyleDeclaration* style();
   InlineCssStyleDeclaration& EnsureCSSStyleDeclaration();
+  InlineCssStyleDeclaration* InlineStyle() const { return cssom_wrapper_.Get(); }
   DOMTokenList* classList();
   DOMStringMap* dataset();
 
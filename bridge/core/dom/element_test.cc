@@ -168,4 +168,200 @@ TEST(Element, instanceofEventTarget) {
 
   EXPECT_EQ(errorCalled, false);
   EXPECT_EQ(logCalled, true);
-}
\ No newline at end of file
+}
+TEST(Element, serializeEscapedMarkup) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(),
+                 "<p title=\"a&amp;&quot;<b>\">1 &lt; 2 &amp;&amp; 3 &gt; 2<br><!--x<y--><script>a<b</script>"
+                 "<template><i>\xe4\xb8\xad&nbsp;</i></template></p>");
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  const char* code = R"(
+const p = document.createElement('p');
+p.setAttribute('title', 'a&"<b>');
+p.appendChild(document.createTextNode('1 < 2 && 3 > 2'));
+p.appendChild(document.createElement('br'));
+p.appendChild(document.createComment('x<y'));
+const script = document.createElement('script');
+script.appendChild(document.createTextNode('a<b'));
+p.appendChild(script);
+const template = document.createElement('template');
+template.innerHTML = '<i>中\u00a0</i>';
+p.appendChild(template);
+console.log(p.outerHTML);
+)";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(Element, serializeDeepTree) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "true 100000");
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  const char* code = R"(
+const root = document.createElement('div');
+let node = root;
+for (let i = 0; i < 10000; i++) {
+  const child = document.createElement('b');
+  node.appendChild(child);
+  node = child;
+}
+const html = root.innerHTML;
+console.log(html === '<b>'.repeat(10000) + '</b>'.repeat(10000), html.length / 7 * 10);
+)";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(Element, serializeInlineStyle) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "<div style=\"background-color: red;\"></div> red");
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  const char* code = R"(
+const container = document.createElement('div');
+container.innerHTML = '<div style="background-color:red"></div>';
+const html = container.innerHTML;
+const copy = document.createElement('div');
+copy.innerHTML = html;
+console.log(html, copy.firstChild.style.backgroundColor);
+)";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(Element, classListTokens) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "true false 12 true 1 2 c10 | a c b | b c | true 1 false");
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  const char* code = R"(
+const many = document.createElement('div');
+many.className = 'c0 c1 c2 c3 c4 c5 c6 c7 c8 c9';
+many.classList.add('1', '2');
+many.classList.remove('c0');
+many.classList.toggle('c10');
+const manyResult = [many.classList.contains('c9'), many.classList.contains('c0'), many.classList.length,
+  many.classList.contains('2'), many.className.split(' ').slice(-3).join(' ')].join(' ');
+
+const replaced = document.createElement('div');
+replaced.className = 'a b c';
+replaced.classList.replace('b', 'c');
+replaced.classList.add('b');
+const replacedResult = replaced.className;
+
+const first = document.createElement('div');
+const second = document.createElement('div');
+first.className = 'a b c';
+second.className = 'a b c';
+first.classList.contains('a');
+second.classList.remove('a');
+second.setAttribute('class', second.className);
+const sharedResult = [first.classList.contains('a'), second.classList.length === 2, second.classList.contains('a')];
+first.setAttribute('class', 'b');
+
+console.log(manyResult, '|', replacedResult, '|', second.className, '|', sharedResult[0], first.classList.length,
+  sharedResult[2]);
+)";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(Element, classListSendsChangedTokens) {
+  bool static errorCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {};
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto context = env->page()->executingContext();
+  const char* code = "globalThis.item = document.createElement('div'); item.className = 'a b';";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  context->uiCommandBuffer()->clear();
+
+  const char* update_code = "item.classList.add('a', 'c'); item.classList.remove('b', 'd'); item.classList.toggle('e');";
+  env->page()->evaluateScript(update_code, strlen(update_code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+
+  auto* buffer = static_cast<UICommandItem*>(context->uiCommandBuffer()->data());
+  size_t command_size = context->uiCommandBuffer()->size();
+  std::string changes;
+  for (size_t i = 0; i < command_size; i++) {
+    UICommandItem& item = buffer[i];
+    auto type = static_cast<UICommand>(item.type & ~UI_COMMAND_ONE_BYTE_ARGS_FLAG);
+    EXPECT_NE(type, UICommand::kSetAttribute);
+    if (type != UICommand::kAddClass && type != UICommand::kRemoveClass)
+      continue;
+    changes += type == UICommand::kAddClass ? '+' : '-';
+    changes.append(reinterpret_cast<const char*>(item.string_01), item.args_01_length);
+  }
+  EXPECT_EQ(changes, "+c-b+e");
+}
+
+TEST(Element, classListIsResetByRemoveAttribute) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+    EXPECT_STREQ(message.c_str(), "x 1 false");
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto context = env->page()->executingContext();
+  const char* code = "globalThis.item = document.createElement('div'); item.className = 'a b'; item.classList.length;";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  context->uiCommandBuffer()->clear();
+
+  const char* update_code =
+      "item.removeAttribute('class'); item.classList.add('x');"
+      "console.log(item.getAttribute('class'), item.classList.length, item.classList.contains('a'));";
+  env->page()->evaluateScript(update_code, strlen(update_code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+
+  auto* buffer = static_cast<UICommandItem*>(context->uiCommandBuffer()->data());
+  size_t command_size = context->uiCommandBuffer()->size();
+  std::string changes;
+  for (size_t i = 0; i < command_size; i++) {
+    UICommandItem& item = buffer[i];
+    auto type = static_cast<UICommand>(item.type & ~UI_COMMAND_ONE_BYTE_ARGS_FLAG);
+    if (type == UICommand::kRemoveAttribute) {
+      changes += '!';
+    } else if (type == UICommand::kAddClass || type == UICommand::kRemoveClass) {
+      changes += type == UICommand::kAddClass ? '+' : '-';
+      changes.append(reinterpret_cast<const char*>(item.string_01), item.args_01_length);
+    }
+  }
+  EXPECT_EQ(changes, "!+x");
+}
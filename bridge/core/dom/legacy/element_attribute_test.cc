@@ -25,4 +25,30 @@ TEST(Element, overrideAttribute) {
   env->page()->evaluateScript(code, strlen(code), "vm://", 0);
   EXPECT_EQ(errorCalled, false);
   EXPECT_EQ(logCalled, false);
-}
\ No newline at end of file
+}
+TEST(Element, sharedParserAttributes) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    EXPECT_STREQ(message.c_str(), "b a a null x true");
+    logCalled = true;
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto context = env->page()->executingContext();
+  const char* code = R"(
+const container = document.createElement('div');
+container.innerHTML = '<p class="a" id="x"></p><p class="a" id="x"></p><p class="a" id="x"></p>';
+const [first, second, third] = container.children;
+first.setAttribute('class', 'b');
+third.removeAttribute('id');
+const clone = second.cloneNode(false);
+console.log(first.getAttribute('class'), second.getAttribute('class'), third.getAttribute('class'),
+            third.getAttribute('id'), clone.getAttribute('id'), second.hasAttribute('id'));
+)";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
@@ -4,6 +4,7 @@
  */
 
 #include "element_attributes.h"
+#include <algorithm>
 #include "bindings/qjs/exception_state.h"
 #include "core/dom/element.h"
 #include "core/html/custom/widget_element.h"
@@ -12,6 +13,12 @@
 
 namespace webf {
 
+template <typename Vector>
+static inline auto FindAttribute(Vector& attributes, const AtomicString& name) {
+  return std::find_if(attributes.begin(), attributes.end(),
+                      [&name](const auto& attribute) { return attribute.first == name; });
+}
+
 static inline bool IsNumberIndex(const StringView& name) {
   if (name.Empty())
     return false;
@@ -28,7 +35,8 @@ AtomicString ElementAttributes::getAttribute(const AtomicString& name, Exception
     return AtomicString::Null();
   }
 
-  if (attributes_.count(name) == 0) {
+  auto it = FindAttribute(Attributes(), name);
+  if (it == end()) {
     if (element_->IsWidgetElement()) {
       // Fallback to directly FFI access to dart.
       NativeValue dart_result =
@@ -40,13 +48,13 @@ AtomicString ElementAttributes::getAttribute(const AtomicString& name, Exception
     return AtomicString::Null();
   }
 
-  AtomicString value = attributes_[name];
-  return value;
+  return it->second;
 }
 
 bool ElementAttributes::setAttribute(const AtomicString& name,
                                      const AtomicString& value,
-                                     ExceptionState& exception_state) {
+                                     ExceptionState& exception_state,
+                                     bool sync_to_dart) {
   bool numberIndex = IsNumberIndex(name.ToStringView());
 
   if (numberIndex) {
@@ -56,12 +64,16 @@ bool ElementAttributes::setAttribute(const AtomicString& name,
     return false;
   }
 
-  AtomicString existing_attribute = attributes_[name];
-
-  attributes_[name] = value;
+  AttributeVector& attributes = MutableAttributes();
+  auto it = FindAttribute(attributes, name);
+  if (it == attributes.end()) {
+    attributes.emplace_back(name, value);
+  } else {
+    it->second = value;
+  }
 
   // Style attribute will be parsed and separated into multiple setStyle command.
-  if (name == html_names::kStyleAttr)
+  if (name == html_names::kStyleAttr || !sync_to_dart)
     return true;
 
   std::unique_ptr<SharedNativeString> args_01 = value.ToNativeString(ctx());
@@ -80,7 +92,7 @@ bool ElementAttributes::hasAttribute(const AtomicString& name, ExceptionState& e
     return false;
   }
 
-  bool has_attribute = attributes_.count(name) > 0;
+  bool has_attribute = FindAttribute(Attributes(), name) != end();
 
   if (!has_attribute && element_->IsWidgetElement()) {
     // Fallback to directly FFI access to dart.
@@ -99,7 +111,12 @@ void ElementAttributes::removeAttribute(const AtomicString& name, ExceptionState
   AtomicString old_value = getAttribute(name, exception_state);
   element_->WillModifyAttribute(name, old_value, AtomicString::Null());
 
-  attributes_.erase(name);
+  // Widget elements can report attributes which only exist in Dart.
+  if (FindAttribute(Attributes(), name) != end()) {
+    AttributeVector& attributes = MutableAttributes();
+    attributes.erase(FindAttribute(attributes, name));
+  }
+  element_->DidRemoveAttribute(name, old_value);
 
   std::unique_ptr<SharedNativeString> args_01 = name.ToNativeString(ctx());
   GetExecutingContext()->uiCommandBuffer()->addCommand(UICommand::kRemoveAttribute, std::move(args_01),
@@ -107,40 +124,68 @@ void ElementAttributes::removeAttribute(const AtomicString& name, ExceptionState
 }
 
 void ElementAttributes::CopyWith(ElementAttributes* attributes) {
-  for (auto& attr : attributes->attributes_) {
-    attributes_[attr.first] = attr.second;
+  // Share the vector of |attributes| until one of the elements changes its attributes.
+  if (attributes_ == nullptr || attributes_->empty()) {
+    attributes_ = attributes->attributes_;
+    return;
+  }
+  AttributeVector& target = MutableAttributes();
+  for (auto& attr : attributes->Attributes()) {
+    auto it = FindAttribute(target, attr.first);
+    if (it == target.end()) {
+      target.emplace_back(attr);
+    } else {
+      it->second = attr.second;
+    }
   }
 }
 
-std::string ElementAttributes::ToString() {
-  std::string s;
-
-  for (auto& attr : attributes_) {
-    s += attr.first.ToStdString(ctx()) + "=";
-    s += "\"" + attr.second.ToStdString(ctx()) + "\"";
+void ElementAttributes::AdoptSharedAttributes(const SharedAttributeVector& attributes) {
+  assert(attributes_ == nullptr || attributes_->empty());
+  attributes_ = attributes;
+
+  for (auto& attr : *attributes) {
+    // Style attribute will be parsed and separated into multiple setStyle command.
+    if (attr.first == html_names::kStyleAttr)
+      continue;
+    std::unique_ptr<SharedNativeString> args_01 = attr.second.ToNativeString(ctx());
+    std::unique_ptr<SharedNativeString> args_02 = attr.first.ToNativeString(ctx());
+    GetExecutingContext()->uiCommandBuffer()->addCommand(UICommand::kSetAttribute, std::move(args_01),
+                                                         element_->bindingObject(), args_02.release());
   }
-
-  return s;
 }
 
 bool ElementAttributes::IsEquivalent(const ElementAttributes& other) const {
-  if (attributes_.size() != other.attributes_.size())
+  if (Attributes().size() != other.Attributes().size())
     return false;
-  for (auto& entry : attributes_) {
-    auto it = other.attributes_.find(entry.first);
-    if (it == other.attributes_.end()) {
+  for (auto& entry : Attributes()) {
+    if (FindAttribute(other.Attributes(), entry.first) == other.end()) {
       return false;
     }
   }
   return true;
 }
 
-std::unordered_map<AtomicString, AtomicString>::iterator ElementAttributes::begin() {
-  return attributes_.begin();
+ElementAttributes::AttributeVector::const_iterator ElementAttributes::begin() const {
+  return Attributes().begin();
+}
+
+ElementAttributes::AttributeVector::const_iterator ElementAttributes::end() const {
+  return Attributes().end();
 }
 
-std::unordered_map<AtomicString, AtomicString>::iterator ElementAttributes::end() {
-  return attributes_.end();
+const ElementAttributes::AttributeVector& ElementAttributes::Attributes() const {
+  static const AttributeVector empty_attributes;
+  return attributes_ != nullptr ? *attributes_ : empty_attributes;
+}
+
+ElementAttributes::AttributeVector& ElementAttributes::MutableAttributes() {
+  if (attributes_ == nullptr) {
+    attributes_ = std::make_shared<AttributeVector>();
+  } else if (attributes_.use_count() > 1) {
+    attributes_ = std::make_shared<AttributeVector>(*attributes_);
+  }
+  return *attributes_;
 }
 
 void ElementAttributes::Trace(GCVisitor* visitor) const {
@@ -6,7 +6,9 @@
 #ifndef BRIDGE_CORE_DOM_LEGACY_ELEMENT_ATTRIBUTES_H_
 #define BRIDGE_CORE_DOM_LEGACY_ELEMENT_ATTRIBUTES_H_
 
-#include <unordered_map>
+#include <memory>
+#include <utility>
+#include <vector>
 #include "bindings/qjs/atomic_string.h"
 #include "bindings/qjs/cppgc/member.h"
 #include "bindings/qjs/script_wrappable.h"
@@ -22,27 +24,40 @@ class ElementAttributes : public ScriptWrappable {
 
  public:
   using ImplType = ElementAttributes*;
+  using Attribute = std::pair<AtomicString, AtomicString>;
+  using AttributeVector = std::vector<Attribute>;
+  // Attributes are kept in a small vector in insertion order. The vector can be shared by several elements, e.g. the
+  // ones created by the parser with identical attributes and clones, and is copied by the first write to it.
+  using SharedAttributeVector = std::shared_ptr<AttributeVector>;
 
   static ElementAttributes* Create(Element* element) { return MakeGarbageCollected<ElementAttributes>(element); }
 
   explicit ElementAttributes(Element* element);
 
   AtomicString getAttribute(const AtomicString& name, ExceptionState& exception_state);
-  bool setAttribute(const AtomicString& name, const AtomicString& value, ExceptionState& exception_state);
+  // The value is sent to Dart unless |sync_to_dart| is false, when the caller sends the change in its own commands.
+  bool setAttribute(const AtomicString& name,
+                    const AtomicString& value,
+                    ExceptionState& exception_state,
+                    bool sync_to_dart = true);
   bool hasAttribute(const AtomicString& name, ExceptionState& exception_state);
   void removeAttribute(const AtomicString& name, ExceptionState& exception_state);
   void CopyWith(ElementAttributes* attributes);
-  std::string ToString();
+  // Adopts |attributes| for an element without attributes and sends them to Dart.
+  void AdoptSharedAttributes(const SharedAttributeVector& attributes);
 
   bool IsEquivalent(const ElementAttributes& other) const;
-  std::unordered_map<AtomicString, AtomicString>::iterator begin();
-  std::unordered_map<AtomicString, AtomicString>::iterator end();
+  AttributeVector::const_iterator begin() const;
+  AttributeVector::const_iterator end() const;
 
   void Trace(GCVisitor* visitor) const override;
 
  private:
+  const AttributeVector& Attributes() const;
+  AttributeVector& MutableAttributes();
+
   Member<Element> element_;
-  std::unordered_map<AtomicString, AtomicString, AtomicString::KeyHasher> attributes_;
+  SharedAttributeVector attributes_;
 };
 
 }  // namespace webf
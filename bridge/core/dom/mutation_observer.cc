@@ -41,65 +41,43 @@
 
 namespace webf {
 
-class MutationObserverAgent;
-
 static unsigned g_observer_priority = 0;
-static thread_local std::unordered_map<ExecutingContext*, std::shared_ptr<MutationObserverAgent>> agent_map_;
-
-class MutationObserverAgent {
- public:
-  MutationObserverAgent() = delete;
-  explicit MutationObserverAgent(ExecutingContext* context) : context_(context){};
 
-  static std::shared_ptr<MutationObserverAgent> From(ExecutingContext* context) {
-    if (agent_map_.count(context) == 0) {
-      agent_map_[context] = std::make_shared<MutationObserverAgent>(context);
-    }
-    return agent_map_[context];
-  }
-
-  void ActivateObserver(MutationObserver* observer) {
-    if (!isContextValid(context_->contextId()))
-      return;
+void MutationObserverAgent::ActivateObserver(MutationObserver* observer) {
+  if (!isContextValid(context_->contextId()))
+    return;
 
-    EnsureEnqueueMicrotask();
-    active_mutation_observers_.insert(observer);
-  }
+  EnsureEnqueueMicrotask();
+  active_mutation_observers_.insert(observer);
+}
 
- private:
-  void DeliverMutations() {
-    MemberMutationScope scopes{context_};
-    // These steps are defined in DOM Standard's "notify mutation observers".
-    // https://dom.spec.whatwg.org/#notify-mutation-observers
-    MutationObserverVector observers(active_mutation_observers_.begin(), active_mutation_observers_.end());
-    active_mutation_observers_.clear();
-    std::sort(observers.begin(), observers.end(), MutationObserver::ObserverLessThan());
-    for (const auto& observer : observers)
-      observer->Deliver();
-  }
+void MutationObserverAgent::DeliverMutations() {
+  MemberMutationScope scopes{context_};
+  // These steps are defined in DOM Standard's "notify mutation observers".
+  // https://dom.spec.whatwg.org/#notify-mutation-observers
+  MutationObserverVector observers(active_mutation_observers_.begin(), active_mutation_observers_.end());
+  active_mutation_observers_.clear();
+  std::sort(observers.begin(), observers.end(), MutationObserver::ObserverLessThan());
+  for (const auto& observer : observers)
+    observer->Deliver();
+}
 
-  void EnsureEnqueueMicrotask() {
-    if (active_mutation_observers_.empty() && context_->IsContextValid()) {
-      context_->EnqueueMicrotask(
-          [](void* p) {
-            auto* agent = static_cast<MutationObserverAgent*>(p);
-            agent->DeliverMutations();
-          },
-          this);
-    }
+void MutationObserverAgent::EnsureEnqueueMicrotask() {
+  if (active_mutation_observers_.empty() && context_->IsContextValid()) {
+    context_->EnqueueMicrotask(
+        [](void* p) {
+          auto* agent = static_cast<MutationObserverAgent*>(p);
+          agent->DeliverMutations();
+        },
+        this);
   }
-
-  MutationObserverSet active_mutation_observers_;
-  ExecutingContext* context_;
-};
+}
 
 static void ActivateObserver(MutationObserver* observer) {
   if (!observer->GetExecutingContext())
     return;
 
-  ExecutingContext* context = observer->GetExecutingContext();
-  auto agent = MutationObserverAgent::From(context);
-  agent->ActivateObserver(observer);
+  observer->GetExecutingContext()->EnsureMutationObserverAgent()->ActivateObserver(observer);
 }
 
 MutationObserver* MutationObserver::Create(ExecutingContext* context,
@@ -101,6 +101,22 @@ class MutationObserver final : public ScriptWrappable {
   unsigned priority_;
 };
 
+// Queues the delivery of the observers with pending records of one context, owned by the ExecutingContext.
+class MutationObserverAgent {
+ public:
+  MutationObserverAgent() = delete;
+  explicit MutationObserverAgent(ExecutingContext* context) : context_(context){};
+
+  void ActivateObserver(MutationObserver* observer);
+
+ private:
+  void DeliverMutations();
+  void EnsureEnqueueMicrotask();
+
+  MutationObserverSet active_mutation_observers_;
+  ExecutingContext* context_;
+};
+
 }  // namespace webf
 
 #endif  // WEBF_MUTATION_OBSERVER_H
@@ -44,6 +44,10 @@ std::shared_ptr<MutationObserverInterestGroup> MutationObserverInterestGroup::Cr
     MutationRecordDeliveryOptions old_value_flag,
     const AtomicString* attribute_name) {
   assert((type == kMutationTypeAttributes && attribute_name) || !attribute_name);
+  // Nodes outside of every observed subtree skip the walk over their ancestors' registries.
+  if (!(target.MutationObserverInterest() & type))
+    return nullptr;
+
   MutationObserverOptionsMap observers;
   target.GetRegisteredMutationObserversOfType(observers, type, attribute_name);
   if (observers.empty())
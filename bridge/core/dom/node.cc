@@ -39,6 +39,7 @@
 #include "document_fragment.h"
 #include "element.h"
 #include "empty_node_list.h"
+#include "foundation/native_type.h"
 #include "node_data.h"
 #include "node_traversal.h"
 #include "qjs_node.h"
@@ -165,6 +166,7 @@ void Node::RegisterMutationObserver(MutationObserver& observer,
   }
 
   GetDocument().AddMutationObserverTypes(registration->MutationTypes());
+  GetDocument().InvalidateMutationObserverInterest();
 }
 
 void Node::UnregisterMutationObserver(MutationObserverRegistration* registration) {
@@ -175,10 +177,12 @@ void Node::UnregisterMutationObserver(MutationObserverRegistration* registration
 
   registration->Dispose();
   EnsureNodeData().EnsureMutationObserverData().RemoveRegistration(registration);
+  GetDocument().InvalidateMutationObserverInterest();
 }
 
 void Node::RegisterTransientMutationObserver(MutationObserverRegistration* registration) {
   EnsureNodeData().EnsureMutationObserverData().AddTransientRegistration(registration);
+  GetDocument().InvalidateMutationObserverInterest();
 }
 
 void Node::UnregisterTransientMutationObserver(MutationObserverRegistration* registration) {
@@ -188,10 +192,11 @@ void Node::UnregisterTransientMutationObserver(MutationObserverRegistration* reg
     return;
 
   EnsureNodeData().EnsureMutationObserverData().RemoveTransientRegistration(registration);
+  GetDocument().InvalidateMutationObserverInterest();
 }
 
 void Node::NotifyMutationObserversNodeWillDetach() {
-  if (!GetDocument().HasMutationObservers())
+  if (!GetDocument().HasMutationObservers() || !MutationObserverInterest())
     return;
 
   ScriptForbiddenScope forbid_script_during_raw_iteration;
@@ -208,6 +213,36 @@ void Node::NotifyMutationObserversNodeWillDetach() {
   }
 }
 
+template <typename Registry>
+static inline MutationObserverOptions CollectMutationObserverInterest(Registry* registry, bool subtree_only) {
+  MutationObserverOptions types = 0;
+  if (!registry)
+    return types;
+  for (const auto& registration : *registry) {
+    if (!subtree_only || registration->IsSubtree())
+      types |= registration->MutationTypes();
+  }
+  return types;
+}
+
+MutationObserverOptions Node::MutationObserverInterest() {
+  Document& document = GetDocument();
+  if (mutation_observer_interest_generation_ == document.MutationObserverInterestGeneration())
+    return mutation_observer_interest_;
+
+  // Transient registrations are only added for subtree observers, they apply to the whole subtree too.
+  MutationObserverOptions types = CollectMutationObserverInterest(MutationObserverRegistry(), false) |
+                                  CollectMutationObserverInterest(TransientMutationObserverRegistry(), false);
+  for (Node* node = parentNode(); node; node = node->parentNode()) {
+    types |= CollectMutationObserverInterest(node->MutationObserverRegistry(), true) |
+             CollectMutationObserverInterest(node->TransientMutationObserverRegistry(), true);
+  }
+
+  mutation_observer_interest_ = types;
+  mutation_observer_interest_generation_ = document.MutationObserverInterestGeneration();
+  return types;
+}
+
 NodeData& Node::CreateNodeData() {
   node_data_ = std::make_unique<NodeData>();
   SetFlag(kHasDataFlag);
@@ -300,9 +335,32 @@ Node* Node::cloneNode(bool deep, ExceptionState&) const {
   // host is an HTML template element.
   auto* fragment = DynamicTo<DocumentFragment>(this);
   bool clone_shadows_flag = fragment && fragment->IsTemplateContent();
-  Node* new_node = Clone(GetDocument(),
-                         deep ? (clone_shadows_flag ? CloneChildrenFlag::kCloneWithShadows : CloneChildrenFlag::kClone)
-                              : CloneChildrenFlag::kSkip);
+  CloneChildrenFlag flag =
+      deep ? (clone_shadows_flag ? CloneChildrenFlag::kCloneWithShadows : CloneChildrenFlag::kClone)
+           : CloneChildrenFlag::kSkip;
+  if (!deep || !(IsElementNode() || IsDocumentFragment()))
+    return Clone(GetDocument(), flag);
+
+  // Deep clones, such as the instances of a template, are built by Dart from this subtree with a single command
+  // instead of one creation and one insertion per node.
+  auto* command_buffer = GetExecutingContext()->uiCommandBuffer();
+  Node* new_node;
+  {
+    UICommandBuffer::SkipNodeCommandsScope skip_node_commands(command_buffer->frontBuffer());
+    new_node = Clone(GetDocument(), flag);
+  }
+
+  // The clones are listed in tree order, which matches the order of the nodes they are cloned from.
+  NodeVector clones;
+  for (Node& node : NodeTraversal::InclusiveDescendantsOf(*new_node)) {
+    clones.emplace_back(&node);
+  }
+  auto** list = static_cast<NativeBindingObject**>(dart_malloc(sizeof(NativeBindingObject*) * (clones.size() + 1)));
+  for (size_t i = 0; i < clones.size(); i++) {
+    list[i] = clones[i]->bindingObject();
+  }
+  list[clones.size()] = nullptr;
+  command_buffer->addCommand(UICommand::kCloneNodes, nullptr, bindingObject(), list);
   return new_node;
 }
 
@@ -248,6 +248,9 @@ class Node : public EventTarget {
   void RegisterTransientMutationObserver(MutationObserverRegistration*);
   void UnregisterTransientMutationObserver(MutationObserverRegistration*);
   void NotifyMutationObserversNodeWillDetach();
+  // The mutation types observed on this node, by its own registrations and the subtree registrations of its
+  // ancestors. The attribute filters are not applied.
+  MutationObserverOptions MutationObserverInterest();
 
   NodeData& CreateNodeData();
   [[nodiscard]] bool HasNodeData() const { return GetFlag(kHasDataFlag); }
@@ -346,6 +349,8 @@ class Node : public EventTarget {
 
  private:
   uint32_t node_flags_;
+  uint32_t mutation_observer_interest_generation_{0};
+  MutationObserverOptions mutation_observer_interest_{0};
   Member<Node> parent_or_shadow_host_node_;
   Member<Node> previous_;
   Member<Node> next_;
@@ -3,6 +3,8 @@
  * Copyright (C) 2022-present The WebF authors. All rights reserved.
  */
 
+#include "core/dom/element.h"
+#include "foundation/native_type.h"
 #include "gtest/gtest.h"
 #include "webf_test_env.h"
 
@@ -121,6 +123,80 @@ TEST(Node, childNodes) {
   EXPECT_EQ(logCalled, true);
 }
 
+TEST(Node, childNodesIndexedAccess) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    EXPECT_STREQ(message.c_str(), "1000 500 1001 1000 0 999 1000 500 999 10");
+    logCalled = true;
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) { errorCalled = true; });
+  const char* code = R"(
+const list = document.createElement('div');
+for (let i = 0; i < 1000; i++) {
+  const item = document.createElement('div');
+  item.id = String(i);
+  list.appendChild(item);
+}
+const nodes = list.childNodes;
+const length = nodes.length;
+const middle = nodes[500].id;
+const last = document.createElement('div');
+last.id = '1000';
+list.appendChild(last);
+const appendedLength = nodes.length;
+const appended = nodes[1000].id;
+list.insertBefore(nodes[999], nodes[0]);
+const moved = nodes[0].id;
+const shifted = nodes[1].id;
+list.removeChild(last);
+const afterRemove = nodes.length;
+list.removeChild(nodes[0]);
+console.log(length, middle, appendedLength, appended, shifted, moved, afterRemove, nodes[500].id, nodes.length, list.children[10].id);
+)";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(Node, mutationObserverInterestFollowsMoves) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    EXPECT_STREQ(message.c_str(), "attributes:a childList attributes:c childList attributes:d");
+    logCalled = true;
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) { errorCalled = true; });
+  auto context = env->page()->executingContext();
+  const char* code = R"(
+const observed = document.createElement('div');
+const outside = document.createElement('div');
+document.body.appendChild(observed);
+document.body.appendChild(outside);
+const child = document.createElement('span');
+outside.appendChild(child);
+child.setAttribute('id', 'before');
+
+const observer = new MutationObserver((records) => {
+  console.log(records.map((record) => record.type + (record.attributeName ? ':' + record.attributeName : '')).join(' '));
+});
+observer.observe(observed, { attributes: true, childList: true, subtree: true });
+
+child.setAttribute('b', '');
+observed.setAttribute('a', '');
+observed.appendChild(child);
+child.setAttribute('c', '');
+outside.appendChild(child);
+child.setAttribute('d', '');
+)";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  TEST_runLoop(context);
+
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
 TEST(Node, textNodeHaveEmptyChildNodes) {
   bool static errorCalled = false;
   bool static logCalled = false;
@@ -367,4 +443,190 @@ console.assert(el.isConnected == false);
 
   EXPECT_EQ(errorCalled, false);
   EXPECT_EQ(logCalled, false);
-}
\ No newline at end of file
+}
+TEST(Node, insertNodesAsOneCommand) {
+  bool static errorCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {};
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto context = env->page()->executingContext();
+  const char* code = R"(
+const fragment = document.createDocumentFragment();
+fragment.appendChild(document.createElement('div'));
+fragment.appendChild(document.createTextNode('text'));
+fragment.appendChild(document.createElement('span'));
+document.body.appendChild(fragment);
+)";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+
+  auto* buffer = static_cast<UICommandItem*>(context->uiCommandBuffer()->data());
+  size_t command_size = context->uiCommandBuffer()->size();
+  int insert_nodes_count = 0;
+  for (size_t i = 0; i < command_size; i++) {
+    UICommandItem& item = buffer[i];
+    if (item.type != static_cast<int32_t>(UICommand::kInsertAdjacentNodes))
+      continue;
+    insert_nodes_count++;
+    EXPECT_EQ(item.args_01_length, static_cast<int32_t>(AdjacentPosition::kBeforeEnd));
+    EXPECT_EQ(reinterpret_cast<void*>(item.nativePtr), context->document()->body()->bindingObject());
+    auto** list = reinterpret_cast<NativeBindingObject**>(item.nativePtr2);
+    int length = 0;
+    while (list[length] != nullptr)
+      length++;
+    EXPECT_EQ(length, 3);
+    dart_free(list);
+  }
+  EXPECT_EQ(insert_nodes_count, 1);
+}
+
+TEST(Node, removeChildrenAsOneCommand) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    EXPECT_STREQ(message.c_str(), "0 null null");
+    logCalled = true;
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto context = env->page()->executingContext();
+  const char* code = R"(
+const div = document.createElement('div');
+for (let i = 0; i < 10; i++) div.appendChild(document.createElement('span'));
+document.body.appendChild(div);
+div.innerHTML = '';
+console.log(div.childNodes.length, div.firstChild, div.lastChild);
+)";
+  context->uiCommandBuffer()->clear();
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+
+  auto* buffer = static_cast<UICommandItem*>(context->uiCommandBuffer()->data());
+  size_t command_size = context->uiCommandBuffer()->size();
+  int remove_node_count = 0;
+  int remove_all_children_count = 0;
+  for (size_t i = 0; i < command_size; i++) {
+    if (buffer[i].type == static_cast<int32_t>(UICommand::kRemoveNode))
+      remove_node_count++;
+    if (buffer[i].type == static_cast<int32_t>(UICommand::kRemoveAllChildren))
+      remove_all_children_count++;
+  }
+  EXPECT_EQ(remove_node_count, 0);
+  EXPECT_EQ(remove_all_children_count, 1);
+}
+
+TEST(Node, deepCloneAsOneCommand) {
+  bool static errorCalled = false;
+  bool static logCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    EXPECT_STREQ(message.c_str(), "<li class=\"item\"><span>a</span>b</li> true");
+    logCalled = true;
+  };
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto context = env->page()->executingContext();
+  const char* code = R"(
+const template = document.createElement('template');
+template.innerHTML = '<li class="item"><span>a</span>b</li>';
+globalThis.clone = template.content.cloneNode(true);
+)";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  context->uiCommandBuffer()->clear();
+  const char* clone_code = R"(
+const li = clone.firstChild;
+console.log(li.outerHTML, li.firstChild.parentNode === li);
+)";
+  const char* deep_clone_code = "globalThis.clone = clone.cloneNode(true);";
+  env->page()->evaluateScript(deep_clone_code, strlen(deep_clone_code), "vm://", 0);
+
+  auto* buffer = static_cast<UICommandItem*>(context->uiCommandBuffer()->data());
+  size_t command_size = context->uiCommandBuffer()->size();
+  int clone_nodes_count = 0;
+  for (size_t i = 0; i < command_size; i++) {
+    UICommandItem& item = buffer[i];
+    EXPECT_NE(GetKindFromUICommand(static_cast<UICommand>(item.type)), UICommandKind::kNodeMutation);
+    if (item.type == static_cast<int32_t>(UICommand::kCreateElement) ||
+        item.type == static_cast<int32_t>(UICommand::kCreateTextNode))
+      ADD_FAILURE() << "The clones should be created by the kCloneNodes command.";
+    if (item.type != static_cast<int32_t>(UICommand::kCloneNodes))
+      continue;
+    clone_nodes_count++;
+    // The fragment, li, span and the two text nodes.
+    auto** list = reinterpret_cast<NativeBindingObject**>(item.nativePtr2);
+    int length = 0;
+    while (list[length] != nullptr)
+      length++;
+    EXPECT_EQ(length, 5);
+    dart_free(list);
+  }
+  EXPECT_EQ(clone_nodes_count, 1);
+
+  env->page()->evaluateScript(clone_code, strlen(clone_code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+  EXPECT_EQ(logCalled, true);
+}
+
+TEST(Node, coalesceTextDataUpdates) {
+  bool static errorCalled = false;
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {};
+  auto env = TEST_init([](double contextId, const char* errmsg) {
+    WEBF_LOG(VERBOSE) << errmsg;
+    errorCalled = true;
+  });
+  auto context = env->page()->executingContext();
+  const char* code = "globalThis.counter = document.createTextNode('0'); document.body.appendChild(counter);";
+  env->page()->evaluateScript(code, strlen(code), "vm://", 0);
+  context->uiCommandBuffer()->clear();
+
+  const char* update_code = R"(
+for (let i = 1; i <= 100; i++) counter.data = String(i);
+const copy = counter.cloneNode();
+counter.data = 'before clone';
+counter.data = 'after clone';
+)";
+  env->page()->evaluateScript(update_code, strlen(update_code), "vm://", 0);
+  EXPECT_EQ(errorCalled, false);
+
+  auto* buffer = static_cast<UICommandItem*>(context->uiCommandBuffer()->data());
+  size_t command_size = context->uiCommandBuffer()->size();
+  std::vector<std::string> values;
+  for (size_t i = 0; i < command_size; i++) {
+    UICommandItem& item = buffer[i];
+    if ((item.type & ~UI_COMMAND_ONE_BYTE_ARGS_FLAG) != static_cast<int32_t>(UICommand::kSetTextData))
+      continue;
+    EXPECT_NE(item.type & UI_COMMAND_ONE_BYTE_ARGS_FLAG, 0);
+    values.emplace_back(reinterpret_cast<const char*>(item.string_01), item.args_01_length);
+  }
+  // The updates before the clone are sent apart from the ones after it, which the clone must not see.
+  ASSERT_EQ(values.size(), 2);
+  EXPECT_EQ(values[0], "100");
+  EXPECT_EQ(values[1], "after clone");
+}
+
+TEST(Node, clearedMemberIsReleasedAtTheEndOfMutationScope) {
+  bool static errorCalled = false;
+  auto env = TEST_init([](double contextId, const char* errmsg) { errorCalled = true; });
+  auto context = env->page()->executingContext();
+  const char* code = "document.createElement('div')";
+  JSValue value = JS_Eval(context->ctx(), code, strlen(code), "vm://", JS_EVAL_TYPE_GLOBAL);
+  auto* element = toScriptWrappable<Element>(value);
+  auto* header = static_cast<JSRefCountHeader*>(JS_VALUE_GET_PTR(value));
+  int ref_count = header->ref_count;
+  {
+    MemberMutationScope scope{context};
+    Member<Element> member = element;
+    member.Clear();
+    // The last reference outside of the scope goes away in the middle of the mutation.
+    JS_FreeValue(context->ctx(), value);
+    EXPECT_EQ(header->ref_count, ref_count);
+    EXPECT_EQ(element->localName().ToStdString(context->ctx()), "div");
+  }
+  EXPECT_EQ(errorCalled, false);
+}
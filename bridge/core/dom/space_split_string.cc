@@ -48,7 +48,7 @@
 
 #include "space_split_string.h"
 #include <set>
-#include <sstream>
+#include "bindings/qjs/qjs_engine_patch.h"
 #include "built_in_string.h"
 
 namespace webf {
@@ -58,7 +58,15 @@ void SpaceSplitString::Set(JSContext* ctx, const AtomicString& value) {
     Clear();
     return;
   }
-  data_ = std::make_unique<Data>(ctx, value);
+  auto& shared_data_map = SharedDataMap();
+  auto it = shared_data_map.find(value.Impl());
+  if (it != shared_data_map.end()) {
+    data_ = it->second.lock();
+    assert(data_ != nullptr);
+    return;
+  }
+  data_ = std::make_shared<Data>(ctx, value);
+  shared_data_map[value.Impl()] = data_;
 }
 
 void SpaceSplitString::Clear() {
@@ -68,12 +76,12 @@ void SpaceSplitString::Clear() {
 void SpaceSplitString::Add(JSContext* ctx, const AtomicString& string) {
   if (Contains(string))
     return;
-  EnsureUnique();
-  if (data_) {
-    data_->Add(string);
-  } else {
-    data_ = std::make_unique<Data>(ctx, string);
+  if (!data_) {
+    Set(ctx, string);
+    return;
   }
+  EnsureUnique();
+  data_->Add(string);
 }
 
 bool SpaceSplitString::Remove(const AtomicString& string) {
@@ -103,7 +111,7 @@ void SpaceSplitString::Remove(size_t index) {
 void SpaceSplitString::ReplaceAt(size_t index, const AtomicString& string) {
   assert(index < data_->size());
   EnsureUnique();
-  (*data_)[index] = string;
+  data_->ReplaceAt(index, string);
 }
 
 AtomicString SpaceSplitString::SerializeToString(JSContext* ctx) const {
@@ -113,14 +121,14 @@ AtomicString SpaceSplitString::SerializeToString(JSContext* ctx) const {
   if (size == 1)
     return (*data_)[0];
 
-  std::stringstream ss;
-  ss << (*data_)[0].Character8();
+  // The tokens are joined as UTF-8, which also covers the two byte strings and the tokens interned as integers.
+  std::string result = (*data_)[0].ToStdString(ctx);
   for (size_t i = 1; i < size; ++i) {
-    ss << " ";
-    ss << (*data_)[i].Character8();
+    result += ' ';
+    result += (*data_)[i].ToStdString(ctx);
   }
 
-  return {ctx, ss.str()};
+  return {ctx, result};
 }
 
 template <typename CharacterType>
@@ -169,9 +177,20 @@ inline void SpaceSplitString::Data::CreateVector(JSContext* ctx,
 SpaceSplitString::Data::Data(JSContext* ctx, const AtomicString& string) : key_string_(string) {
   assert(!string.IsNull());
   CreateVector(ctx, string);
+  UpdateTokenSet();
 }
 
-SpaceSplitString::Data::Data(const Data& other) : vector_(other.vector_) {}
+SpaceSplitString::Data::Data(const Data& other) : vector_(other.vector_), token_set_(other.token_set_) {}
+
+SpaceSplitString::Data::~Data() {
+  if (IsUnique())
+    return;
+  // A list created for the same key after this one expired may have taken its place.
+  auto& shared_data_map = SharedDataMap();
+  auto it = shared_data_map.find(key_string_.Impl());
+  if (it != shared_data_map.end() && it->second.expired())
+    shared_data_map.erase(it);
+}
 
 bool SpaceSplitString::Data::ContainsAll(Data& other) {
   if (this == &other)
@@ -195,13 +214,42 @@ bool SpaceSplitString::Data::ContainsAll(Data& other) {
 void SpaceSplitString::Data::Add(const AtomicString& string) {
   assert(!Contains(string));
   vector_.push_back(string);
+  if (token_set_.empty()) {
+    UpdateTokenSet();
+  } else {
+    token_set_.insert(string.Impl());
+  }
 }
 
 void SpaceSplitString::Data::Remove(unsigned int index) {
+  if (!token_set_.empty())
+    token_set_.erase(token_set_.find(vector_[index].Impl()));
   vector_.erase(vector_.begin() + index);
 }
 
+// replace() can leave a token twice in the list before it removes the second one, so the set counts the tokens.
+void SpaceSplitString::Data::ReplaceAt(unsigned int index, const AtomicString& string) {
+  if (!token_set_.empty()) {
+    token_set_.erase(token_set_.find(vector_[index].Impl()));
+    token_set_.insert(string.Impl());
+  }
+  vector_[index] = string;
+}
+
+void SpaceSplitString::Data::UpdateTokenSet() {
+  if (vector_.size() <= kMaxLinearSearchSize || !token_set_.empty())
+    return;
+  for (const auto& token : vector_)
+    token_set_.insert(token.Impl());
+}
+
 void SpaceSplitString::Data::CreateVector(JSContext* ctx, const AtomicString& string) {
+  // A number is interned as an integer atom without characters, it is a single token.
+  if (JS_AtomIsTaggedInt(string.Impl())) {
+    vector_.push_back(string);
+    return;
+  }
+
   unsigned length = string.length();
   if (string.Is8Bit()) {
     CreateVector<char>(ctx, string, reinterpret_cast<const char*>(string.Character8()), length);
@@ -211,8 +259,8 @@ void SpaceSplitString::Data::CreateVector(JSContext* ctx, const AtomicString& st
   CreateVector<uint16_t>(ctx, string, string.Character16(), length);
 }
 
-std::unordered_map<JSAtom, SpaceSplitString::Data*>& SpaceSplitString::SharedDataMap() {
-  thread_local static std::unordered_map<JSAtom, SpaceSplitString::Data*> map;
+std::unordered_map<JSAtom, std::weak_ptr<SpaceSplitString::Data>>& SpaceSplitString::SharedDataMap() {
+  thread_local static std::unordered_map<JSAtom, std::weak_ptr<SpaceSplitString::Data>> map;
   return map;
 }
 
@@ -5,7 +5,9 @@
 #ifndef WEBF_CORE_DOM_SPACE_SPLIT_STRING_H_
 #define WEBF_CORE_DOM_SPACE_SPLIT_STRING_H_
 
+#include <memory>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 #include "bindings/qjs/atomic_string.h"
 
@@ -33,6 +35,8 @@ inline bool IsNotHTMLSpace(CharType character) {
   return !IsHTMLSpace<CharType>(character);
 }
 
+// The tokens of a whitespace separated string, such as the class attribute. The tokens parsed from the same string
+// are shared by all the SpaceSplitStrings set to it, and copied by the first change made through one of them.
 class SpaceSplitString {
  public:
   SpaceSplitString() = default;
@@ -69,37 +73,46 @@ class SpaceSplitString {
    public:
     explicit Data(JSContext* ctx, const AtomicString&);
     explicit Data(const Data&);
+    ~Data();
     bool Contains(const AtomicString& string) const {
-      return std::find(vector_.begin(), vector_.end(), string) != vector_.end();
+      if (token_set_.empty())
+        return std::find(vector_.begin(), vector_.end(), string) != vector_.end();
+      return token_set_.find(string.Impl()) != token_set_.end();
     }
 
     bool ContainsAll(Data&);
 
     void Add(const AtomicString&);
     void Remove(unsigned index);
+    void ReplaceAt(unsigned index, const AtomicString&);
 
+    // The data parsed from a string is shared by its key string, and must not be changed.
     bool IsUnique() const { return key_string_.IsNull(); }
     size_t size() const { return vector_.size(); }
     const AtomicString& operator[](size_t i) const { return vector_[i]; }
-    AtomicString& operator[](size_t i) { return vector_[i]; }
 
    private:
+    // Longer lists are searched in |token_set_| instead of |vector_|.
+    static constexpr size_t kMaxLinearSearchSize = 8;
+
     void CreateVector(JSContext* ctx, const AtomicString&);
     template <typename CharacterType>
     inline void CreateVector(JSContext* ctx, const AtomicString&, const CharacterType*, unsigned);
+    void UpdateTokenSet();
 
     AtomicString key_string_;
     std::vector<AtomicString> vector_;
+    std::unordered_multiset<JSAtom> token_set_;
   };
 
-  static std::unordered_map<JSAtom, Data*>& SharedDataMap();
+  static std::unordered_map<JSAtom, std::weak_ptr<Data>>& SharedDataMap();
   void EnsureUnique() {
-    if (data_ != nullptr) {
-      data_ = std::make_unique<Data>(*data_);
+    if (data_ != nullptr && (!data_->IsUnique() || data_.use_count() > 1)) {
+      data_ = std::make_shared<Data>(*data_);
     }
   }
 
-  std::unique_ptr<Data> data_ = nullptr;
+  std::shared_ptr<Data> data_ = nullptr;
 };
 
 }  // namespace webf
@@ -0,0 +1,5 @@
+// @ts-ignore
+@Dictionary()
+export interface TextDecodeOptions {
+  stream?: boolean;
+}
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "text_decoder.h"
+#include <algorithm>
+#include "bindings/qjs/qjs_engine_patch.h"
+#include "core/executing_context.h"
+
+namespace webf {
+
+namespace {
+
+// https://encoding.spec.whatwg.org/#concept-encoding-get
+bool IsUTF8Label(std::string label) {
+  auto is_whitespace = [](char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\f' || c == '\r'; };
+  label.erase(label.begin(), std::find_if_not(label.begin(), label.end(), is_whitespace));
+  label.erase(std::find_if_not(label.rbegin(), label.rend(), is_whitespace).base(), label.end());
+  std::transform(label.begin(), label.end(), label.begin(),
+                 [](char c) { return c >= 'A' && c <= 'Z' ? c + ('a' - 'A') : c; });
+  static const char* const kUTF8Labels[] = {"unicode-1-1-utf-8", "unicode11utf8", "unicode20utf8",
+                                            "utf-8",             "utf8",          "x-unicode20utf8"};
+  return std::any_of(std::begin(kUTF8Labels), std::end(kUTF8Labels),
+                     [&](const char* utf8_label) { return label == utf8_label; });
+}
+
+// The length of the truncated, but so far well-formed, UTF-8 sequence ending data[0..length), which the next chunk
+// of a stream can complete.
+size_t IncompleteSequenceLength(const uint8_t* data, size_t length) {
+  for (size_t k = 1; k <= 3 && k <= length; k++) {
+    uint8_t lead = data[length - k];
+    if (lead < 0x80)
+      return 0;
+    // A continuation byte.
+    if (lead < 0xc0)
+      continue;
+    size_t sequence_length = lead >= 0xf0 ? 4 : lead >= 0xe0 ? 3 : 2;
+    if (lead < 0xc2 || lead > 0xf4 || sequence_length <= k)
+      return 0;
+    if (k == 1)
+      return 1;
+    // The range of the second byte depends on the lead byte, the others are always 0x80 to 0xbf.
+    uint8_t second = data[length - k + 1];
+    uint8_t lower = lead == 0xe0 ? 0xa0 : lead == 0xf0 ? 0x90 : 0x80;
+    uint8_t upper = lead == 0xed ? 0x9f : lead == 0xf4 ? 0x8f : 0xbf;
+    return second >= lower && second <= upper ? k : 0;
+  }
+  return 0;
+}
+
+}  // namespace
+
+TextDecoder* TextDecoder::Create(ExecutingContext* context, ExceptionState& exception_state) {
+  return MakeGarbageCollected<TextDecoder>(context, false, false);
+}
+
+TextDecoder* TextDecoder::Create(ExecutingContext* context,
+                                 const AtomicString& label,
+                                 ExceptionState& exception_state) {
+  return Create(context, label, nullptr, exception_state);
+}
+
+TextDecoder* TextDecoder::Create(ExecutingContext* context,
+                                 const AtomicString& label,
+                                 const std::shared_ptr<TextDecoderOptions>& options,
+                                 ExceptionState& exception_state) {
+  std::string label_string = label.ToStdString(context->ctx());
+  if (!IsUTF8Label(label_string)) {
+    exception_state.ThrowException(
+        context->ctx(), ErrorType::RangeError,
+        "Failed to construct 'TextDecoder': The encoding label provided ('" + label_string + "') is invalid.");
+    return nullptr;
+  }
+  bool fatal = options != nullptr && options->hasFatal() && options->fatal();
+  bool ignore_bom = options != nullptr && options->hasIgnoreBOM() && options->ignoreBOM();
+  return MakeGarbageCollected<TextDecoder>(context, fatal, ignore_bom);
+}
+
+TextDecoder::TextDecoder(ExecutingContext* context, bool fatal, bool ignore_bom)
+    : ScriptWrappable(context->ctx()), fatal_(fatal), ignore_bom_(ignore_bom) {}
+
+AtomicString TextDecoder::encoding() const {
+  return AtomicString(ctx(), "utf-8");
+}
+
+ScriptValue TextDecoder::decode(ExceptionState& exception_state) {
+  return decode(ScriptValue::Undefined(ctx()), nullptr, exception_state);
+}
+
+ScriptValue TextDecoder::decode(const ScriptValue& input, ExceptionState& exception_state) {
+  return decode(input, nullptr, exception_state);
+}
+
+ScriptValue TextDecoder::decode(const ScriptValue& input,
+                                const std::shared_ptr<TextDecodeOptions>& options,
+                                ExceptionState& exception_state) {
+  uint8_t* data = nullptr;
+  size_t length = 0;
+  if (!JS_IsUndefined(input.QJSValue()) &&
+      JS_GetBufferSourceBytes(ctx(), &data, &length, input.QJSValue()) < 0) {
+    JS_FreeValue(ctx(), JS_GetException(ctx()));
+    exception_state.ThrowException(ctx(), ErrorType::TypeError,
+                                   "Failed to execute 'decode' on 'TextDecoder': The provided value is not of type "
+                                   "'(ArrayBuffer or ArrayBufferView)'.");
+    return ScriptValue::Empty(ctx());
+  }
+  bool stream = options != nullptr && options->hasStream() && options->stream();
+
+  if (pending_.empty())
+    return Decode(data, length, stream, exception_state);
+
+  // The previous chunk ended in the middle of a code point. Only then the chunk is copied, to decode it in one piece.
+  std::vector<uint8_t> buffer = std::move(pending_);
+  pending_.clear();
+  buffer.insert(buffer.end(), data, data + length);
+  return Decode(buffer.data(), buffer.size(), stream, exception_state);
+}
+
+// https://encoding.spec.whatwg.org/#dom-textdecoder-decode
+ScriptValue TextDecoder::Decode(const uint8_t* data, size_t length, bool stream, ExceptionState& exception_state) {
+  size_t end = length - (stream ? IncompleteSequenceLength(data, length) : 0);
+  size_t start = 0;
+  if (!bom_seen_ && end > 0) {
+    bom_seen_ = true;
+    if (!ignore_bom_ && end >= 3 && data[0] == 0xef && data[1] == 0xbb && data[2] == 0xbf)
+      start = 3;
+  }
+
+  JSValue string = JS_NewStringFromUTF8(ctx(), data + start, end - start, fatal_);
+  if (stream) {
+    pending_.assign(data + end, data + length);
+  } else {
+    bom_seen_ = false;
+  }
+
+  if (JS_IsException(string)) {
+    JSValue exception = JS_GetException(ctx());
+    exception_state.ThrowException(ctx(), exception);
+    JS_FreeValue(ctx(), exception);
+    return ScriptValue::Empty(ctx());
+  }
+  if (JS_IsNull(string)) {
+    pending_.clear();
+    bom_seen_ = false;
+    exception_state.ThrowException(ctx(), ErrorType::TypeError,
+                                   "Failed to execute 'decode' on 'TextDecoder': The encoded data was not valid.");
+    return ScriptValue::Empty(ctx());
+  }
+  ScriptValue result(ctx(), string);
+  JS_FreeValue(ctx(), string);
+  return result;
+}
+
+}  // namespace webf
@@ -0,0 +1,11 @@
+import {TextDecoderOptions} from "./text_decoder_options";
+import {TextDecodeOptions} from "./text_decode_options";
+
+export interface TextDecoder {
+  readonly encoding: string;
+  readonly fatal: boolean;
+  readonly ignoreBOM: boolean;
+  // Returns a string, created from the bytes without being interned as an AtomicString.
+  decode(input?: any, options?: TextDecodeOptions): any;
+  new(label?: string, options?: TextDecoderOptions): TextDecoder;
+}
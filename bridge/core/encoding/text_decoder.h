@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef WEBF_CORE_ENCODING_TEXT_DECODER_H_
+#define WEBF_CORE_ENCODING_TEXT_DECODER_H_
+
+#include <vector>
+#include "bindings/qjs/atomic_string.h"
+#include "bindings/qjs/exception_state.h"
+#include "bindings/qjs/script_value.h"
+#include "bindings/qjs/script_wrappable.h"
+#include "qjs_text_decode_options.h"
+#include "qjs_text_decoder_options.h"
+
+namespace webf {
+
+// https://encoding.spec.whatwg.org/#interface-textdecoder
+// Only UTF-8 is supported. The bytes are decoded straight from the ArrayBuffer into the QuickJS string storage.
+class TextDecoder : public ScriptWrappable {
+  DEFINE_WRAPPERTYPEINFO();
+
+ public:
+  using ImplType = TextDecoder*;
+
+  static TextDecoder* Create(ExecutingContext* context, ExceptionState& exception_state);
+  static TextDecoder* Create(ExecutingContext* context, const AtomicString& label, ExceptionState& exception_state);
+  static TextDecoder* Create(ExecutingContext* context,
+                             const AtomicString& label,
+                             const std::shared_ptr<TextDecoderOptions>& options,
+                             ExceptionState& exception_state);
+
+  TextDecoder() = delete;
+  explicit TextDecoder(ExecutingContext* context, bool fatal, bool ignore_bom);
+
+  AtomicString encoding() const;
+  bool fatal() const { return fatal_; }
+  bool ignoreBOM() const { return ignore_bom_; }
+
+  ScriptValue decode(ExceptionState& exception_state);
+  ScriptValue decode(const ScriptValue& input, ExceptionState& exception_state);
+  ScriptValue decode(const ScriptValue& input,
+                     const std::shared_ptr<TextDecodeOptions>& options,
+                     ExceptionState& exception_state);
+
+ private:
+  ScriptValue Decode(const uint8_t* data, size_t length, bool stream, ExceptionState& exception_state);
+
+  bool fatal_;
+  bool ignore_bom_;
+  bool bom_seen_{false};
+  // The bytes of a code point split across two chunks of a stream, at most 3.
+  std::vector<uint8_t> pending_;
+};
+
+}  // namespace webf
+
+#endif  // WEBF_CORE_ENCODING_TEXT_DECODER_H_
@@ -0,0 +1,6 @@
+// @ts-ignore
+@Dictionary()
+export interface TextDecoderOptions {
+  fatal?: boolean;
+  ignoreBOM?: boolean;
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "text_encoder.h"
+#include "bindings/qjs/qjs_engine_patch.h"
+#include "core/executing_context.h"
+
+namespace webf {
+
+TextEncoder* TextEncoder::Create(ExecutingContext* context, ExceptionState& exception_state) {
+  return MakeGarbageCollected<TextEncoder>(context);
+}
+
+TextEncoder::TextEncoder(ExecutingContext* context) : ScriptWrappable(context->ctx()) {}
+
+AtomicString TextEncoder::encoding() const {
+  return AtomicString(ctx(), "utf-8");
+}
+
+ScriptValue TextEncoder::encode(ExceptionState& exception_state) {
+  uint8_t* data;
+  JSValue array = JS_NewUint8Array(ctx(), 0, &data);
+  ScriptValue result(ctx(), array);
+  JS_FreeValue(ctx(), array);
+  return result;
+}
+
+ScriptValue TextEncoder::encode(const ScriptValue& input, ExceptionState& exception_state) {
+  if (JS_IsUndefined(input.QJSValue()))
+    return encode(exception_state);
+
+  JSValue string = JS_ToString(ctx(), input.QJSValue());
+  if (JS_IsException(string)) {
+    JSValue exception = JS_GetException(ctx());
+    exception_state.ThrowException(ctx(), exception);
+    JS_FreeValue(ctx(), exception);
+    return ScriptValue::Empty(ctx());
+  }
+
+  // Sizing the output first costs a scan of the string, but hands out an exactly sized buffer without a copy.
+  size_t length = JS_StringUTF8Length(string);
+  uint8_t* data;
+  JSValue array = JS_NewUint8Array(ctx(), length, &data);
+  if (JS_IsException(array)) {
+    JS_FreeValue(ctx(), string);
+    JSValue exception = JS_GetException(ctx());
+    exception_state.ThrowException(ctx(), exception);
+    JS_FreeValue(ctx(), exception);
+    return ScriptValue::Empty(ctx());
+  }
+  size_t read;
+  JS_EncodeStringUTF8(string, data, length, &read);
+  JS_FreeValue(ctx(), string);
+
+  ScriptValue result(ctx(), array);
+  JS_FreeValue(ctx(), array);
+  return result;
+}
+
+ScriptValue TextEncoder::encodeInto(const ScriptValue& source,
+                                    const ScriptValue& destination,
+                                    ExceptionState& exception_state) {
+  if (JSValueGetClassId(destination.QJSValue()) != JS_CLASS_UINT8_ARRAY) {
+    exception_state.ThrowException(ctx(), ErrorType::TypeError,
+                                   "Failed to execute 'encodeInto' on 'TextEncoder': parameter 2 is not of type "
+                                   "'Uint8Array'.");
+    return ScriptValue::Empty(ctx());
+  }
+
+  JSValue string = JS_ToString(ctx(), source.QJSValue());
+  if (JS_IsException(string)) {
+    JSValue exception = JS_GetException(ctx());
+    exception_state.ThrowException(ctx(), exception);
+    JS_FreeValue(ctx(), exception);
+    return ScriptValue::Empty(ctx());
+  }
+
+  // The destination is read after the source is converted, its buffer may be detached by a toString() call.
+  uint8_t* data;
+  size_t capacity;
+  JS_GetBufferSourceBytes(ctx(), &data, &capacity, destination.QJSValue());
+  size_t read = 0;
+  size_t written = data != nullptr ? JS_EncodeStringUTF8(string, data, capacity, &read) : 0;
+  JS_FreeValue(ctx(), string);
+
+  JSValue object = JS_NewObject(ctx());
+  JS_SetPropertyStr(ctx(), object, "read", JS_NewInt64(ctx(), static_cast<int64_t>(read)));
+  JS_SetPropertyStr(ctx(), object, "written", JS_NewInt64(ctx(), static_cast<int64_t>(written)));
+  ScriptValue result(ctx(), object);
+  JS_FreeValue(ctx(), object);
+  return result;
+}
+
+}  // namespace webf
@@ -0,0 +1,7 @@
+export interface TextEncoder {
+  readonly encoding: string;
+  // The input is read from the JS string directly instead of being converted to an AtomicString, which would intern it.
+  encode(input?: any): any;
+  encodeInto(source: any, destination: any): any;
+  new(): TextEncoder;
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef WEBF_CORE_ENCODING_TEXT_ENCODER_H_
+#define WEBF_CORE_ENCODING_TEXT_ENCODER_H_
+
+#include "bindings/qjs/atomic_string.h"
+#include "bindings/qjs/exception_state.h"
+#include "bindings/qjs/script_value.h"
+#include "bindings/qjs/script_wrappable.h"
+
+namespace webf {
+
+// https://encoding.spec.whatwg.org/#interface-textencoder
+// The strings are encoded from the QuickJS string storage, without an intermediate copy.
+class TextEncoder : public ScriptWrappable {
+  DEFINE_WRAPPERTYPEINFO();
+
+ public:
+  using ImplType = TextEncoder*;
+
+  static TextEncoder* Create(ExecutingContext* context, ExceptionState& exception_state);
+
+  TextEncoder() = delete;
+  explicit TextEncoder(ExecutingContext* context);
+
+  AtomicString encoding() const;
+  ScriptValue encode(ExceptionState& exception_state);
+  ScriptValue encode(const ScriptValue& input, ExceptionState& exception_state);
+  ScriptValue encodeInto(const ScriptValue& source, const ScriptValue& destination, ExceptionState& exception_state);
+};
+
+}  // namespace webf
+
+#endif  // WEBF_CORE_ENCODING_TEXT_ENCODER_H_
@@ -117,6 +117,12 @@ ExecutingContext::~ExecutingContext() {
   }
 }
 
+MutationObserverAgent* ExecutingContext::EnsureMutationObserverAgent() {
+  if (mutation_observer_agent_ == nullptr)
+    mutation_observer_agent_ = std::make_unique<MutationObserverAgent>(this);
+  return mutation_observer_agent_.get();
+}
+
 ExecutingContext* ExecutingContext::From(JSContext* ctx) {
   return static_cast<ExecutingContext*>(JS_GetContextOpaque(ctx));
 }
@@ -133,7 +139,7 @@ bool ExecutingContext::EvaluateJavaScript(const char* code,
 
   JSValue result;
   if (parsed_bytecodes == nullptr) {
-    result = JS_Eval(script_state_.ctx(), code, code_len, sourceURL, JS_EVAL_TYPE_GLOBAL);
+    result = JS_Eval(script_state_.ctx(), code, code_len, sourceURL, ScriptEvalFlags());
   } else {
     JSValue byte_object =
         JS_Eval(script_state_.ctx(), code, code_len, sourceURL, JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
@@ -156,7 +162,7 @@ bool ExecutingContext::EvaluateJavaScript(const char* code,
 
 bool ExecutingContext::EvaluateJavaScript(const char16_t* code, size_t length, const char* sourceURL, int startLine) {
   std::string utf8Code = toUTF8(std::u16string(reinterpret_cast<const char16_t*>(code), length));
-  JSValue result = JS_Eval(script_state_.ctx(), utf8Code.c_str(), utf8Code.size(), sourceURL, JS_EVAL_TYPE_GLOBAL);
+  JSValue result = JS_Eval(script_state_.ctx(), utf8Code.c_str(), utf8Code.size(), sourceURL, ScriptEvalFlags());
   DrainMicrotasks();
   bool success = HandleException(&result);
   JS_FreeValue(script_state_.ctx(), result);
@@ -164,7 +170,7 @@ bool ExecutingContext::EvaluateJavaScript(const char16_t* code, size_t length, c
 }
 
 bool ExecutingContext::EvaluateJavaScript(const char* code, size_t codeLength, const char* sourceURL, int startLine) {
-  JSValue result = JS_Eval(script_state_.ctx(), code, codeLength, sourceURL, JS_EVAL_TYPE_GLOBAL);
+  JSValue result = JS_Eval(script_state_.ctx(), code, codeLength, sourceURL, ScriptEvalFlags());
   DrainMicrotasks();
   bool success = HandleException(&result);
   JS_FreeValue(script_state_.ctx(), result);
@@ -389,6 +395,22 @@ void ExecutingContext::TurnOffJavaScriptGC() {
   JS_TurnOffGC(script_state_.runtime());
 }
 
+void ExecutingContext::GetMemoryUsage(JSContextMemoryUsage* usage) {
+  JS_GetContextMemoryUsage(script_state_.ctx(), usage);
+}
+
+void ExecutingContext::SetMemoryLimit(size_t soft_limit, size_t hard_limit) {
+  JS_SetContextMemoryLimit(script_state_.ctx(), soft_limit, hard_limit);
+}
+
+void ExecutingContext::SetLazyFunctionCompilation(bool enabled) {
+  lazy_function_compilation_ = enabled;
+}
+
+int ExecutingContext::ScriptEvalFlags() const {
+  return JS_EVAL_TYPE_GLOBAL | (lazy_function_compilation_ ? JS_EVAL_FLAG_LAZY_FUNCTIONS : 0);
+}
+
 void ExecutingContext::DispatchErrorEvent(ErrorEvent* error_event) {
   if (in_dispatch_error_event_) {
     return;
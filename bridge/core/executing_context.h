@@ -16,6 +16,7 @@
 #include <mutex>
 #include <set>
 #include <unordered_map>
+#include <vector>
 #include "bindings/qjs/binding_initializer.h"
 #include "bindings/qjs/rejected_promises.h"
 #include "bindings/qjs/script_value.h"
@@ -47,6 +48,7 @@ class MemberMutationScope;
 class ErrorEvent;
 class DartContext;
 class MutationObserver;
+class MutationObserverAgent;
 class BindingObject;
 class ScriptWrappable;
 
@@ -123,6 +125,9 @@ class ExecutingContext {
   bool HasMutationScope() const { return active_mutation_scope != nullptr; }
   MemberMutationScope* mutationScope() const { return active_mutation_scope; }
   void ClearMutationScope();
+  // The deferred frees of the active MemberMutationScopes.
+  std::vector<void*>& MemberFreeLog() { return member_free_log_; }
+  MutationObserverAgent* EnsureMutationObserverAgent();
 
   FORCE_INLINE Document* document() const { return document_; };
   FORCE_INLINE Window* window() const { return window_; }
@@ -142,6 +147,16 @@ class ExecutingContext {
   void TurnOnJavaScriptGC();
   void TurnOffJavaScriptGC();
 
+  // Memory allocated by this context on the shared runtime. Crossing the soft limit makes the runtime collect
+  // earlier for this page, allocations beyond the hard limit throw an out of memory error. 0 disables a limit.
+  void GetMemoryUsage(JSContextMemoryUsage* usage);
+  void SetMemoryLimit(size_t soft_limit, size_t hard_limit);
+
+  // Defer the compilation of large function bodies in evaluated scripts until their first call. The bodies are only
+  // checked for balanced brackets up front, so their syntax errors are thrown on the first call instead of when the
+  // script is evaluated. Off by default.
+  void SetLazyFunctionCompilation(bool enabled);
+
   void DispatchErrorEvent(ErrorEvent* error_event);
   void DispatchErrorEventInterval(ErrorEvent* error_event);
   void ReportErrorEvent(ErrorEvent* error_event);
@@ -166,6 +181,7 @@ class ExecutingContext {
 
   void DrainPendingPromiseJobs();
   void EnsureEnqueueMicrotask();
+  int ScriptEvalFlags() const;
 
   static void promiseRejectTracker(JSContext* ctx,
                                    JSValueConst promise,
@@ -202,8 +218,11 @@ class ExecutingContext {
   ModuleContextCoordinator module_contexts_;
   ExecutionContextData context_data_{this};
   bool in_dispatch_error_event_{false};
+  bool lazy_function_compilation_{false};
   RejectedPromises rejected_promises_;
   MemberMutationScope* active_mutation_scope{nullptr};
+  std::vector<void*> member_free_log_;
+  std::unique_ptr<MutationObserverAgent> mutation_observer_agent_;
   std::set<ScriptWrappable*> active_wrappers_;
   bool is_dedicated_;
 };
@@ -342,15 +342,129 @@ TEST(Context, evaluateByteCode) {
   EXPECT_EQ(logCalled, true);
 }
 
+TEST(Context, memoryUsageIsChargedPerPage) {
+  auto env = TEST_init();
+  auto env2 = TEST_init();
+  JSContextMemoryUsage before;
+  JSContextMemoryUsage other_before;
+  env->page()->executingContext()->GetMemoryUsage(&before);
+  env2->page()->executingContext()->GetMemoryUsage(&other_before);
+  EXPECT_GT(before.malloc_size, 0);
+
+  const char* code = "globalThis.list = []; for (let i = 0; i < 10000; i ++) list.push({ i, name: 'item' + i });";
+  env->page()->evaluateScript(code, strlen(code), "file://", 0);
+
+  JSContextMemoryUsage after;
+  JSContextMemoryUsage other_after;
+  env->page()->executingContext()->GetMemoryUsage(&after);
+  env2->page()->executingContext()->GetMemoryUsage(&other_after);
+  EXPECT_GT(after.malloc_size, before.malloc_size + 10000 * 16);
+  EXPECT_EQ(other_after.malloc_size, other_before.malloc_size);
+}
+
+TEST(Context, runtimeAllocationsAreNotChargedToLastPage) {
+  auto env = TEST_init();
+  auto env2 = TEST_init();
+  JSContextMemoryUsage before;
+  JSContextMemoryUsage other_before;
+  env->page()->executingContext()->GetMemoryUsage(&before);
+  env2->page()->executingContext()->GetMemoryUsage(&other_before);
+
+  // The class name atom is allocated by the runtime without any context.
+  std::string class_name(64 * 1024, 'a');
+  JSClassDef class_def{};
+  class_def.class_name = class_name.c_str();
+  JSClassID class_id = 0;
+  JS_NewClassID(&class_id);
+  JS_NewClass(JS_GetRuntime(env->page()->executingContext()->ctx()), class_id, &class_def);
+
+  JSContextMemoryUsage after;
+  JSContextMemoryUsage other_after;
+  env->page()->executingContext()->GetMemoryUsage(&after);
+  env2->page()->executingContext()->GetMemoryUsage(&other_after);
+  EXPECT_LT((after.malloc_size - before.malloc_size) + (other_after.malloc_size - other_before.malloc_size),
+            static_cast<int64_t>(class_name.size()));
+}
+
+TEST(Context, memoryHardLimitThrowsOutOfMemory) {
+  static bool errorHandlerExecuted = false;
+  auto errorHandler = [](double contextId, const char* errmsg) {
+    errorHandlerExecuted = true;
+    EXPECT_NE(strstr(errmsg, "InternalError: out of memory"), nullptr);
+  };
+  auto env = TEST_init(errorHandler);
+  auto context = env->page()->executingContext();
+  JSContextMemoryUsage usage;
+  context->GetMemoryUsage(&usage);
+  context->SetMemoryLimit(usage.malloc_size + 1024 * 1024, usage.malloc_size + 4 * 1024 * 1024);
+
+  const char* code = "let list = []; for (let i = 0; i < 1000000; i ++) list.push({ i });";
+  env->page()->evaluateScript(code, strlen(code), "file://", 0);
+  EXPECT_EQ(errorHandlerExecuted, true);
+
+  context->GetMemoryUsage(&usage);
+  EXPECT_EQ(usage.soft_limit_exceeded, true);
+}
+
+TEST(Context, lazyFunctionCompiledOnFirstCall) {
+  static bool errorHandlerExecuted = false;
+  auto errorHandler = [](double contextId, const char* errmsg) {
+    errorHandlerExecuted = true;
+    EXPECT_STREQ(errmsg,
+                 "TypeError: cannot read property 'toString' of null\n"
+                 "    at compute (file://:6:17)\n"
+                 "    at <eval> (file://:8:1)\n");
+  };
+  auto env = TEST_init(errorHandler);
+  env->page()->executingContext()->SetLazyFunctionCompilation(true);
+  const char* code =
+      "let base = 40;\n"
+      "function compute(list) {\n"
+      "  let sum = base;\n"
+      "  for (let i = 0; i < list.length; i++) sum += list[i];\n"
+      "  let object = sum > 0 ? null : {};\n"
+      "  return object.toString();\n"
+      "}\n"
+      "compute([1, 2]);";
+  env->page()->evaluateScript(code, strlen(code), "file://", 0);
+  EXPECT_EQ(errorHandlerExecuted, true);
+}
+
+TEST(Context, syntaxErrorInUncalledFunctionIsThrownEarly) {
+  static bool errorHandlerExecuted = false;
+  static bool logCalled = false;
+  auto errorHandler = [](double contextId, const char* errmsg) {
+    errorHandlerExecuted = true;
+    EXPECT_NE(strstr(errmsg, "SyntaxError"), nullptr);
+  };
+  auto env = TEST_init(errorHandler);
+  webf::WebFPage::consoleMessageHandler = [](void* ctx, const std::string& message, int logLevel) {
+    logCalled = true;
+  };
+  const char* code =
+      "function neverCalled(list) {\n"
+      "  let sum = 0;\n"
+      "  for (let i = 0; i < list.length; i++) sum += list[i];\n"
+      "  let object = sum > 0 ? null : {};\n"
+      "  return object.toString() +;\n"
+      "}\n"
+      "console.log('evaluated');";
+  env->page()->evaluateScript(code, strlen(code), "file://", 0);
+  EXPECT_EQ(errorHandlerExecuted, true);
+  EXPECT_EQ(logCalled, false);
+  webf::WebFPage::consoleMessageHandler = nullptr;
+}
+
 TEST(jsValueToNativeString, utf8String) {
   auto env = TEST_init([](double contextId, const char* errmsg) {});
   JSValue str = JS_NewString(env->page()->executingContext()->ctx(), "helloworld");
   std::unique_ptr<webf::SharedNativeString> nativeString =
       webf::jsValueToNativeString(env->page()->executingContext()->ctx(), str);
   EXPECT_EQ(nativeString->length(), 10);
+  EXPECT_EQ(nativeString->is_one_byte(), true);
   uint8_t expectedString[10] = {104, 101, 108, 108, 111, 119, 111, 114, 108, 100};
   for (int i = 0; i < 10; i++) {
-    EXPECT_EQ(expectedString[i], *(nativeString->string() + i));
+    EXPECT_EQ(expectedString[i], *(nativeString->string8() + i));
   }
   JS_FreeValue(env->page()->executingContext()->ctx(), str);
 }
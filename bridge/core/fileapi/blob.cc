@@ -3,8 +3,11 @@
  * Copyright (C) 2022-present The WebF authors. All rights reserved.
  */
 #include "blob.h"
-#include <modp_b64/modp_b64.h>
+#include <quickjs/cutils.h>
+#include <algorithm>
+#include <cstring>
 #include <string>
+#include "bindings/qjs/qjs_engine_patch.h"
 #include "bindings/qjs/script_promise_resolver.h"
 #include "built_in_string.h"
 #include "core/executing_context.h"
@@ -43,7 +46,14 @@ void BlobReaderClient::DidFinishLoading() {
   } else if (read_type_ == ReadType::kReadAsArrayBuffer) {
     resolver_->Resolve<ArrayBufferData>(blob_->ArrayBufferResult());
   } else if (read_type_ == ReadType::kReadAsBase64) {
-    resolver_->Resolve<std::string>(blob_->Base64Result());
+    ScriptValue result = blob_->Base64Result();
+    if (result.IsException()) {
+      JSValue exception = JS_GetException(context_->ctx());
+      resolver_->Reject(exception);
+      JS_FreeValue(context_->ctx(), exception);
+    } else {
+      resolver_->Resolve(result.QJSValue());
+    }
   }
   delete this;
 }
@@ -102,16 +112,20 @@ std::string Blob::StringResult() {
   return std::string(bytes(), bytes() + size());
 }
 
-std::string Blob::Base64Result() {
-  size_t encode_len = modp_b64_encode_data_len(size());
-  std::string buffer;
-  buffer.resize(encode_len);
-
-  const size_t output_size =
-      modp_b64_encode_data(reinterpret_cast<char*>(buffer.data()), reinterpret_cast<const char*>(bytes()), size());
-  assert(output_size == encode_len);
-
-  return "data:" + mime_type_ + ";base64," + buffer;
+ScriptValue Blob::Base64Result() {
+  std::string prefix = "data:" + mime_type_ + ";base64,";
+  // The data URL is encoded straight into the result string, a type out of printable ASCII is empty per the File API.
+  if (std::any_of(prefix.begin(), prefix.end(), [](char c) { return c < 0x20 || c > 0x7e; }))
+    prefix = "data:;base64,";
+  uint8_t* data;
+  JSValue result = JS_NewLatin1String(ctx(), prefix.size() + b64_encode_len(size()), &data);
+  if (JS_IsException(result))
+    return ScriptValue(ctx(), JS_EXCEPTION);
+  memcpy(data, prefix.data(), prefix.size());
+  b64_encode(data + prefix.size(), bytes(), size());
+  ScriptValue value(ctx(), result);
+  JS_FreeValue(ctx(), result);
+  return value;
 }
 
 ArrayBufferData Blob::ArrayBufferResult() {
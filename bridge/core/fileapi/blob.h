@@ -10,6 +10,7 @@
 #include "array_buffer_data.h"
 #include "bindings/qjs/macros.h"
 #include "bindings/qjs/script_promise.h"
+#include "bindings/qjs/script_value.h"
 #include "bindings/qjs/script_wrappable.h"
 #include "blob_part.h"
 #include "blob_property_bag.h"
@@ -63,7 +64,8 @@ class Blob : public ScriptWrappable {
   Blob* slice(int64_t start, int64_t end, const AtomicString& content_type, ExceptionState& exception_state);
 
   std::string StringResult();
-  std::string Base64Result();
+  // The contents as a base64 data URL string.
+  ScriptValue Base64Result();
   ArrayBufferData ArrayBufferResult();
 
   void Trace(GCVisitor* visitor) const override;
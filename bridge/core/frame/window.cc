@@ -4,9 +4,9 @@
  */
 
 #include "window.h"
-#include <modp_b64/modp_b64.h>
 #include "binding_call_methods.h"
 #include "bindings/qjs/cppgc/garbage_collected.h"
+#include "bindings/qjs/qjs_engine_patch.h"
 #include "core/css/computed_css_style_declaration.h"
 #include "core/dom/document.h"
 #include "core/dom/element.h"
@@ -21,84 +21,68 @@ Window::Window(ExecutingContext* context) : EventTargetWithInlineData(context) {
   context->uiCommandBuffer()->addCommand(UICommand::kCreateWindow, nullptr, (void*)bindingObject(), nullptr);
 }
 
-// https://infra.spec.whatwg.org/#ascii-whitespace
-// Matches the definition of IsHTMLSpace in html_parser_idioms.h.
-template <typename CharType>
-bool IsAsciiWhitespace(CharType character) {
-  return character <= ' ' &&
-         (character == ' ' || character == '\n' || character == '\t' || character == '\r' || character == '\f');
-}
-
-AtomicString Window::btoa(const AtomicString& source, ExceptionState& exception_state) {
-  if (source.IsEmpty())
-    return AtomicString::Empty();
-  size_t encode_len = modp_b64_encode_data_len(source.length());
-  std::vector<char> buffer;
-  buffer.resize(encode_len);
+namespace {
 
-  const size_t output_size = modp_b64_encode_data(reinterpret_cast<char*>(buffer.data()),
-                                                  reinterpret_cast<const char*>(source.Character8()), source.length());
-  assert(output_size == encode_len);
-
-  return {ctx(), buffer.data(), buffer.size()};
+ScriptValue Base64Decode(JSContext* ctx, const ScriptValue& source, bool to_bytes, ExceptionState& exception_state) {
+  JSValue string = JS_ToString(ctx, source.QJSValue());
+  if (JS_IsException(string)) {
+    JSValue exception = JS_GetException(ctx);
+    exception_state.ThrowException(ctx, exception);
+    JS_FreeValue(ctx, exception);
+    return ScriptValue::Empty(ctx);
+  }
+  JSValue result = JS_Base64DecodeString(ctx, string, to_bytes);
+  JS_FreeValue(ctx, string);
+  if (JS_IsNull(result)) {
+    exception_state.ThrowException(ctx, ErrorType::TypeError, "The string to be decoded is not correctly encoded.");
+    return ScriptValue::Empty(ctx);
+  }
+  if (JS_IsException(result)) {
+    JSValue exception = JS_GetException(ctx);
+    exception_state.ThrowException(ctx, exception);
+    JS_FreeValue(ctx, exception);
+    return ScriptValue::Empty(ctx);
+  }
+  ScriptValue value(ctx, result);
+  JS_FreeValue(ctx, result);
+  return value;
 }
 
-// Invokes modp_b64 without stripping whitespace.
-bool Base64DecodeRaw(const AtomicString& in, std::vector<uint8_t>& out, ModpDecodePolicy policy) {
-  size_t decode_len = modp_b64_decode_len(in.length());
-  out.resize(decode_len);
+}  // namespace
 
-  const size_t output_size = modp_b64_decode(reinterpret_cast<char*>(out.data()),
-                                             reinterpret_cast<const char*>(in.Character8()), in.length(), policy);
-  if (output_size == MODP_B64_ERROR)
-    return false;
-  out.resize(output_size);
-  return true;
-}
-
-bool Base64Decode(JSContext* ctx, AtomicString in, std::vector<uint8_t>& out, ModpDecodePolicy policy) {
-  switch (policy) {
-    case ModpDecodePolicy::kForgiving: {
-      // https://infra.spec.whatwg.org/#forgiving-base64-decode
-      // Step 1 is to remove all whitespace. However, checking for whitespace
-      // slows down the "happy" path. Since any whitespace will fail normal
-      // decoding from modp_b64_decode, just try again if we detect a failure.
-      // This shouldn't be much slower for whitespace inputs.
-      //
-      // TODO(csharrison): Most callers use String inputs so ToString() should
-      // be fast. Still, we should add a RemoveCharacters method to StringView
-      // to avoid a double allocation for non-String-backed StringViews.
-      return Base64DecodeRaw(in, out, policy) ||
-             Base64DecodeRaw(in.RemoveCharacters(ctx, &IsAsciiWhitespace), out, policy);
-    }
-    case ModpDecodePolicy::kNoPaddingValidation: {
-      return Base64DecodeRaw(in, out, policy);
-    }
-    case ModpDecodePolicy::kStrict:
-      return false;
+ScriptValue Window::btoa(const ScriptValue& source, ExceptionState& exception_state) {
+  JSValue string = JS_ToString(ctx(), source.QJSValue());
+  if (JS_IsException(string)) {
+    JSValue exception = JS_GetException(ctx());
+    exception_state.ThrowException(ctx(), exception);
+    JS_FreeValue(ctx(), exception);
+    return ScriptValue::Empty(ctx());
   }
-}
-
-AtomicString Window::atob(const AtomicString& source, ExceptionState& exception_state) {
-  if (source.IsEmpty())
-    return AtomicString::Empty();
-  if (!source.ContainsOnlyLatin1OrEmpty()) {
+  JSValue result = JS_Base64EncodeString(ctx(), string);
+  JS_FreeValue(ctx(), string);
+  if (JS_IsNull(result)) {
     exception_state.ThrowException(ctx(), ErrorType::TypeError,
-                                   "The string to be decoded contains \"\n"
-                                   "        \"characters outside of the Latin1 range.");
-    return AtomicString::Empty();
+                                   "The string to be encoded contains characters outside of the Latin1 range.");
+    return ScriptValue::Empty(ctx());
   }
-
-  std::vector<uint8_t> buffer;
-  if (!Base64Decode(ctx(), source, buffer, ModpDecodePolicy::kForgiving)) {
-    exception_state.ThrowException(ctx(), ErrorType::TypeError, "The string to be decoded is not correctly encoded.");
-    return AtomicString::Empty();
+  if (JS_IsException(result)) {
+    JSValue exception = JS_GetException(ctx());
+    exception_state.ThrowException(ctx(), exception);
+    JS_FreeValue(ctx(), exception);
+    return ScriptValue::Empty(ctx());
   }
+  ScriptValue value(ctx(), result);
+  JS_FreeValue(ctx(), result);
+  return value;
+}
+
+// https://html.spec.whatwg.org/multipage/webappapis.html#dom-atob
+ScriptValue Window::atob(const ScriptValue& source, ExceptionState& exception_state) {
+  return Base64Decode(ctx(), source, false, exception_state);
+}
 
-  JSValue str = JS_NewRawUTF8String(ctx(), buffer.data(), buffer.size());
-  AtomicString result = {ctx(), str};
-  JS_FreeValue(ctx(), str);
-  return result;
+ScriptValue Window::__webf_base64_decode__(const ScriptValue& source, ExceptionState& exception_state) {
+  return Base64Decode(ctx(), source, true, exception_state);
 }
 
 Window* Window::open(ExceptionState& exception_state) {
@@ -8,9 +8,11 @@ import {ComputedCssStyleDeclaration} from "../css/computed_css_style_declaration
 import {Element} from "../dom/element";
 
 interface Window extends EventTarget, WindowEventHandlers, GlobalEventHandlers {
-  // base64 utility methods
-  btoa(string: string): string;
-  atob(string: string): string;
+  // base64 utility methods, the strings are read and created directly instead of being converted to AtomicStrings.
+  btoa(string: any): any;
+  atob(string: any): any;
+  // Same as atob(), returning the decoded bytes as a Uint8Array instead of a binary string.
+  __webf_base64_decode__(string: any): any;
   open(url?: string): Window | null;
   scroll(x: number, y: number): void;
   scroll(options?: ScrollToOptions): void;
@@ -0,0 +1,271 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+#include "html_serializer.h"
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "bindings/qjs/qjs_engine_patch.h"
+#include "core/dom/comment.h"
+#include "core/dom/document_fragment.h"
+#include "core/dom/element.h"
+#include "core/dom/text.h"
+#include "core/html/html_template_element.h"
+#include "html_names.h"
+
+namespace webf {
+
+namespace {
+
+enum class EscapeMode { kText, kAttribute, kRaw };
+
+// Counts the bytes of the markup, the first pass sizes the output buffer with it.
+class MarkupLength {
+ public:
+  void Append(char) { length_++; }
+  void Append(const char*, size_t length) { length_ += length; }
+
+  size_t length() const { return length_; }
+
+ private:
+  size_t length_{0};
+};
+
+// Writes the markup into a buffer already sized by MarkupLength.
+class MarkupWriter {
+ public:
+  explicit MarkupWriter(char* buffer) : cursor_(buffer) {}
+
+  void Append(char c) { *cursor_++ = c; }
+  void Append(const char* characters, size_t length) {
+    memcpy(cursor_, characters, length);
+    cursor_ += length;
+  }
+
+  const char* cursor() const { return cursor_; }
+
+ private:
+  char* cursor_;
+};
+
+const char* const kVoidElements[] = {"area", "base", "br",   "col",   "embed",  "hr",    "img",
+                                     "input", "link", "meta", "param", "source", "track", "wbr"};
+const char* const kRawTextElements[] = {"style",   "script",   "xmp",       "iframe",
+                                        "noembed", "noframes", "plaintext", "noscript"};
+
+template <size_t N>
+bool LocalNameIsOneOf(const Element& element, const char* const (&names)[N]) {
+  const AtomicString& local_name = element.localName();
+  if (local_name.IsEmpty() || JS_AtomIsTaggedInt(local_name.Impl()))
+    return false;
+  StringView view = local_name.ToStringView();
+  if (!view.Is8Bit())
+    return false;
+  for (const char* name : names) {
+    if (strlen(name) == view.length() && memcmp(name, view.Characters8(), view.length()) == 0)
+      return true;
+  }
+  return false;
+}
+
+const char* EntityFor(uint32_t c, EscapeMode mode) {
+  if (mode == EscapeMode::kRaw)
+    return nullptr;
+  switch (c) {
+    case '&':
+      return "&amp;";
+    case 0xA0:
+      return "&nbsp;";
+    case '<':
+      return mode == EscapeMode::kText ? "&lt;" : nullptr;
+    case '>':
+      return mode == EscapeMode::kText ? "&gt;" : nullptr;
+    case '"':
+      return mode == EscapeMode::kAttribute ? "&quot;" : nullptr;
+    default:
+      return nullptr;
+  }
+}
+
+// |characters| are Latin-1 when |is_latin1|, otherwise they are already UTF-8 and only ASCII is escaped.
+// Runs of characters that need no escaping are copied at once.
+template <typename Sink>
+void AppendEscaped(Sink& sink, const uint8_t* characters, size_t length, EscapeMode mode, bool is_latin1) {
+  size_t run_start = 0;
+  for (size_t i = 0; i < length; i++) {
+    uint8_t c = characters[i];
+    const char* entity = c < 0x80 || is_latin1 ? EntityFor(c, mode) : nullptr;
+    if (entity == nullptr && (c < 0x80 || !is_latin1))
+      continue;
+    sink.Append(reinterpret_cast<const char*>(characters + run_start), i - run_start);
+    run_start = i + 1;
+    if (entity != nullptr) {
+      sink.Append(entity, strlen(entity));
+    } else {
+      sink.Append(static_cast<char>(0xC0 | (c >> 6)));
+      sink.Append(static_cast<char>(0x80 | (c & 0x3F)));
+    }
+  }
+  sink.Append(reinterpret_cast<const char*>(characters + run_start), length - run_start);
+}
+
+// Encodes UTF-16 as UTF-8, a lone surrogate is written as U+FFFD.
+template <typename Sink>
+void AppendEscaped(Sink& sink, const char16_t* characters, size_t length, EscapeMode mode) {
+  for (size_t i = 0; i < length; i++) {
+    uint32_t c = characters[i];
+    if (const char* entity = EntityFor(c, mode)) {
+      sink.Append(entity, strlen(entity));
+    } else if (c < 0x80) {
+      sink.Append(static_cast<char>(c));
+    } else if (c < 0x800) {
+      sink.Append(static_cast<char>(0xC0 | (c >> 6)));
+      sink.Append(static_cast<char>(0x80 | (c & 0x3F)));
+    } else if (c >= 0xD800 && c <= 0xDBFF && i + 1 < length && characters[i + 1] >= 0xDC00 &&
+               characters[i + 1] <= 0xDFFF) {
+      c = 0x10000 + ((c - 0xD800) << 10) + (characters[++i] - 0xDC00);
+      sink.Append(static_cast<char>(0xF0 | (c >> 18)));
+      sink.Append(static_cast<char>(0x80 | ((c >> 12) & 0x3F)));
+      sink.Append(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+      sink.Append(static_cast<char>(0x80 | (c & 0x3F)));
+    } else {
+      if (c >= 0xD800 && c <= 0xDFFF)
+        c = 0xFFFD;
+      sink.Append(static_cast<char>(0xE0 | (c >> 12)));
+      sink.Append(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+      sink.Append(static_cast<char>(0x80 | (c & 0x3F)));
+    }
+  }
+}
+
+template <typename Sink>
+void AppendString(Sink& sink, const AtomicString& string, EscapeMode mode) {
+  if (string.IsEmpty())
+    return;
+  // Strings of an array index are interned as tagged integers, they have no characters to view.
+  if (JS_AtomIsTaggedInt(string.Impl())) {
+    char buffer[16];
+    int length = snprintf(buffer, sizeof(buffer), "%u", JS_AtomToUInt32(string.Impl()));
+    sink.Append(buffer, length);
+    return;
+  }
+  StringView view = string.ToStringView();
+  if (view.Is8Bit()) {
+    AppendEscaped(sink, reinterpret_cast<const uint8_t*>(view.Characters8()), view.length(), mode, true);
+  } else {
+    AppendEscaped(sink, view.Characters16(), view.length(), mode);
+  }
+}
+
+template <typename Sink>
+void AppendString(Sink& sink, const std::string& string, EscapeMode mode) {
+  AppendEscaped(sink, reinterpret_cast<const uint8_t*>(string.data()), string.size(), mode, false);
+}
+
+template <typename Sink>
+void AppendStartTag(Sink& sink, const Element& element) {
+  sink.Append('<');
+  AppendString(sink, element.localName(), EscapeMode::kRaw);
+
+  // The inline style holds the current declarations, the style attribute is only synchronized with it lazily.
+  InlineCssStyleDeclaration* inline_style = element.InlineStyle();
+  if (ElementAttributes* attributes = element.AttributesIfExists()) {
+    for (auto& attribute : *attributes) {
+      if (inline_style != nullptr && attribute.first == html_names::kStyleAttr)
+        continue;
+      sink.Append(' ');
+      AppendString(sink, attribute.first, EscapeMode::kRaw);
+      sink.Append("=\"", 2);
+      AppendString(sink, attribute.second, EscapeMode::kAttribute);
+      sink.Append('"');
+    }
+  }
+  if (inline_style != nullptr && !inline_style->Properties().empty()) {
+    sink.Append(" style=\"", 8);
+    for (auto& property : inline_style->Properties()) {
+      AppendString(sink, InlineCssStyleDeclaration::CSSPropertyName(property.first), EscapeMode::kAttribute);
+      sink.Append(": ", 2);
+      AppendString(sink, property.second, EscapeMode::kAttribute);
+      sink.Append(';');
+    }
+    sink.Append('"');
+  }
+
+  sink.Append('>');
+}
+
+template <typename Sink>
+void AppendEndTag(Sink& sink, const Element& element) {
+  sink.Append("</", 2);
+  AppendString(sink, element.localName(), EscapeMode::kRaw);
+  sink.Append('>');
+}
+
+const Node* FirstChildToSerialize(const Node& node) {
+  if (auto* template_element = DynamicTo<HTMLTemplateElement>(node))
+    return template_element->content()->firstChild();
+  return node.firstChild();
+}
+
+// Serializes |root| and its subtree, or only the subtree when |include_root| is false. The elements whose end tag is
+// pending are kept on a stack instead of the native stack, so the depth of the tree is not limited.
+template <typename Sink>
+void SerializeTree(Sink& sink, const Node& root, bool include_root) {
+  std::vector<const Element*> open_elements;
+  const Element* root_element = include_root ? nullptr : DynamicTo<Element>(root);
+  const Node* node = include_root ? &root : FirstChildToSerialize(root);
+
+  while (node != nullptr) {
+    if (auto* element = DynamicTo<Element>(node)) {
+      AppendStartTag(sink, *element);
+      if (!LocalNameIsOneOf(*element, kVoidElements)) {
+        if (const Node* child = FirstChildToSerialize(*element)) {
+          open_elements.push_back(element);
+          node = child;
+          continue;
+        }
+        AppendEndTag(sink, *element);
+      }
+    } else if (auto* text = DynamicTo<Text>(node)) {
+      const Element* parent = open_elements.empty() ? root_element : open_elements.back();
+      bool is_raw_text = parent != nullptr && LocalNameIsOneOf(*parent, kRawTextElements);
+      AppendString(sink, text->data(), is_raw_text ? EscapeMode::kRaw : EscapeMode::kText);
+    } else if (auto* comment = DynamicTo<Comment>(node)) {
+      sink.Append("<!--", 4);
+      AppendString(sink, comment->data(), EscapeMode::kRaw);
+      sink.Append("-->", 3);
+    }
+
+    // Move to the next sibling, closing the elements whose last child was just written.
+    while (node != &root && node->nextSibling() == nullptr && !open_elements.empty()) {
+      node = open_elements.back();
+      open_elements.pop_back();
+      AppendEndTag(sink, To<Element>(*node));
+    }
+    node = node == &root ? nullptr : node->nextSibling();
+  }
+}
+
+std::string Serialize(const Node& node, bool include_node) {
+  MarkupLength length;
+  SerializeTree(length, node, include_node);
+
+  std::string markup(length.length(), '\0');
+  MarkupWriter writer(&markup[0]);
+  SerializeTree(writer, node, include_node);
+  assert(writer.cursor() == markup.data() + markup.size());
+  return markup;
+}
+
+}  // namespace
+
+std::string HTMLSerializer::SerializeNode(const Node& node) {
+  return Serialize(node, true);
+}
+
+std::string HTMLSerializer::SerializeChildren(const Node& node) {
+  return Serialize(node, false);
+}
+
+}  // namespace webf
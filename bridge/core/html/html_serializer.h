@@ -0,0 +1,25 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+#ifndef BRIDGE_CORE_HTML_HTML_SERIALIZER_H_
+#define BRIDGE_CORE_HTML_HTML_SERIALIZER_H_
+
+#include <string>
+
+namespace webf {
+
+class Node;
+
+// https://html.spec.whatwg.org/multipage/parsing.html#serialising-html-fragments
+// The tree is walked without recursion, once to measure the markup and once to write it into a buffer of that size.
+class HTMLSerializer {
+ public:
+  // The markup of |node| and its subtree, as read by outerHTML.
+  static std::string SerializeNode(const Node& node);
+  // The markup of the children of |node|, as read by innerHTML. The children of a template are those of its content.
+  static std::string SerializeChildren(const Node& node);
+};
+
+}  // namespace webf
+
+#endif  // BRIDGE_CORE_HTML_HTML_SERIALIZER_H_
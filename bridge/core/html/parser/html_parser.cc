@@ -3,6 +3,8 @@
  * Copyright (C) 2022-present The WebF authors. All rights reserved.
  */
 
+#include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "core/dom/document.h"
@@ -22,6 +24,42 @@ std::string trim(const std::string& str) {
   return tmp;
 }
 
+// Elements of one document or fragment often repeat the same attributes, such as the rows of a list. They share a
+// single attribute vector, which also saves creating the atoms of the names and values again.
+class ParserAttributeCache {
+ public:
+  explicit ParserAttributeCache(JSContext* ctx) : ctx_(ctx) {}
+
+  ElementAttributes::SharedAttributeVector Get(const GumboVector* attributes) {
+    key_.clear();
+    for (int i = 0; i < attributes->length; ++i) {
+      auto* attribute = (GumboAttribute*)attributes->data[i];
+      key_ += attribute->name;
+      key_ += '\0';
+      key_ += attribute->value;
+      key_ += '\0';
+    }
+
+    auto it = cache_.find(key_);
+    if (it != cache_.end())
+      return it->second;
+
+    auto shared_attributes = std::make_shared<ElementAttributes::AttributeVector>();
+    shared_attributes->reserve(attributes->length);
+    for (int i = 0; i < attributes->length; ++i) {
+      auto* attribute = (GumboAttribute*)attributes->data[i];
+      shared_attributes->emplace_back(AtomicString(ctx_, attribute->name), AtomicString(ctx_, attribute->value));
+    }
+    cache_.emplace(key_, shared_attributes);
+    return shared_attributes;
+  }
+
+ private:
+  JSContext* ctx_;
+  std::string key_;
+  std::unordered_map<std::string, ElementAttributes::SharedAttributeVector> cache_;
+};
+
 // Parse html,isHTMLFragment should be false if you need to automatically complete html, head, and body when they are
 // missing.
 GumboOutput* parse(const std::string& html, bool isHTMLFragment = false) {
@@ -93,7 +131,7 @@ GumboNode* findSVGRoot(GumboNode* node) {
   return nullptr;
 }
 
-void HTMLParser::traverseHTML(Node* root_node, GumboNode* node) {
+void HTMLParser::traverseHTML(Node* root_node, GumboNode* node, ParserAttributeCache& attribute_cache) {
   auto* context = root_node->GetExecutingContext();
   JSContext* ctx = root_node->GetExecutingContext()->ctx();
 
@@ -102,44 +140,51 @@ void HTMLParser::traverseHTML(Node* root_node, GumboNode* node) {
     parseProperty(html_element, &node->v.element);
   }
 
+  auto* root_container = DynamicTo<ContainerNode>(root_node);
+  if (root_container == nullptr)
+    return;
+
+  // The children of one level are attached together, so they reach Dart as a single insertion command.
+  NodeVector new_children;
   const GumboVector* children = &node->v.element.children;
   for (int i = 0; i < children->length; ++i) {
     auto* child = (GumboNode*)children->data[i];
 
-    if (auto* root_container = DynamicTo<ContainerNode>(root_node)) {
-      if (child->type == GUMBO_NODE_ELEMENT) {
-        std::string tagName;
-        if (child->v.element.tag != GUMBO_TAG_UNKNOWN) {
-          tagName = gumbo_normalized_tagname(child->v.element.tag);
-        } else {
-          GumboStringPiece piece = child->v.element.original_tag;
-          gumbo_tag_from_original_text(&piece);
-          tagName = std::string(piece.data, piece.length);
-        }
-
-        Element* element;
+    if (child->type == GUMBO_NODE_ELEMENT) {
+      std::string tagName;
+      if (child->v.element.tag != GUMBO_TAG_UNKNOWN) {
+        tagName = gumbo_normalized_tagname(child->v.element.tag);
+      } else {
+        GumboStringPiece piece = child->v.element.original_tag;
+        gumbo_tag_from_original_text(&piece);
+        tagName = std::string(piece.data, piece.length);
+      }
 
-        switch (child->v.element.tag_namespace) {
-          case ::GUMBO_NAMESPACE_SVG: {
-            element = context->document()->createElementNS(element_namespace_uris::ksvg, AtomicString(ctx, tagName),
-                                                           ASSERT_NO_EXCEPTION());
-            break;
-          }
+      Element* element;
 
-          default: {
-            element = context->document()->createElement(AtomicString(ctx, tagName), ASSERT_NO_EXCEPTION());
-          }
+      switch (child->v.element.tag_namespace) {
+        case ::GUMBO_NAMESPACE_SVG: {
+          element = context->document()->createElementNS(element_namespace_uris::ksvg, AtomicString(ctx, tagName),
+                                                         ASSERT_NO_EXCEPTION());
+          break;
         }
 
-        traverseHTML(element, child);
-        root_container->AppendChild(element);
-        parseProperty(element, &child->v.element);
-      } else if (child->type == GUMBO_NODE_TEXT) {
-        auto* text = context->document()->createTextNode(AtomicString(ctx, child->v.text.text), ASSERT_NO_EXCEPTION());
-        root_container->AppendChild(text);
+        default: {
+          element = context->document()->createElement(AtomicString(ctx, tagName), ASSERT_NO_EXCEPTION());
+        }
       }
+
+      if (child->v.element.attributes.length > 0)
+        element->ParserSetAttributes(attribute_cache.Get(&child->v.element.attributes));
+      traverseHTML(element, child, attribute_cache);
+      new_children.emplace_back(element);
+    } else if (child->type == GUMBO_NODE_TEXT) {
+      auto* text = context->document()->createTextNode(AtomicString(ctx, child->v.text.text), ASSERT_NO_EXCEPTION());
+      new_children.emplace_back(text);
     }
   }
+
+  root_container->AppendNewChildren(new_children);
 }
 
 bool HTMLParser::parseHTML(const std::string& html, Node* root_node, bool isHTMLFragment) {
@@ -149,7 +194,8 @@ bool HTMLParser::parseHTML(const std::string& html, Node* root_node, bool isHTML
 
       if (!trim(html).empty()) {
         GumboOutput* htmlTree = parse(html, isHTMLFragment);
-        traverseHTML(root_container_node, htmlTree->root);
+        ParserAttributeCache attribute_cache(root_container_node->ctx());
+        traverseHTML(root_container_node, htmlTree->root, attribute_cache);
         // Free gumbo parse nodes.
         gumbo_destroy_output(&kGumboDefaultOptions, htmlTree);
       }
@@ -14,6 +14,7 @@ namespace webf {
 class Node;
 class Element;
 class ExecutingContext;
+class ParserAttributeCache;
 
 std::string trim(const std::string& str);
 
@@ -28,7 +29,7 @@ class HTMLParser {
 
  private:
   ExecutingContext* context_;
-  static void traverseHTML(Node* root, GumboNode* node);
+  static void traverseHTML(Node* root, GumboNode* node, ParserAttributeCache& attribute_cache);
   static void parseProperty(Element* element, GumboElement* gumboElement);
 
   static bool parseHTML(const std::string& html, Node* rootNode, bool isHTMLFragment);
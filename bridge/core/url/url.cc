@@ -0,0 +1,105 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "url.h"
+#include "core/executing_context.h"
+#include "url_search_params.h"
+
+namespace webf {
+
+URL* URL::Create(ExecutingContext* context, const AtomicString& url, ExceptionState& exception_state) {
+  URLRecord record;
+  if (!record.Parse(url.ToStdString(context->ctx()))) {
+    exception_state.ThrowException(context->ctx(), ErrorType::TypeError, "Failed to construct 'URL': Invalid URL");
+    return nullptr;
+  }
+  return MakeGarbageCollected<URL>(context, std::move(record));
+}
+
+URL* URL::Create(ExecutingContext* context,
+                 const AtomicString& url,
+                 const AtomicString& base,
+                 ExceptionState& exception_state) {
+  URLRecord base_record;
+  URLRecord record;
+  if (!base_record.Parse(base.ToStdString(context->ctx())) ||
+      !record.Parse(url.ToStdString(context->ctx()), &base_record)) {
+    exception_state.ThrowException(context->ctx(), ErrorType::TypeError, "Failed to construct 'URL': Invalid URL");
+    return nullptr;
+  }
+  return MakeGarbageCollected<URL>(context, std::move(record));
+}
+
+URL::URL(ExecutingContext* context, URLRecord&& record)
+    : ScriptWrappable(context->ctx()), record_(std::move(record)) {}
+
+void URL::setHref(const AtomicString& value, ExceptionState& exception_state) {
+  if (!record_.Parse(value.ToStdString(ctx()))) {
+    exception_state.ThrowException(ctx(), ErrorType::TypeError,
+                                   "Failed to set the 'href' property on 'URL': Invalid URL");
+    return;
+  }
+  DidUpdateQuery();
+}
+
+void URL::setProtocol(const AtomicString& value, ExceptionState& exception_state) {
+  record_.SetProtocol(value.ToStdString(ctx()));
+}
+
+void URL::setUsername(const AtomicString& value, ExceptionState& exception_state) {
+  record_.SetUsername(value.ToStdString(ctx()));
+}
+
+void URL::setPassword(const AtomicString& value, ExceptionState& exception_state) {
+  record_.SetPassword(value.ToStdString(ctx()));
+}
+
+void URL::setHost(const AtomicString& value, ExceptionState& exception_state) {
+  record_.SetHost(value.ToStdString(ctx()));
+}
+
+void URL::setHostname(const AtomicString& value, ExceptionState& exception_state) {
+  record_.SetHostname(value.ToStdString(ctx()));
+}
+
+void URL::setPort(const AtomicString& value, ExceptionState& exception_state) {
+  record_.SetPort(value.ToStdString(ctx()));
+}
+
+void URL::setPathname(const AtomicString& value, ExceptionState& exception_state) {
+  record_.SetPathname(value.ToStdString(ctx()));
+}
+
+void URL::setSearch(const AtomicString& value, ExceptionState& exception_state) {
+  record_.SetSearch(value.ToStdString(ctx()));
+  DidUpdateQuery();
+}
+
+void URL::setHash(const AtomicString& value, ExceptionState& exception_state) {
+  record_.SetHash(value.ToStdString(ctx()));
+}
+
+URLSearchParams* URL::searchParams() {
+  if (search_params_ == nullptr) {
+    auto* search_params = MakeGarbageCollected<URLSearchParams>(GetExecutingContext(), this);
+    search_params->SetQuery(record_.query());
+    search_params_ = search_params;
+  }
+  return search_params_.Get();
+}
+
+void URL::DidUpdateSearchParams(const std::string* query) {
+  record_.SetEncodedQuery(query);
+}
+
+void URL::DidUpdateQuery() {
+  if (search_params_ != nullptr)
+    search_params_->SetQuery(record_.query());
+}
+
+void URL::Trace(GCVisitor* visitor) const {
+  visitor->TraceMember(search_params_);
+}
+
+}  // namespace webf
@@ -0,0 +1,76 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef WEBF_CORE_URL_URL_H_
+#define WEBF_CORE_URL_URL_H_
+
+#include "bindings/qjs/atomic_string.h"
+#include "bindings/qjs/cppgc/member.h"
+#include "bindings/qjs/exception_state.h"
+#include "bindings/qjs/script_wrappable.h"
+#include "url_record.h"
+
+namespace webf {
+
+class URLSearchParams;
+
+// https://url.spec.whatwg.org/#url-class
+class URL : public ScriptWrappable {
+  DEFINE_WRAPPERTYPEINFO();
+
+ public:
+  using ImplType = URL*;
+
+  static URL* Create(ExecutingContext* context, const AtomicString& url, ExceptionState& exception_state);
+  static URL* Create(ExecutingContext* context,
+                     const AtomicString& url,
+                     const AtomicString& base,
+                     ExceptionState& exception_state);
+
+  URL() = delete;
+  explicit URL(ExecutingContext* context, URLRecord&& record);
+
+  const std::string& href() const { return record_.href(); }
+  void setHref(const AtomicString& value, ExceptionState& exception_state);
+  std::string origin() const { return record_.origin(); }
+  std::string protocol() const { return std::string(record_.protocol()); }
+  void setProtocol(const AtomicString& value, ExceptionState& exception_state);
+  std::string username() const { return std::string(record_.username()); }
+  void setUsername(const AtomicString& value, ExceptionState& exception_state);
+  std::string password() const { return std::string(record_.password()); }
+  void setPassword(const AtomicString& value, ExceptionState& exception_state);
+  std::string host() const { return std::string(record_.host()); }
+  void setHost(const AtomicString& value, ExceptionState& exception_state);
+  std::string hostname() const { return std::string(record_.hostname()); }
+  void setHostname(const AtomicString& value, ExceptionState& exception_state);
+  std::string port() const { return std::string(record_.port()); }
+  void setPort(const AtomicString& value, ExceptionState& exception_state);
+  std::string pathname() const { return std::string(record_.pathname()); }
+  void setPathname(const AtomicString& value, ExceptionState& exception_state);
+  std::string search() const { return std::string(record_.search()); }
+  void setSearch(const AtomicString& value, ExceptionState& exception_state);
+  URLSearchParams* searchParams();
+  std::string hash() const { return std::string(record_.hash()); }
+  void setHash(const AtomicString& value, ExceptionState& exception_state);
+
+  AtomicString toString(ExceptionState& exception_state) const { return AtomicString(ctx(), record_.href()); }
+  AtomicString toJSON(ExceptionState& exception_state) const { return AtomicString(ctx(), record_.href()); }
+
+  const URLRecord& Record() const { return record_; }
+  // Called by the URLSearchParams of this URL when its list changes, a null |query| removes the query.
+  void DidUpdateSearchParams(const std::string* query);
+
+  void Trace(GCVisitor* visitor) const override;
+
+ private:
+  void DidUpdateQuery();
+
+  URLRecord record_;
+  // Created on the first access to searchParams, most URLs never use it.
+  Member<URLSearchParams> search_params_;
+};
+
+}  // namespace webf
+
+#endif  // WEBF_CORE_URL_URL_H_
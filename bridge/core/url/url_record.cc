@@ -0,0 +1,1459 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "url_record.h"
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <vector>
+
+namespace webf {
+
+namespace {
+
+// https://url.spec.whatwg.org/#percent-encoded-bytes
+enum PercentEncodeSet : uint8_t {
+  kC0ControlSet = 1 << 0,
+  kFragmentSet = 1 << 1,
+  kQuerySet = 1 << 2,
+  kSpecialQuerySet = 1 << 3,
+  kPathSet = 1 << 4,
+  kUserinfoSet = 1 << 5,
+  kComponentSet = 1 << 6,
+  kFormURLEncodedSet = 1 << 7,
+};
+
+constexpr uint8_t PercentEncodeSets(uint8_t c) {
+  if (c < 0x20 || c > 0x7e)
+    return 0xff;
+  uint8_t sets = 0;
+  if (c == ' ' || c == '"' || c == '<' || c == '>' || c == '`')
+    sets |= kFragmentSet;
+  if (c == ' ' || c == '"' || c == '#' || c == '<' || c == '>')
+    sets |= kQuerySet | kSpecialQuerySet | kPathSet;
+  if (c == '\'')
+    sets |= kSpecialQuerySet;
+  if (c == '?' || c == '`' || c == '{' || c == '}')
+    sets |= kPathSet;
+  if ((sets & kPathSet) || c == '/' || c == ':' || c == ';' || c == '=' || c == '@' || (c >= '[' && c <= '^') ||
+      c == '|')
+    sets |= kUserinfoSet;
+  if ((sets & kUserinfoSet) || (c >= '$' && c <= '&') || c == '+' || c == ',')
+    sets |= kComponentSet;
+  if ((sets & kComponentSet) || c == '!' || (c >= '\'' && c <= ')') || c == '~')
+    sets |= kFormURLEncodedSet;
+  return sets;
+}
+
+constexpr std::array<uint8_t, 256> MakePercentEncodeTable() {
+  std::array<uint8_t, 256> table{};
+  for (int i = 0; i < 256; i++) {
+    table[i] = PercentEncodeSets(static_cast<uint8_t>(i));
+  }
+  return table;
+}
+
+constexpr std::array<uint8_t, 256> kPercentEncodeTable = MakePercentEncodeTable();
+constexpr char kHexDigits[] = "0123456789ABCDEF";
+
+inline bool InSet(char c, uint8_t set) {
+  return kPercentEncodeTable[static_cast<uint8_t>(c)] & set;
+}
+
+inline void AppendPercentEncodedByte(std::string& output, uint8_t c) {
+  char encoded[3] = {'%', kHexDigits[c >> 4], kHexDigits[c & 0xf]};
+  output.append(encoded, 3);
+}
+
+// Appends |input| to |output|, the runs of bytes which don't need encoding are copied at once.
+void AppendPercentEncoded(std::string& output, std::string_view input, uint8_t set) {
+  size_t run_start = 0;
+  for (size_t i = 0; i < input.size(); i++) {
+    if (!InSet(input[i], set))
+      continue;
+    output.append(input.data() + run_start, i - run_start);
+    AppendPercentEncodedByte(output, static_cast<uint8_t>(input[i]));
+    run_start = i + 1;
+  }
+  output.append(input.data() + run_start, input.size() - run_start);
+}
+
+inline bool IsASCIIAlpha(char c) {
+  return (c | 0x20) >= 'a' && (c | 0x20) <= 'z';
+}
+
+inline bool IsASCIIDigit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+inline char ToASCIILower(char c) {
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c | 0x20) : c;
+}
+
+inline int HexValue(char c) {
+  if (IsASCIIDigit(c))
+    return c - '0';
+  c = static_cast<char>(c | 0x20);
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  return -1;
+}
+
+bool EqualsIgnoringASCIICase(std::string_view a, std::string_view b) {
+  if (a.size() != b.size())
+    return false;
+  for (size_t i = 0; i < a.size(); i++) {
+    if (ToASCIILower(a[i]) != b[i])
+      return false;
+  }
+  return true;
+}
+
+// https://url.spec.whatwg.org/#special-scheme
+int32_t DefaultPortForScheme(std::string_view scheme) {
+  switch (scheme.size()) {
+    case 2:
+      return scheme == "ws" ? 80 : -1;
+    case 3:
+      return scheme == "wss" ? 443 : scheme == "ftp" ? 21 : -1;
+    case 4:
+      return scheme == "http" ? 80 : -1;
+    case 5:
+      return scheme == "https" ? 443 : -1;
+  }
+  return -1;
+}
+
+bool IsSpecialScheme(std::string_view scheme) {
+  return DefaultPortForScheme(scheme) != -1 || scheme == "file";
+}
+
+bool IsSlash(char c, bool special) {
+  return c == '/' || (special && c == '\\');
+}
+
+// https://url.spec.whatwg.org/#windows-drive-letter
+bool IsWindowsDriveLetter(std::string_view s) {
+  return s.size() == 2 && IsASCIIAlpha(s[0]) && (s[1] == ':' || s[1] == '|');
+}
+
+bool IsNormalizedWindowsDriveLetter(std::string_view s) {
+  return s.size() == 2 && IsASCIIAlpha(s[0]) && s[1] == ':';
+}
+
+bool StartsWithWindowsDriveLetter(std::string_view s) {
+  if (s.size() < 2 || !IsWindowsDriveLetter(s.substr(0, 2)))
+    return false;
+  return s.size() == 2 || s[2] == '/' || s[2] == '\\' || s[2] == '?' || s[2] == '#';
+}
+
+bool IsSingleDotSegment(std::string_view s) {
+  return s == "." || EqualsIgnoringASCIICase(s, "%2e");
+}
+
+bool IsDoubleDotSegment(std::string_view s) {
+  switch (s.size()) {
+    case 2:
+      return s == "..";
+    case 4:
+      return EqualsIgnoringASCIICase(s, ".%2e") || EqualsIgnoringASCIICase(s, "%2e.");
+    case 6:
+      return EqualsIgnoringASCIICase(s, "%2e%2e");
+  }
+  return false;
+}
+
+// Parses a port made of ASCII digits, returns -1 if it is out of range.
+int32_t ParsePortNumber(std::string_view digits) {
+  uint32_t port = 0;
+  for (char c : digits) {
+    port = port * 10 + (c - '0');
+    if (port > 65535)
+      return -1;
+  }
+  return static_cast<int32_t>(port);
+}
+
+void AppendNumber(std::string& output, uint32_t value) {
+  char buffer[10];
+  size_t length = 0;
+  do {
+    buffer[length++] = static_cast<char>('0' + value % 10);
+    value /= 10;
+  } while (value);
+  while (length)
+    output += buffer[--length];
+}
+
+// Finds the ':' separating the host from the port, the colons of an IPv6 address don't count.
+size_t FindPortDelimiter(std::string_view host_and_port) {
+  bool inside_brackets = false;
+  for (size_t i = 0; i < host_and_port.size(); i++) {
+    char c = host_and_port[i];
+    if (c == '[')
+      inside_brackets = true;
+    else if (c == ']')
+      inside_brackets = false;
+    else if (c == ':' && !inside_brackets)
+      return i;
+  }
+  return std::string_view::npos;
+}
+
+// Decodes one UTF-8 sequence at |p|, returns the number of valid bytes consumed with |code_point| set to -1 when
+// the sequence is invalid.
+size_t DecodeUTF8(const uint8_t* p, size_t length, int32_t& code_point) {
+  uint8_t c = p[0];
+  code_point = -1;
+  if (c < 0x80) {
+    code_point = c;
+    return 1;
+  }
+  size_t needed;
+  uint32_t value;
+  uint8_t lower = 0x80, upper = 0xbf;
+  if (c >= 0xc2 && c <= 0xdf) {
+    needed = 1;
+    value = c & 0x1f;
+  } else if (c >= 0xe0 && c <= 0xef) {
+    needed = 2;
+    value = c & 0xf;
+    if (c == 0xe0)
+      lower = 0xa0;
+    else if (c == 0xed)
+      upper = 0x9f;
+  } else if (c >= 0xf0 && c <= 0xf4) {
+    needed = 3;
+    value = c & 0x7;
+    if (c == 0xf0)
+      lower = 0x90;
+    else if (c == 0xf4)
+      upper = 0x8f;
+  } else {
+    return 1;
+  }
+  for (size_t i = 1; i <= needed; i++) {
+    if (i >= length || p[i] < lower || p[i] > upper)
+      return i;
+    value = (value << 6) | (p[i] & 0x3f);
+    lower = 0x80;
+    upper = 0xbf;
+  }
+  code_point = static_cast<int32_t>(value);
+  return needed + 1;
+}
+
+std::string PercentDecode(std::string_view input) {
+  std::string output;
+  output.reserve(input.size());
+  for (size_t i = 0; i < input.size(); i++) {
+    int high, low;
+    if (input[i] == '%' && i + 2 < input.size() && (high = HexValue(input[i + 1])) >= 0 &&
+        (low = HexValue(input[i + 2])) >= 0) {
+      output += static_cast<char>(high << 4 | low);
+      i += 2;
+    } else {
+      output += input[i];
+    }
+  }
+  return output;
+}
+
+// https://datatracker.ietf.org/doc/html/rfc3492#section-6.3
+bool AppendPunycode(std::string& output, const std::vector<uint32_t>& input) {
+  constexpr uint32_t kBase = 36, kTMin = 1, kTMax = 26, kSkew = 38, kDamp = 700;
+  auto adapt = [](uint32_t delta, uint32_t points, bool first) {
+    delta = first ? delta / kDamp : delta / 2;
+    delta += delta / points;
+    uint32_t k = 0;
+    while (delta > ((kBase - kTMin) * kTMax) / 2) {
+      delta /= kBase - kTMin;
+      k += kBase;
+    }
+    return k + (kBase - kTMin + 1) * delta / (delta + kSkew);
+  };
+  auto digit = [](uint32_t d) { return static_cast<char>(d < 26 ? 'a' + d : '0' + d - 26); };
+
+  uint32_t basic = 0;
+  for (uint32_t c : input) {
+    if (c < 0x80) {
+      output += static_cast<char>(c);
+      basic++;
+    }
+  }
+  if (basic > 0)
+    output += '-';
+
+  uint32_t n = 0x80, delta = 0, bias = 72, handled = basic;
+  while (handled < input.size()) {
+    uint32_t m = UINT32_MAX;
+    for (uint32_t c : input) {
+      if (c >= n && c < m)
+        m = c;
+    }
+    if ((m - n) > (UINT32_MAX - delta) / (handled + 1))
+      return false;
+    delta += (m - n) * (handled + 1);
+    n = m;
+    for (uint32_t c : input) {
+      if (c < n && ++delta == 0)
+        return false;
+      if (c != n)
+        continue;
+      uint32_t q = delta;
+      for (uint32_t k = kBase;; k += kBase) {
+        uint32_t t = k <= bias ? kTMin : k >= bias + kTMax ? kTMax : k - bias;
+        if (q < t)
+          break;
+        output += digit(t + (q - t) % (kBase - t));
+        q = (q - t) / (kBase - t);
+      }
+      output += digit(q);
+      bias = adapt(delta, handled + 1, handled == basic);
+      delta = 0;
+      handled++;
+    }
+    delta++;
+    n++;
+  }
+  return true;
+}
+
+// Case folds the code points the domain mapping of UTS #46 commonly applies to, the ASCII and Latin-1 letters.
+uint32_t ToDomainLower(uint32_t c) {
+  if ((c >= 'A' && c <= 'Z') || (c >= 0xc0 && c <= 0xde && c != 0xd7))
+    return c + 0x20;
+  return c;
+}
+
+// https://url.spec.whatwg.org/#concept-domain-to-ascii
+// Non-ASCII labels are lowercased and converted to Punycode, the full UTS #46 mapping table is not applied.
+bool DomainToASCII(std::string_view domain, std::string& output) {
+  std::vector<uint32_t> label;
+  bool label_is_ascii = true;
+  auto flush_label = [&]() {
+    if (label_is_ascii) {
+      for (uint32_t c : label)
+        output += static_cast<char>(c);
+    } else {
+      output += "xn--";
+      if (!AppendPunycode(output, label))
+        return false;
+    }
+    label.clear();
+    label_is_ascii = true;
+    return true;
+  };
+
+  const auto* p = reinterpret_cast<const uint8_t*>(domain.data());
+  size_t i = 0;
+  while (i < domain.size()) {
+    int32_t c;
+    i += DecodeUTF8(p + i, domain.size() - i, c);
+    if (c < 0)
+      return false;
+    // Ideographic and fullwidth full stops are label separators as well.
+    if (c == '.' || c == 0x3002 || c == 0xff0e || c == 0xff61) {
+      if (!flush_label())
+        return false;
+      output += '.';
+      continue;
+    }
+    // Soft hyphens and zero width characters are mapped to nothing.
+    if (c == 0xad || (c >= 0x200b && c <= 0x200d) || c == 0x2060 || c == 0xfeff)
+      continue;
+    // Non-characters and the replacement character are disallowed.
+    if ((c >= 0xfdd0 && c <= 0xfdef) || (c & 0xfffe) == 0xfffe || c == 0xfffd)
+      return false;
+    // Fullwidth forms map to ASCII, the no-break and ideographic spaces map to a space.
+    if (c >= 0xff01 && c <= 0xff5e)
+      c -= 0xfee0;
+    else if (c == 0xa0 || c == 0x3000)
+      c = ' ';
+    label.push_back(ToDomainLower(c));
+    label_is_ascii &= c < 0x80;
+  }
+  return flush_label();
+}
+
+// An ACE prefix without any encoded label can't be decoded.
+bool HasEmptyPunycodeLabel(std::string_view domain) {
+  for (size_t start = 0; start <= domain.size();) {
+    size_t end = std::min(domain.find('.', start), domain.size());
+    if (domain.substr(start, end - start) == "xn--")
+      return true;
+    start = end + 1;
+  }
+  return false;
+}
+
+// https://url.spec.whatwg.org/#forbidden-host-code-point
+bool IsForbiddenHostCodePoint(char c) {
+  switch (c) {
+    case '\0':
+    case '\t':
+    case '\n':
+    case '\r':
+    case ' ':
+    case '#':
+    case '/':
+    case ':':
+    case '<':
+    case '>':
+    case '?':
+    case '@':
+    case '[':
+    case '\\':
+    case ']':
+    case '^':
+    case '|':
+      return true;
+  }
+  return false;
+}
+
+bool IsForbiddenDomainCodePoint(char c) {
+  auto u = static_cast<uint8_t>(c);
+  return IsForbiddenHostCodePoint(c) || u <= 0x1f || c == '%' || u == 0x7f;
+}
+
+// https://url.spec.whatwg.org/#ipv4-number-parser
+bool ParseIPv4Number(std::string_view input, uint64_t& number) {
+  if (input.empty())
+    return false;
+  int radix = 10;
+  if (input.size() >= 2 && input[0] == '0' && (input[1] | 0x20) == 'x') {
+    input.remove_prefix(2);
+    radix = 16;
+  } else if (input.size() >= 2 && input[0] == '0') {
+    input.remove_prefix(1);
+    radix = 8;
+  }
+  number = 0;
+  for (char c : input) {
+    int digit = HexValue(c);
+    if (digit < 0 || digit >= radix)
+      return false;
+    // Saturate, anything above 2^32 is out of range anyway.
+    number = std::min<uint64_t>(number * radix + digit, uint64_t(1) << 40);
+  }
+  return true;
+}
+
+// https://url.spec.whatwg.org/#ends-in-a-number-checker
+bool EndsInANumber(std::string_view host) {
+  if (!host.empty() && host.back() == '.') {
+    host.remove_suffix(1);
+    if (host.empty())
+      return false;
+  }
+  size_t dot = host.rfind('.');
+  std::string_view last = dot == std::string_view::npos ? host : host.substr(dot + 1);
+  if (last.empty())
+    return false;
+  if (std::all_of(last.begin(), last.end(), IsASCIIDigit))
+    return true;
+  uint64_t number;
+  return ParseIPv4Number(last, number);
+}
+
+// https://url.spec.whatwg.org/#concept-ipv4-parser
+bool ParseIPv4(std::string_view input, std::string& output) {
+  if (!input.empty() && input.back() == '.')
+    input.remove_suffix(1);
+  uint64_t numbers[4];
+  size_t count = 0;
+  while (true) {
+    size_t dot = input.find('.');
+    if (count == 4 || !ParseIPv4Number(input.substr(0, dot), numbers[count]))
+      return false;
+    count++;
+    if (dot == std::string_view::npos)
+      break;
+    input.remove_prefix(dot + 1);
+  }
+  for (size_t i = 0; i + 1 < count; i++) {
+    if (numbers[i] > 255)
+      return false;
+  }
+  if (numbers[count - 1] >= (uint64_t(1) << (8 * (5 - count))))
+    return false;
+  uint64_t address = numbers[count - 1];
+  for (size_t i = 0; i + 1 < count; i++) {
+    address += numbers[i] << (8 * (3 - i));
+  }
+  for (int i = 3; i >= 0; i--) {
+    AppendNumber(output, (address >> (8 * i)) & 0xff);
+    if (i)
+      output += '.';
+  }
+  return true;
+}
+
+// https://url.spec.whatwg.org/#concept-ipv6-parser
+bool ParseIPv6(std::string_view input, std::string& output) {
+  uint16_t address[8] = {0};
+  int piece_index = 0;
+  int compress = -1;
+  size_t pointer = 0;
+  auto at = [&](size_t i) { return i < input.size() ? input[i] : '\0'; };
+
+  if (at(pointer) == ':') {
+    if (at(pointer + 1) != ':')
+      return false;
+    pointer += 2;
+    compress = ++piece_index;
+  }
+  while (pointer < input.size()) {
+    if (piece_index == 8)
+      return false;
+    if (input[pointer] == ':') {
+      if (compress != -1)
+        return false;
+      pointer++;
+      compress = ++piece_index;
+      continue;
+    }
+    uint32_t value = 0;
+    size_t length = 0;
+    while (length < 4 && HexValue(at(pointer)) >= 0) {
+      value = value * 0x10 + HexValue(at(pointer));
+      pointer++;
+      length++;
+    }
+    if (at(pointer) == '.') {
+      if (length == 0)
+        return false;
+      pointer -= length;
+      if (piece_index > 6)
+        return false;
+      int numbers_seen = 0;
+      while (pointer < input.size()) {
+        int ipv4_piece = -1;
+        if (numbers_seen > 0) {
+          if (input[pointer] == '.' && numbers_seen < 4)
+            pointer++;
+          else
+            return false;
+        }
+        if (!IsASCIIDigit(at(pointer)))
+          return false;
+        while (IsASCIIDigit(at(pointer))) {
+          int number = at(pointer) - '0';
+          if (ipv4_piece == -1)
+            ipv4_piece = number;
+          else if (ipv4_piece == 0)
+            return false;
+          else
+            ipv4_piece = ipv4_piece * 10 + number;
+          if (ipv4_piece > 255)
+            return false;
+          pointer++;
+        }
+        address[piece_index] = address[piece_index] * 0x100 + ipv4_piece;
+        numbers_seen++;
+        if (numbers_seen == 2 || numbers_seen == 4)
+          piece_index++;
+      }
+      if (numbers_seen != 4)
+        return false;
+      break;
+    } else if (at(pointer) == ':') {
+      pointer++;
+      if (pointer == input.size())
+        return false;
+    } else if (pointer < input.size()) {
+      return false;
+    }
+    address[piece_index++] = value;
+  }
+  if (compress != -1) {
+    int swaps = piece_index - compress;
+    piece_index = 7;
+    while (piece_index != 0 && swaps > 0) {
+      std::swap(address[piece_index], address[compress + swaps - 1]);
+      piece_index--;
+      swaps--;
+    }
+  } else if (piece_index != 8) {
+    return false;
+  }
+
+  // https://url.spec.whatwg.org/#concept-ipv6-serializer
+  int longest_start = -1, longest_length = 1;
+  for (int i = 0; i < 8;) {
+    int j = i;
+    while (j < 8 && address[j] == 0)
+      j++;
+    if (j - i > longest_length) {
+      longest_start = i;
+      longest_length = j - i;
+    }
+    i = j == i ? i + 1 : j;
+  }
+  output += '[';
+  for (int i = 0; i < 8; i++) {
+    if (i == longest_start) {
+      output += i == 0 ? "::" : ":";
+      i += longest_length - 1;
+      continue;
+    }
+    char buffer[4];
+    int length = 0;
+    uint16_t piece = address[i];
+    do {
+      buffer[length++] = static_cast<char>(piece % 16 < 10 ? '0' + piece % 16 : 'a' + piece % 16 - 10);
+      piece /= 16;
+    } while (piece);
+    while (length)
+      output += buffer[--length];
+    if (i != 7)
+      output += ':';
+  }
+  output += ']';
+  return true;
+}
+
+// https://url.spec.whatwg.org/#concept-host-parser
+bool ParseHost(std::string_view input, bool is_opaque, std::string& output) {
+  if (!input.empty() && input[0] == '[') {
+    if (input.back() != ']')
+      return false;
+    return ParseIPv6(input.substr(1, input.size() - 2), output);
+  }
+
+  // https://url.spec.whatwg.org/#concept-opaque-host-parser
+  if (is_opaque) {
+    for (char c : input) {
+      if (IsForbiddenHostCodePoint(c))
+        return false;
+    }
+    AppendPercentEncoded(output, input, kC0ControlSet);
+    return true;
+  }
+
+  size_t host_start = output.size();
+  bool simple = std::none_of(input.begin(), input.end(), [](char c) { return c == '%' || (c & 0x80); });
+  if (simple) {
+    for (char c : input)
+      output += ToASCIILower(c);
+  } else if (!DomainToASCII(PercentDecode(input), output)) {
+    output.resize(host_start);
+    return false;
+  }
+
+  std::string_view domain(output.data() + host_start, output.size() - host_start);
+  if (domain.empty() || std::any_of(domain.begin(), domain.end(), IsForbiddenDomainCodePoint) ||
+      HasEmptyPunycodeLabel(domain)) {
+    output.resize(host_start);
+    return false;
+  }
+  if (EndsInANumber(domain)) {
+    std::string address;
+    if (!ParseIPv4(domain, address)) {
+      output.resize(host_start);
+      return false;
+    }
+    output.replace(host_start, std::string::npos, address);
+  }
+  return true;
+}
+
+// The URL parser ignores ASCII tabs and newlines anywhere in the input, |storage| holds the copy without them.
+std::string_view RemoveTabAndNewline(std::string_view input, std::string& storage) {
+  auto is_tab_or_newline = [](char c) { return c == '\t' || c == '\n' || c == '\r'; };
+  if (std::none_of(input.begin(), input.end(), is_tab_or_newline))
+    return input;
+  storage.reserve(input.size());
+  std::remove_copy_if(input.begin(), input.end(), std::back_inserter(storage), is_tab_or_newline);
+  return storage;
+}
+
+// https://url.spec.whatwg.org/#shorten-a-urls-path
+// The path is serialized in |output| from |path_start|, every segment is preceded by a '/'.
+void ShortenPath(std::string& output, size_t path_start, bool is_file) {
+  if (output.size() == path_start)
+    return;
+  size_t last_slash = output.rfind('/');
+  if (is_file && last_slash == path_start &&
+      IsNormalizedWindowsDriveLetter(std::string_view(output).substr(path_start + 1)))
+    return;
+  output.resize(last_slash);
+}
+
+// Runs the path state of the URL parser on |input| and appends the segments to the path serialized in |output|.
+// Returns the number of bytes consumed, the path stops at the query or the fragment unless parsing the value of
+// the pathname setter.
+size_t AppendPath(std::string& output,
+                  size_t path_start,
+                  std::string_view input,
+                  bool special,
+                  bool is_file,
+                  bool state_override) {
+  size_t pointer = 0;
+  while (true) {
+    size_t end = pointer;
+    while (end < input.size() && !IsSlash(input[end], special) &&
+           (state_override || (input[end] != '?' && input[end] != '#'))) {
+      end++;
+    }
+    std::string_view segment = input.substr(pointer, end - pointer);
+    bool last_segment = end == input.size() || !IsSlash(input[end], special);
+    if (IsDoubleDotSegment(segment)) {
+      ShortenPath(output, path_start, is_file);
+      if (last_segment)
+        output += '/';
+    } else if (IsSingleDotSegment(segment)) {
+      if (last_segment)
+        output += '/';
+    } else if (is_file && output.size() == path_start && IsWindowsDriveLetter(segment)) {
+      output += '/';
+      output += segment[0];
+      output += ':';
+    } else {
+      output += '/';
+      AppendPercentEncoded(output, segment, kPathSet);
+    }
+    if (last_segment)
+      return end;
+    pointer = end + 1;
+  }
+}
+
+}  // namespace
+
+struct URLRecord::Components {
+  std::string scheme;
+  std::string username;
+  std::string password;
+  bool has_host{false};
+  std::string host;
+  int32_t port{-1};
+  std::string path;
+  bool has_query{false};
+  std::string query;
+  bool has_fragment{false};
+  std::string fragment;
+};
+
+// The URL parser, https://url.spec.whatwg.org/#concept-basic-url-parser, for parsing without a state override.
+// The canonical components are appended to the href of the record being built in order.
+class URLParser {
+ public:
+  explicit URLParser(URLRecord& url) : url_(url), out_(url.href_) {}
+
+  bool Parse(std::string_view input, const URLRecord* base) {
+    out_.reserve(input.size() + 8);
+    size_t scheme_end = 0;
+    if (!input.empty() && IsASCIIAlpha(input[0])) {
+      scheme_end = 1;
+      while (scheme_end < input.size() && (IsASCIIAlpha(input[scheme_end]) || IsASCIIDigit(input[scheme_end]) ||
+                                           input[scheme_end] == '+' || input[scheme_end] == '-' ||
+                                           input[scheme_end] == '.')) {
+        scheme_end++;
+      }
+      if (scheme_end == input.size() || input[scheme_end] != ':')
+        scheme_end = 0;
+    }
+
+    if (scheme_end == 0)
+      return ParseWithoutScheme(input, base);
+
+    for (size_t i = 0; i < scheme_end; i++) {
+      out_ += ToASCIILower(input[i]);
+    }
+    out_ += ':';
+    SetProtocolEnd();
+    std::string_view rest = input.substr(scheme_end + 1);
+    std::string_view scheme = url_.scheme();
+
+    if (scheme == "file")
+      return ParseFile(rest, base && base->scheme() == "file" ? base : nullptr);
+    if (url_.is_special_) {
+      if (base && base->scheme() == scheme)
+        return ParseRelative(rest, *base);
+      return ParseAuthority(SkipSlashes(rest));
+    }
+    if (rest.size() >= 2 && rest[0] == '/' && rest[1] == '/')
+      return ParseAuthority(rest.substr(2));
+    if (!rest.empty() && rest[0] == '/')
+      return ParsePathAndAfter(rest.substr(1));
+    return ParseOpaquePath(rest);
+  }
+
+ private:
+  void SetProtocolEnd() {
+    url_.protocol_end_ = url_.username_end_ = url_.host_end_ = url_.pathname_start_ = out_.size();
+    url_.is_special_ = IsSpecialScheme(url_.scheme());
+  }
+
+  std::string_view SkipSlashes(std::string_view input) {
+    size_t i = 0;
+    while (i < input.size() && IsSlash(input[i], true))
+      i++;
+    return input.substr(i);
+  }
+
+  bool ParseWithoutScheme(std::string_view input, const URLRecord* base) {
+    if (!base)
+      return false;
+    if (base->has_opaque_path_) {
+      if (input.empty() || input[0] != '#')
+        return false;
+      CopyFrom(*base, base->hash_start_ == URLRecord::kOmitted ? base->href_.size() : base->hash_start_);
+      return ParseQueryAndFragment(input);
+    }
+    out_.append(base->href_, 0, base->protocol_end_);
+    SetProtocolEnd();
+    if (base->scheme() == "file")
+      return ParseFile(input, base);
+    return ParseRelative(input, *base);
+  }
+
+  // Copies the serialization of |base| up to |end|, |base| must have the same scheme as the URL being parsed.
+  void CopyFrom(const URLRecord& base, size_t end) {
+    out_.assign(base.href_, 0, end);
+    url_.protocol_end_ = base.protocol_end_;
+    url_.username_end_ = base.username_end_;
+    url_.host_start_ = base.host_start_;
+    url_.host_end_ = base.host_end_;
+    url_.port_ = base.port_;
+    url_.pathname_start_ = base.pathname_start_;
+    url_.is_special_ = base.is_special_;
+    url_.has_opaque_path_ = base.has_opaque_path_;
+    if (base.search_start_ < end)
+      url_.search_start_ = base.search_start_;
+  }
+
+  size_t PathEnd(const URLRecord& url) {
+    if (url.search_start_ != URLRecord::kOmitted)
+      return url.search_start_;
+    if (url.hash_start_ != URLRecord::kOmitted)
+      return url.hash_start_;
+    return url.href_.size();
+  }
+
+  // Copies the scheme, the credentials, the host and the port of |base|.
+  void CopyAuthority(const URLRecord& base) {
+    if (base.HasHost()) {
+      CopyFrom(base, base.pathname_start_);
+    } else {
+      CopyFrom(base, base.protocol_end_);
+    }
+    url_.pathname_start_ = out_.size();
+  }
+
+  void CopyPath(const URLRecord& base) {
+    out_.append(base.href_, base.pathname_start_, PathEnd(base) - base.pathname_start_);
+  }
+
+  // https://url.spec.whatwg.org/#relative-state
+  bool ParseRelative(std::string_view input, const URLRecord& base) {
+    bool special = url_.is_special_;
+    if (input.empty()) {
+      CopyFrom(base, base.hash_start_ == URLRecord::kOmitted ? base.href_.size() : base.hash_start_);
+      return Finish();
+    }
+    if (IsSlash(input[0], special)) {
+      if (input.size() > 1 && IsSlash(input[1], special))
+        return ParseAuthority(special ? SkipSlashes(input) : input.substr(2));
+      CopyAuthority(base);
+      return ParsePathAndAfter(input.substr(1));
+    }
+    CopyAuthority(base);
+    CopyPath(base);
+    if (input[0] == '?' || input[0] == '#') {
+      if (input[0] == '#' && base.HasQuery()) {
+        url_.search_start_ = out_.size();
+        out_.append(base.href_, base.search_start_,
+                    (base.hash_start_ == URLRecord::kOmitted ? base.href_.size() : base.hash_start_) -
+                        base.search_start_);
+      }
+      return ParseQueryAndFragment(input);
+    }
+    ShortenPath(out_, url_.pathname_start_, false);
+    return ParsePathAndAfter(input);
+  }
+
+  // https://url.spec.whatwg.org/#authority-state
+  bool ParseAuthority(std::string_view input) {
+    bool special = url_.is_special_;
+    size_t end = 0;
+    while (end < input.size() && !IsSlash(input[end], special) && input[end] != '?' && input[end] != '#')
+      end++;
+    std::string_view authority = input.substr(0, end);
+
+    out_ += "//";
+    size_t username_start = out_.size();
+    size_t at_sign = authority.rfind('@');
+    if (at_sign != std::string_view::npos) {
+      std::string_view userinfo = authority.substr(0, at_sign);
+      size_t colon = userinfo.find(':');
+      AppendPercentEncoded(out_, userinfo.substr(0, colon), kUserinfoSet);
+      url_.username_end_ = out_.size();
+      if (colon != std::string_view::npos && colon + 1 < userinfo.size()) {
+        out_ += ':';
+        AppendPercentEncoded(out_, userinfo.substr(colon + 1), kUserinfoSet);
+      }
+      if (out_.size() != username_start)
+        out_ += '@';
+      authority.remove_prefix(at_sign + 1);
+      if (authority.empty())
+        return false;
+    } else {
+      url_.username_end_ = out_.size();
+    }
+
+    url_.host_start_ = out_.size();
+    size_t colon = FindPortDelimiter(authority);
+    std::string_view hostname = authority.substr(0, colon);
+    if (hostname.empty() && (special || colon != std::string_view::npos))
+      return false;
+    if (!ParseHost(hostname, !special, out_))
+      return false;
+    url_.host_end_ = out_.size();
+
+    if (colon != std::string_view::npos) {
+      std::string_view port = authority.substr(colon + 1);
+      if (!std::all_of(port.begin(), port.end(), IsASCIIDigit))
+        return false;
+      if (!port.empty()) {
+        int32_t number = ParsePortNumber(port);
+        if (number < 0)
+          return false;
+        if (number != DefaultPortForScheme(url_.scheme())) {
+          url_.port_ = number;
+          out_ += ':';
+          AppendNumber(out_, number);
+        }
+      }
+    }
+    url_.pathname_start_ = out_.size();
+    return ParsePathStart(input.substr(end));
+  }
+
+  // https://url.spec.whatwg.org/#path-start-state
+  bool ParsePathStart(std::string_view input) {
+    if (!input.empty() && IsSlash(input[0], url_.is_special_))
+      return ParsePathAndAfter(input.substr(1));
+    if (url_.is_special_)
+      return ParsePathAndAfter(input);
+    return ParseQueryAndFragment(input);
+  }
+
+  // https://url.spec.whatwg.org/#file-state
+  bool ParseFile(std::string_view input, const URLRecord* base) {
+    out_ += "//";
+    url_.username_end_ = url_.host_start_ = url_.host_end_ = url_.pathname_start_ = out_.size();
+
+    if (!input.empty() && IsSlash(input[0], true)) {
+      if (input.size() > 1 && IsSlash(input[1], true)) {
+        // https://url.spec.whatwg.org/#file-host-state
+        input.remove_prefix(2);
+        size_t end = 0;
+        while (end < input.size() && !IsSlash(input[end], true) && input[end] != '?' && input[end] != '#')
+          end++;
+        std::string_view host = input.substr(0, end);
+        if (IsWindowsDriveLetter(host))
+          return ParsePathAndAfter(input);
+        if (!host.empty()) {
+          if (!ParseHost(host, false, out_))
+            return false;
+          if (std::string_view(out_).substr(url_.host_start_) == "localhost")
+            out_.resize(url_.host_start_);
+          url_.host_end_ = url_.pathname_start_ = out_.size();
+        }
+        return ParsePathStart(input.substr(end));
+      }
+      // https://url.spec.whatwg.org/#file-slash-state
+      if (base) {
+        CopyAuthority(*base);
+        std::string_view base_path = std::string_view(base->href_).substr(base->pathname_start_);
+        size_t first_segment_end = base_path.find_first_of("/?#", 1);
+        std::string_view first_segment = base_path.substr(0, first_segment_end);
+        if (!StartsWithWindowsDriveLetter(input.substr(1)) && first_segment.size() == 3 &&
+            IsNormalizedWindowsDriveLetter(first_segment.substr(1))) {
+          out_.append(first_segment);
+        }
+      }
+      return ParsePathAndAfter(input.substr(1));
+    }
+
+    if (base) {
+      CopyAuthority(*base);
+      CopyPath(*base);
+      if ((input.empty() || input[0] == '#') && base->HasQuery()) {
+        url_.search_start_ = out_.size();
+        out_.append(base->href_, base->search_start_,
+                    (base->hash_start_ == URLRecord::kOmitted ? base->href_.size() : base->hash_start_) -
+                        base->search_start_);
+      }
+      if (input.empty())
+        return Finish();
+      if (input[0] == '?' || input[0] == '#')
+        return ParseQueryAndFragment(input);
+      if (StartsWithWindowsDriveLetter(input))
+        out_.resize(url_.pathname_start_);
+      else
+        ShortenPath(out_, url_.pathname_start_, true);
+    }
+    return ParsePathAndAfter(input);
+  }
+
+  // https://url.spec.whatwg.org/#cannot-be-a-base-url-path-state
+  bool ParseOpaquePath(std::string_view input) {
+    url_.has_opaque_path_ = true;
+    size_t end = input.find_first_of("?#");
+    AppendPercentEncoded(out_, input.substr(0, end), kC0ControlSet);
+    return ParseQueryAndFragment(end == std::string_view::npos ? std::string_view() : input.substr(end));
+  }
+
+  bool ParsePathAndAfter(std::string_view input) {
+    size_t consumed =
+        AppendPath(out_, url_.pathname_start_, input, url_.is_special_, url_.scheme() == "file", false);
+    return ParseQueryAndFragment(input.substr(consumed));
+  }
+
+  // https://url.spec.whatwg.org/#query-state
+  bool ParseQueryAndFragment(std::string_view input) {
+    if (!input.empty() && input[0] == '?') {
+      size_t end = input.find('#');
+      url_.search_start_ = out_.size();
+      out_ += '?';
+      AppendPercentEncoded(out_, input.substr(1, end == std::string_view::npos ? end : end - 1),
+                           url_.is_special_ ? kSpecialQuerySet : kQuerySet);
+      input = end == std::string_view::npos ? std::string_view() : input.substr(end);
+    }
+    if (!input.empty() && input[0] == '#') {
+      url_.hash_start_ = out_.size();
+      out_ += '#';
+      AppendPercentEncoded(out_, input.substr(1), kFragmentSet);
+    }
+    return Finish();
+  }
+
+  bool Finish() {
+    // https://url.spec.whatwg.org/#url-serializing
+    // A path starting with an empty segment would be read back as an authority without the "/." prefix.
+    size_t path_start = url_.pathname_start_;
+    if (!url_.HasHost() && !url_.has_opaque_path_ && path_start == url_.protocol_end_ &&
+        out_.size() > path_start + 1 && out_[path_start] == '/' && out_[path_start + 1] == '/') {
+      out_.insert(path_start, "/.");
+      url_.pathname_start_ += 2;
+      if (url_.search_start_ != URLRecord::kOmitted)
+        url_.search_start_ += 2;
+      if (url_.hash_start_ != URLRecord::kOmitted)
+        url_.hash_start_ += 2;
+    }
+    return true;
+  }
+
+  URLRecord& url_;
+  std::string& out_;
+};
+
+bool URLRecord::Parse(std::string_view input, const URLRecord* base) {
+  // Strip the leading and trailing C0 controls and spaces.
+  size_t start = 0, end = input.size();
+  while (start < end && static_cast<uint8_t>(input[start]) <= 0x20)
+    start++;
+  while (end > start && static_cast<uint8_t>(input[end - 1]) <= 0x20)
+    end--;
+  std::string stripped;
+  input = RemoveTabAndNewline(input.substr(start, end - start), stripped);
+
+  URLRecord url;
+  URLParser parser(url);
+  if (!parser.Parse(input, base))
+    return false;
+  *this = std::move(url);
+  return true;
+}
+
+std::string_view URLRecord::username() const {
+  if (!HasHost())
+    return {};
+  return std::string_view(href_).substr(protocol_end_ + 2, username_end_ - protocol_end_ - 2);
+}
+
+std::string_view URLRecord::password() const {
+  if (!HasHost() || username_end_ == host_start_ || href_[username_end_] != ':')
+    return {};
+  return std::string_view(href_).substr(username_end_ + 1, host_start_ - username_end_ - 2);
+}
+
+bool URLRecord::HasCredentials() const {
+  return HasHost() && host_start_ != protocol_end_ + 2;
+}
+
+std::string_view URLRecord::hostname() const {
+  if (!HasHost())
+    return {};
+  return std::string_view(href_).substr(host_start_, host_end_ - host_start_);
+}
+
+std::string_view URLRecord::host() const {
+  if (!HasHost())
+    return {};
+  return std::string_view(href_).substr(host_start_, pathname_start_ - host_start_);
+}
+
+std::string_view URLRecord::port() const {
+  if (port_ < 0)
+    return {};
+  return std::string_view(href_).substr(host_end_ + 1, pathname_start_ - host_end_ - 1);
+}
+
+std::string_view URLRecord::pathname() const {
+  size_t end = search_start_ != kOmitted ? search_start_ : hash_start_ != kOmitted ? hash_start_ : href_.size();
+  return std::string_view(href_).substr(pathname_start_, end - pathname_start_);
+}
+
+std::string_view URLRecord::query() const {
+  if (search_start_ == kOmitted)
+    return {};
+  size_t end = hash_start_ != kOmitted ? hash_start_ : href_.size();
+  return std::string_view(href_).substr(search_start_ + 1, end - search_start_ - 1);
+}
+
+std::string_view URLRecord::search() const {
+  if (query().empty())
+    return {};
+  return std::string_view(href_).substr(search_start_, query().size() + 1);
+}
+
+std::string_view URLRecord::hash() const {
+  if (hash_start_ == kOmitted || hash_start_ + 1 == href_.size())
+    return {};
+  return std::string_view(href_).substr(hash_start_);
+}
+
+// https://url.spec.whatwg.org/#concept-url-origin
+std::string URLRecord::origin() const {
+  std::string_view scheme = this->scheme();
+  if (scheme == "blob") {
+    URLRecord path_url;
+    if (path_url.Parse(pathname()) && (path_url.scheme() == "http" || path_url.scheme() == "https"))
+      return path_url.origin();
+    return "null";
+  }
+  if (scheme == "file" || !is_special_)
+    return "null";
+  std::string result(scheme);
+  result += "://";
+  result += host();
+  return result;
+}
+
+URLRecord::Components URLRecord::ToComponents() const {
+  Components components;
+  components.scheme = scheme();
+  components.username = username();
+  components.password = password();
+  components.has_host = HasHost();
+  components.host = hostname();
+  components.port = port_;
+  components.path = pathname();
+  components.has_query = HasQuery();
+  components.query = query();
+  components.has_fragment = hash_start_ != kOmitted;
+  if (components.has_fragment)
+    components.fragment = href_.substr(hash_start_ + 1);
+  return components;
+}
+
+// https://url.spec.whatwg.org/#concept-url-serializer
+void URLRecord::Assign(const Components& c) {
+  href_.clear();
+  href_ += c.scheme;
+  href_ += ':';
+  protocol_end_ = username_end_ = host_end_ = href_.size();
+  host_start_ = search_start_ = hash_start_ = kOmitted;
+  is_special_ = IsSpecialScheme(c.scheme);
+  port_ = c.has_host ? c.port : -1;
+
+  if (c.has_host) {
+    href_ += "//";
+    href_ += c.username;
+    username_end_ = href_.size();
+    if (!c.password.empty()) {
+      href_ += ':';
+      href_ += c.password;
+    }
+    if (!c.username.empty() || !c.password.empty())
+      href_ += '@';
+    host_start_ = href_.size();
+    href_ += c.host;
+    host_end_ = href_.size();
+    if (port_ >= 0) {
+      href_ += ':';
+      AppendNumber(href_, port_);
+    }
+  } else if (!has_opaque_path_ && c.path.size() > 1 && c.path[0] == '/' && c.path[1] == '/') {
+    href_ += "/.";
+  }
+  pathname_start_ = href_.size();
+  href_ += c.path;
+  if (c.has_query) {
+    search_start_ = href_.size();
+    href_ += '?';
+    href_ += c.query;
+  }
+  if (c.has_fragment) {
+    hash_start_ = href_.size();
+    href_ += '#';
+    href_ += c.fragment;
+  }
+}
+
+// https://url.spec.whatwg.org/#potentially-strip-trailing-spaces-from-an-opaque-path
+void URLRecord::StripTrailingSpacesFromOpaquePath() {
+  if (!has_opaque_path_ || hash_start_ != kOmitted || search_start_ != kOmitted)
+    return;
+  while (href_.size() > pathname_start_ && href_.back() == ' ')
+    href_.pop_back();
+}
+
+void URLRecord::SetProtocol(std::string_view value) {
+  std::string stripped;
+  value = RemoveTabAndNewline(value, stripped);
+  size_t end = 0;
+  if (value.empty() || !IsASCIIAlpha(value[0]))
+    return;
+  while (end < value.size() && (IsASCIIAlpha(value[end]) || IsASCIIDigit(value[end]) || value[end] == '+' ||
+                                value[end] == '-' || value[end] == '.')) {
+    end++;
+  }
+  if (end < value.size() && value[end] != ':')
+    return;
+
+  std::string scheme;
+  for (size_t i = 0; i < end; i++)
+    scheme += ToASCIILower(value[i]);
+  if (IsSpecialScheme(scheme) != is_special_)
+    return;
+  if ((HasCredentials() || port_ >= 0) && scheme == "file")
+    return;
+  if (this->scheme() == "file" && hostname().empty())
+    return;
+
+  Components components = ToComponents();
+  components.scheme = std::move(scheme);
+  if (components.port == DefaultPortForScheme(components.scheme))
+    components.port = -1;
+  Assign(components);
+}
+
+void URLRecord::SetUsername(std::string_view value) {
+  if (hostname().empty() || scheme() == "file")
+    return;
+  Components components = ToComponents();
+  components.username.clear();
+  AppendPercentEncoded(components.username, value, kUserinfoSet);
+  Assign(components);
+}
+
+void URLRecord::SetPassword(std::string_view value) {
+  if (hostname().empty() || scheme() == "file")
+    return;
+  Components components = ToComponents();
+  components.password.clear();
+  AppendPercentEncoded(components.password, value, kUserinfoSet);
+  Assign(components);
+}
+
+void URLRecord::SetHost(std::string_view value) {
+  std::string stripped;
+  value = RemoveTabAndNewline(value, stripped);
+  if (has_opaque_path_)
+    return;
+  size_t end = 0;
+  while (end < value.size() && !IsSlash(value[end], is_special_) && value[end] != '?' && value[end] != '#')
+    end++;
+  value = value.substr(0, end);
+
+  Components components = ToComponents();
+  components.host.clear();
+  // https://url.spec.whatwg.org/#file-host-state
+  if (scheme() == "file") {
+    if (!value.empty()) {
+      if (!ParseHost(value, false, components.host))
+        return;
+      if (components.host == "localhost")
+        components.host.clear();
+    }
+    Assign(components);
+    return;
+  }
+
+  size_t colon = FindPortDelimiter(value);
+  std::string_view hostname = value.substr(0, colon);
+  if (hostname.empty() && (is_special_ || colon != std::string_view::npos || HasCredentials() || port_ >= 0))
+    return;
+  if (!ParseHost(hostname, !is_special_, components.host))
+    return;
+  components.has_host = true;
+
+  if (colon != std::string_view::npos) {
+    std::string_view port = value.substr(colon + 1);
+    size_t digits = 0;
+    while (digits < port.size() && IsASCIIDigit(port[digits]))
+      digits++;
+    if (digits > 0) {
+      // The host is still set when the port is out of range.
+      int32_t number = ParsePortNumber(port.substr(0, digits));
+      if (number >= 0)
+        components.port = number == DefaultPortForScheme(components.scheme) ? -1 : number;
+    }
+  }
+  Assign(components);
+}
+
+void URLRecord::SetHostname(std::string_view value) {
+  std::string stripped;
+  value = RemoveTabAndNewline(value, stripped);
+  if (has_opaque_path_)
+    return;
+  size_t end = 0;
+  while (end < value.size() && !IsSlash(value[end], is_special_) && value[end] != '?' && value[end] != '#')
+    end++;
+  value = value.substr(0, end);
+  if (scheme() != "file" && FindPortDelimiter(value) != std::string_view::npos)
+    return;
+  SetHost(value);
+}
+
+void URLRecord::SetPort(std::string_view value) {
+  std::string stripped;
+  value = RemoveTabAndNewline(value, stripped);
+  if (hostname().empty() || scheme() == "file")
+    return;
+  Components components = ToComponents();
+  if (value.empty()) {
+    components.port = -1;
+  } else {
+    size_t digits = 0;
+    while (digits < value.size() && IsASCIIDigit(value[digits]))
+      digits++;
+    if (digits == 0)
+      return;
+    int32_t number = ParsePortNumber(value.substr(0, digits));
+    if (number < 0)
+      return;
+    components.port = number == DefaultPortForScheme(components.scheme) ? -1 : number;
+  }
+  Assign(components);
+}
+
+void URLRecord::SetPathname(std::string_view value) {
+  std::string stripped;
+  value = RemoveTabAndNewline(value, stripped);
+  if (has_opaque_path_)
+    return;
+  Components components = ToComponents();
+  components.path.clear();
+  bool is_file = scheme() == "file";
+  // https://url.spec.whatwg.org/#path-start-state
+  if (!value.empty() && IsSlash(value[0], is_special_)) {
+    AppendPath(components.path, 0, value.substr(1), is_special_, is_file, true);
+  } else if (!value.empty() || is_special_) {
+    AppendPath(components.path, 0, value, is_special_, is_file, true);
+  } else if (!HasHost()) {
+    components.path = "/";
+  }
+  Assign(components);
+}
+
+void URLRecord::SetSearch(std::string_view value) {
+  std::string stripped;
+  value = RemoveTabAndNewline(value, stripped);
+  if (value.empty()) {
+    SetEncodedQuery(nullptr);
+    return;
+  }
+  if (value[0] == '?')
+    value.remove_prefix(1);
+  std::string query;
+  AppendPercentEncoded(query, value, is_special_ ? kSpecialQuerySet : kQuerySet);
+  SetEncodedQuery(&query);
+}
+
+void URLRecord::SetEncodedQuery(const std::string* query) {
+  Components components = ToComponents();
+  components.has_query = query != nullptr;
+  components.query = query ? *query : std::string();
+  Assign(components);
+  if (!query)
+    StripTrailingSpacesFromOpaquePath();
+}
+
+void URLRecord::SetHash(std::string_view value) {
+  std::string stripped;
+  value = RemoveTabAndNewline(value, stripped);
+  Components components = ToComponents();
+  components.has_fragment = !value.empty();
+  components.fragment.clear();
+  if (!value.empty() && value[0] == '#')
+    value.remove_prefix(1);
+  AppendPercentEncoded(components.fragment, value, kFragmentSet);
+  Assign(components);
+  if (!components.has_fragment)
+    StripTrailingSpacesFromOpaquePath();
+}
+
+// https://url.spec.whatwg.org/#concept-urlencoded-byte-serializer
+void AppendFormURLEncoded(std::string& output, std::string_view input) {
+  size_t run_start = 0;
+  for (size_t i = 0; i < input.size(); i++) {
+    if (!InSet(input[i], kFormURLEncodedSet))
+      continue;
+    output.append(input.data() + run_start, i - run_start);
+    if (input[i] == ' ')
+      output += '+';
+    else
+      AppendPercentEncodedByte(output, static_cast<uint8_t>(input[i]));
+    run_start = i + 1;
+  }
+  output.append(input.data() + run_start, input.size() - run_start);
+}
+
+// https://url.spec.whatwg.org/#concept-urlencoded-parser
+std::string FormURLDecode(std::string_view input) {
+  std::string decoded;
+  decoded.reserve(input.size());
+  bool is_ascii = true;
+  for (size_t i = 0; i < input.size(); i++) {
+    char c = input[i];
+    int high, low;
+    if (c == '+') {
+      c = ' ';
+    } else if (c == '%' && i + 2 < input.size() && (high = HexValue(input[i + 1])) >= 0 &&
+               (low = HexValue(input[i + 2])) >= 0) {
+      c = static_cast<char>(high << 4 | low);
+      i += 2;
+    }
+    is_ascii &= !(c & 0x80);
+    decoded += c;
+  }
+  if (is_ascii)
+    return decoded;
+
+  // UTF-8 decode without BOM, the maximal invalid subparts are replaced with U+FFFD.
+  std::string result;
+  result.reserve(decoded.size());
+  const auto* p = reinterpret_cast<const uint8_t*>(decoded.data());
+  size_t i = 0;
+  while (i < decoded.size()) {
+    int32_t code_point;
+    size_t length = DecodeUTF8(p + i, decoded.size() - i, code_point);
+    if (code_point < 0)
+      result += "\xef\xbf\xbd";
+    else
+      result.append(decoded, i, length);
+    i += length;
+  }
+  return result;
+}
+
+}  // namespace webf
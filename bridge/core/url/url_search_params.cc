@@ -0,0 +1,399 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#include "url_search_params.h"
+#include <algorithm>
+#include "bindings/qjs/converter_impl.h"
+#include "bindings/qjs/native_string_utils.h"
+#include "core/executing_context.h"
+#include "qjs_url_search_params.h"
+#include "url.h"
+#include "url_record.h"
+
+namespace webf {
+
+namespace {
+
+bool IsASCII(const std::string& string) {
+  return std::none_of(string.begin(), string.end(), [](char c) { return c & 0x80; });
+}
+
+// The names are sorted by their UTF-16 code units, which is the byte order of UTF-8 except for the supplementary
+// characters compared with U+E000 to U+FFFF.
+bool LessThanInCodeUnitOrder(const std::string& a, const std::string& b) {
+  if (IsASCII(a) && IsASCII(b))
+    return a < b;
+  std::u16string a16, b16;
+  fromUTF8(a, a16);
+  fromUTF8(b, b16);
+  return a16 < b16;
+}
+
+void FreeValues(JSContext* ctx, std::vector<JSValue>& values) {
+  for (JSValue value : values) {
+    JS_FreeValue(ctx, value);
+  }
+  values.clear();
+}
+
+// Collect the values of |iterable| with its @@iterator |method|, as the WebIDL conversion to a sequence does. The
+// values are owned by the caller. Returns false, with no values and the error in |exception_state|, on an abrupt
+// completion.
+bool IterateValues(JSContext* ctx,
+                   JSValue iterable,
+                   JSValue method,
+                   std::vector<JSValue>& values,
+                   ExceptionState& exception_state) {
+  JSValue iterator = JS_Call(ctx, method, iterable, 0, nullptr);
+  if (!JS_IsObject(iterator)) {
+    if (!JS_IsException(iterator))
+      JS_ThrowTypeError(ctx, "Result of the Symbol.iterator method is not an object");
+    JS_FreeValue(ctx, iterator);
+    iterator = JS_EXCEPTION;
+  }
+
+  JSValue next = JS_IsException(iterator) ? JS_EXCEPTION : JS_GetPropertyStr(ctx, iterator, "next");
+  bool success = !JS_IsException(next);
+  while (success) {
+    JSValue result = JS_Call(ctx, next, iterator, 0, nullptr);
+    if (!JS_IsObject(result)) {
+      if (!JS_IsException(result))
+        JS_ThrowTypeError(ctx, "Iterator result is not an object");
+      JS_FreeValue(ctx, result);
+      success = false;
+      break;
+    }
+    JSValue done = JS_GetPropertyStr(ctx, result, "done");
+    int is_done = JS_IsException(done) ? -1 : JS_ToBool(ctx, done);
+    JS_FreeValue(ctx, done);
+    if (is_done != 0) {
+      JS_FreeValue(ctx, result);
+      success = is_done > 0;
+      break;
+    }
+    JSValue value = JS_GetPropertyStr(ctx, result, "value");
+    JS_FreeValue(ctx, result);
+    if (JS_IsException(value)) {
+      success = false;
+      break;
+    }
+    values.push_back(value);
+  }
+  JS_FreeValue(ctx, next);
+  JS_FreeValue(ctx, iterator);
+
+  if (!success) {
+    FreeValues(ctx, values);
+    JSValue exception = JS_GetException(ctx);
+    exception_state.ThrowException(ctx, exception);
+    JS_FreeValue(ctx, exception);
+  }
+  return success;
+}
+
+}  // namespace
+
+URLSearchParams* URLSearchParams::Create(ExecutingContext* context, ExceptionState& exception_state) {
+  return MakeGarbageCollected<URLSearchParams>(context);
+}
+
+URLSearchParams* URLSearchParams::Create(ExecutingContext* context,
+                                         const ScriptValue& init,
+                                         ExceptionState& exception_state) {
+  auto* search_params = MakeGarbageCollected<URLSearchParams>(context);
+  search_params->AppendFromInit(init, exception_state);
+  return search_params;
+}
+
+URLSearchParams::URLSearchParams(ExecutingContext* context, URL* url)
+    : ScriptWrappable(context->ctx()), url_(url) {}
+
+void URLSearchParams::AppendFromInit(const ScriptValue& init, ExceptionState& exception_state) {
+  JSValue value = init.QJSValue();
+  if (JS_IsUndefined(value) || JS_IsNull(value))
+    return;
+
+  if (!JS_IsObject(value)) {
+    std::string query = init.ToString(ctx()).ToStdString(ctx());
+    SetQuery(std::string_view(query).substr(!query.empty() && query[0] == '?' ? 1 : 0));
+    return;
+  }
+
+  // Copying the list is what iterating another URLSearchParams gives, unless the script overrode its iterator.
+  if (QJSURLSearchParams::HasInstance(GetExecutingContext(), value) &&
+      JS_GetOwnProperty(ctx(), nullptr, value, JS_ATOM_Symbol_iterator) == 0) {
+    list_ = toScriptWrappable<URLSearchParams>(value)->list_;
+    return;
+  }
+
+  // A sequence of name-value pairs, that is any object with an @@iterator method: arrays, but also Map,
+  // generators or the entries() of another collection.
+  JSValue method = JS_GetProperty(ctx(), value, JS_ATOM_Symbol_iterator);
+  if (JS_IsException(method)) {
+    JSValue exception = JS_GetException(ctx());
+    exception_state.ThrowException(ctx(), exception);
+    JS_FreeValue(ctx(), exception);
+    return;
+  }
+  if (!JS_IsUndefined(method) && !JS_IsNull(method)) {
+    if (!JS_IsFunction(ctx(), method)) {
+      JS_FreeValue(ctx(), method);
+      exception_state.ThrowException(ctx(), ErrorType::TypeError,
+                                     "Failed to construct 'URLSearchParams': The provided value cannot be converted "
+                                     "to a sequence.");
+      return;
+    }
+    AppendFromSequence(value, method, exception_state);
+    JS_FreeValue(ctx(), method);
+    return;
+  }
+
+  // A record of string keys and values.
+  JSPropertyEnum* properties;
+  uint32_t length;
+  if (JS_GetOwnPropertyNames(ctx(), &properties, &length, value, JS_GPN_STRING_MASK | JS_GPN_ENUM_ONLY) < 0) {
+    JSValue exception = JS_GetException(ctx());
+    exception_state.ThrowException(ctx(), exception);
+    JS_FreeValue(ctx(), exception);
+    return;
+  }
+  for (uint32_t i = 0; i < length && !exception_state.HasException(); i++) {
+    JSValue item = JS_GetProperty(ctx(), value, properties[i].atom);
+    AtomicString item_value = Converter<IDLDOMString>::FromValue(ctx(), item, exception_state);
+    JS_FreeValue(ctx(), item);
+    if (!exception_state.HasException())
+      list_.emplace_back(AtomicString(ctx(), properties[i].atom).ToStdString(ctx()), item_value.ToStdString(ctx()));
+  }
+  for (uint32_t i = 0; i < length; i++) {
+    JS_FreeAtom(ctx(), properties[i].atom);
+  }
+  js_free(ctx(), properties);
+}
+
+void URLSearchParams::AppendFromSequence(JSValue sequence, JSValue method, ExceptionState& exception_state) {
+  std::vector<JSValue> pairs;
+  if (!IterateValues(ctx(), sequence, method, pairs, exception_state))
+    return;
+
+  std::vector<Entry> list;
+  list.reserve(pairs.size());
+  std::vector<JSValue> pair;
+  for (JSValue item : pairs) {
+    JSValue pair_method = JS_IsObject(item) ? JS_GetProperty(ctx(), item, JS_ATOM_Symbol_iterator) : JS_UNDEFINED;
+    if (JS_IsException(pair_method)) {
+      JSValue exception = JS_GetException(ctx());
+      exception_state.ThrowException(ctx(), exception);
+      JS_FreeValue(ctx(), exception);
+      break;
+    }
+    bool is_iterable = JS_IsFunction(ctx(), pair_method);
+    if (is_iterable && !IterateValues(ctx(), item, pair_method, pair, exception_state)) {
+      JS_FreeValue(ctx(), pair_method);
+      break;
+    }
+    JS_FreeValue(ctx(), pair_method);
+    if (!is_iterable || pair.size() != 2) {
+      exception_state.ThrowException(ctx(), ErrorType::TypeError,
+                                     "Failed to construct 'URLSearchParams': Each query pair must be an iterable "
+                                     "[name, value] tuple");
+      break;
+    }
+    AtomicString name = Converter<IDLDOMString>::FromValue(ctx(), pair[0], exception_state);
+    if (exception_state.HasException())
+      break;
+    AtomicString value = Converter<IDLDOMString>::FromValue(ctx(), pair[1], exception_state);
+    if (exception_state.HasException())
+      break;
+    list.emplace_back(name.ToStdString(ctx()), value.ToStdString(ctx()));
+    FreeValues(ctx(), pair);
+  }
+  FreeValues(ctx(), pair);
+  FreeValues(ctx(), pairs);
+
+  if (!exception_state.HasException())
+    list_ = std::move(list);
+}
+
+void URLSearchParams::append(const AtomicString& name, const AtomicString& value, ExceptionState& exception_state) {
+  list_.emplace_back(name.ToStdString(ctx()), value.ToStdString(ctx()));
+  Update();
+}
+
+void URLSearchParams::delete_(const AtomicString& name, ExceptionState& exception_state) {
+  std::string name_string = name.ToStdString(ctx());
+  list_.erase(std::remove_if(list_.begin(), list_.end(), [&](const Entry& entry) { return entry.first == name_string; }),
+              list_.end());
+  Update();
+}
+
+void URLSearchParams::delete_(const AtomicString& name, const AtomicString& value, ExceptionState& exception_state) {
+  if (value.IsNull()) {
+    delete_(name, exception_state);
+    return;
+  }
+  Entry target(name.ToStdString(ctx()), value.ToStdString(ctx()));
+  list_.erase(std::remove(list_.begin(), list_.end(), target), list_.end());
+  Update();
+}
+
+AtomicString URLSearchParams::get(const AtomicString& name, ExceptionState& exception_state) const {
+  std::string name_string = name.ToStdString(ctx());
+  for (const Entry& entry : list_) {
+    if (entry.first == name_string)
+      return AtomicString(ctx(), entry.second);
+  }
+  return AtomicString::Null();
+}
+
+std::vector<AtomicString> URLSearchParams::getAll(const AtomicString& name, ExceptionState& exception_state) const {
+  std::string name_string = name.ToStdString(ctx());
+  std::vector<AtomicString> result;
+  for (const Entry& entry : list_) {
+    if (entry.first == name_string)
+      result.emplace_back(ctx(), entry.second);
+  }
+  return result;
+}
+
+bool URLSearchParams::has(const AtomicString& name, ExceptionState& exception_state) const {
+  std::string name_string = name.ToStdString(ctx());
+  return std::any_of(list_.begin(), list_.end(), [&](const Entry& entry) { return entry.first == name_string; });
+}
+
+bool URLSearchParams::has(const AtomicString& name, const AtomicString& value, ExceptionState& exception_state) const {
+  if (value.IsNull())
+    return has(name, exception_state);
+  Entry target(name.ToStdString(ctx()), value.ToStdString(ctx()));
+  return std::find(list_.begin(), list_.end(), target) != list_.end();
+}
+
+void URLSearchParams::set(const AtomicString& name, const AtomicString& value, ExceptionState& exception_state) {
+  std::string name_string = name.ToStdString(ctx());
+  auto first = std::find_if(list_.begin(), list_.end(), [&](const Entry& entry) { return entry.first == name_string; });
+  if (first == list_.end()) {
+    list_.emplace_back(std::move(name_string), value.ToStdString(ctx()));
+  } else {
+    first->second = value.ToStdString(ctx());
+    list_.erase(std::remove_if(first + 1, list_.end(), [&](const Entry& entry) { return entry.first == name_string; }),
+                list_.end());
+  }
+  Update();
+}
+
+void URLSearchParams::sort(ExceptionState& exception_state) {
+  std::stable_sort(list_.begin(), list_.end(),
+                   [](const Entry& a, const Entry& b) { return LessThanInCodeUnitOrder(a.first, b.first); });
+  Update();
+}
+
+void URLSearchParams::forEach(const std::shared_ptr<QJSFunction>& callback, ExceptionState& exception_state) {
+  forEach(callback, ScriptValue::Empty(ctx()), exception_state);
+}
+
+void URLSearchParams::forEach(const std::shared_ptr<QJSFunction>& callback,
+                              const ScriptValue& this_arg,
+                              ExceptionState& exception_state) {
+  // The list can be changed by the callback, the length is checked again on every iteration.
+  for (size_t i = 0; i < list_.size(); i++) {
+    ScriptValue arguments[] = {ScriptValue(ctx(), AtomicString(ctx(), list_[i].second)),
+                               ScriptValue(ctx(), AtomicString(ctx(), list_[i].first)), ToValue()};
+    ScriptValue result = callback->Invoke(ctx(), this_arg, 3, arguments);
+    if (result.IsException()) {
+      JSValue exception = JS_GetException(ctx());
+      exception_state.ThrowException(ctx(), exception);
+      JS_FreeValue(ctx(), exception);
+      return;
+    }
+  }
+}
+
+ScriptValue URLSearchParams::entries(ExceptionState& exception_state) {
+  return CreateIterator(IterationKind::kEntries);
+}
+
+ScriptValue URLSearchParams::keys(ExceptionState& exception_state) {
+  return CreateIterator(IterationKind::kKeys);
+}
+
+ScriptValue URLSearchParams::values(ExceptionState& exception_state) {
+  return CreateIterator(IterationKind::kValues);
+}
+
+ScriptValue URLSearchParams::Symbol_iterator() {
+  // URLSearchParams.prototype[Symbol.iterator] is URLSearchParams.prototype.entries.
+  JSValue object = ToQuickJS();
+  JSValue entries = JS_GetPropertyStr(ctx(), object, "entries");
+  JS_FreeValue(ctx(), object);
+  ScriptValue result(ctx(), entries);
+  JS_FreeValue(ctx(), entries);
+  return result;
+}
+
+// The iterators walk a snapshot of the list, created as an array iterator.
+ScriptValue URLSearchParams::CreateIterator(IterationKind kind) {
+  JSValue array = JS_NewArray(ctx());
+  for (uint32_t i = 0; i < list_.size(); i++) {
+    JSValue item;
+    if (kind == IterationKind::kKeys) {
+      item = Converter<IDLDOMString>::ToValue(ctx(), list_[i].first);
+    } else if (kind == IterationKind::kValues) {
+      item = Converter<IDLDOMString>::ToValue(ctx(), list_[i].second);
+    } else {
+      item = JS_NewArray(ctx());
+      JS_SetPropertyUint32(ctx(), item, 0, Converter<IDLDOMString>::ToValue(ctx(), list_[i].first));
+      JS_SetPropertyUint32(ctx(), item, 1, Converter<IDLDOMString>::ToValue(ctx(), list_[i].second));
+    }
+    JS_SetPropertyUint32(ctx(), array, i, item);
+  }
+  JSValue values = JS_GetPropertyStr(ctx(), array, "values");
+  JSValue iterator = JS_Call(ctx(), values, array, 0, nullptr);
+  JS_FreeValue(ctx(), values);
+  JS_FreeValue(ctx(), array);
+  ScriptValue result(ctx(), iterator);
+  JS_FreeValue(ctx(), iterator);
+  return result;
+}
+
+void URLSearchParams::SetQuery(std::string_view query) {
+  list_.clear();
+  size_t start = 0;
+  while (start <= query.size()) {
+    size_t end = std::min(query.find('&', start), query.size());
+    std::string_view sequence = query.substr(start, end - start);
+    start = end + 1;
+    if (sequence.empty())
+      continue;
+    size_t equal = sequence.find('=');
+    if (equal == std::string_view::npos) {
+      list_.emplace_back(FormURLDecode(sequence), std::string());
+    } else {
+      list_.emplace_back(FormURLDecode(sequence.substr(0, equal)), FormURLDecode(sequence.substr(equal + 1)));
+    }
+  }
+}
+
+std::string URLSearchParams::Serialize() const {
+  std::string output;
+  for (const Entry& entry : list_) {
+    if (!output.empty())
+      output += '&';
+    AppendFormURLEncoded(output, entry.first);
+    output += '=';
+    AppendFormURLEncoded(output, entry.second);
+  }
+  return output;
+}
+
+void URLSearchParams::Update() {
+  if (url_ == nullptr)
+    return;
+  std::string query = Serialize();
+  url_->DidUpdateSearchParams(query.empty() ? nullptr : &query);
+}
+
+void URLSearchParams::Trace(GCVisitor* visitor) const {
+  visitor->TraceMember(url_);
+}
+
+}  // namespace webf
@@ -0,0 +1,17 @@
+interface URLSearchParams {
+  readonly size: int64;
+  append(name: string, value: string): void;
+  delete(name: string, value?: string): void;
+  get(name: string): string | null;
+  getAll(name: string): string[];
+  has(name: string, value?: string): boolean;
+  set(name: string, value: string): void;
+  sort(): void;
+  forEach(callback: Function, thisArg?: any): void;
+  entries(): any;
+  keys(): any;
+  values(): any;
+  readonly [Symbol.iterator]: any;
+  toString(): string;
+  new(init?: any): URLSearchParams;
+}
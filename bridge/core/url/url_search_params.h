@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef WEBF_CORE_URL_URL_SEARCH_PARAMS_H_
+#define WEBF_CORE_URL_URL_SEARCH_PARAMS_H_
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "bindings/qjs/atomic_string.h"
+#include "bindings/qjs/cppgc/member.h"
+#include "bindings/qjs/exception_state.h"
+#include "bindings/qjs/qjs_function.h"
+#include "bindings/qjs/script_value.h"
+#include "bindings/qjs/script_wrappable.h"
+
+namespace webf {
+
+class URL;
+
+// https://url.spec.whatwg.org/#interface-urlsearchparams
+// The names and values are kept as UTF-8, they are converted to JS strings only when read from script.
+class URLSearchParams : public ScriptWrappable {
+  DEFINE_WRAPPERTYPEINFO();
+
+ public:
+  using ImplType = URLSearchParams*;
+  using Entry = std::pair<std::string, std::string>;
+
+  static URLSearchParams* Create(ExecutingContext* context, ExceptionState& exception_state);
+  static URLSearchParams* Create(ExecutingContext* context, const ScriptValue& init, ExceptionState& exception_state);
+
+  URLSearchParams() = delete;
+  explicit URLSearchParams(ExecutingContext* context, URL* url = nullptr);
+
+  int64_t size() const { return static_cast<int64_t>(list_.size()); }
+  void append(const AtomicString& name, const AtomicString& value, ExceptionState& exception_state);
+  void delete_(const AtomicString& name, ExceptionState& exception_state);
+  void delete_(const AtomicString& name, const AtomicString& value, ExceptionState& exception_state);
+  AtomicString get(const AtomicString& name, ExceptionState& exception_state) const;
+  std::vector<AtomicString> getAll(const AtomicString& name, ExceptionState& exception_state) const;
+  bool has(const AtomicString& name, ExceptionState& exception_state) const;
+  bool has(const AtomicString& name, const AtomicString& value, ExceptionState& exception_state) const;
+  void set(const AtomicString& name, const AtomicString& value, ExceptionState& exception_state);
+  void sort(ExceptionState& exception_state);
+  void forEach(const std::shared_ptr<QJSFunction>& callback, ExceptionState& exception_state);
+  void forEach(const std::shared_ptr<QJSFunction>& callback,
+               const ScriptValue& this_arg,
+               ExceptionState& exception_state);
+  ScriptValue entries(ExceptionState& exception_state);
+  ScriptValue keys(ExceptionState& exception_state);
+  ScriptValue values(ExceptionState& exception_state);
+  ScriptValue Symbol_iterator();
+  AtomicString toString(ExceptionState& exception_state) const { return AtomicString(ctx(), Serialize()); }
+
+  // https://url.spec.whatwg.org/#concept-urlencoded-parser
+  void SetQuery(std::string_view query);
+  // https://url.spec.whatwg.org/#concept-urlencoded-serializer
+  std::string Serialize() const;
+
+  void Trace(GCVisitor* visitor) const override;
+
+ private:
+  enum class IterationKind { kKeys, kValues, kEntries };
+
+  void AppendFromInit(const ScriptValue& init, ExceptionState& exception_state);
+  void AppendFromSequence(JSValue sequence, JSValue method, ExceptionState& exception_state);
+  ScriptValue CreateIterator(IterationKind kind);
+  // https://url.spec.whatwg.org/#concept-urlsearchparams-update
+  void Update();
+
+  std::vector<Entry> list_;
+  Member<URL> url_;
+};
+
+}  // namespace webf
+
+#endif  // WEBF_CORE_URL_URL_SEARCH_PARAMS_H_
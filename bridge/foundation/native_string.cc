@@ -23,6 +23,20 @@ std::unique_ptr<SharedNativeString> SharedNativeString::FromTemporaryString(cons
   return std::make_unique<SharedNativeString>(new_str, length);
 }
 
+SharedNativeString::SharedNativeString(const uint8_t* string, uint32_t length)
+    : string_(reinterpret_cast<const uint16_t*>(string)), length_(length), is_one_byte_(1) {}
+
+std::unique_ptr<SharedNativeString> SharedNativeString::FromTemporaryOneByteString(const uint8_t* string,
+                                                                                   uint32_t length) {
+#if WIN32
+  const auto* new_str = static_cast<const uint8_t*>(CoTaskMemAlloc(length));
+#else
+  const auto* new_str = static_cast<const uint8_t*>(malloc(length));
+#endif
+  memcpy((void*)new_str, string, length);
+  return std::make_unique<SharedNativeString>(new_str, length);
+}
+
 AutoFreeNativeString::~AutoFreeNativeString() {
   _free();
 }
@@ -16,13 +16,20 @@
 namespace webf {
 
 // SharedNativeString is a container class that accepts allocated UTF-16 strings,
-// and users are responsible for freeing their strings
+// and users are responsible for freeing their strings.
+// A one byte string holds Latin-1 characters, one per byte, the same way QuickJS stores most of its strings, so it
+// can be sent to Dart without widening. Readers must check is_one_byte() before using string() or string8().
 struct SharedNativeString {
   SharedNativeString(const uint16_t* string, uint32_t length);
+  SharedNativeString(const uint8_t* string, uint32_t length);
   static std::unique_ptr<SharedNativeString> FromTemporaryString(const uint16_t* string, uint32_t length);
+  static std::unique_ptr<SharedNativeString> FromTemporaryOneByteString(const uint8_t* string, uint32_t length);
 
   inline const uint16_t* string() const { return string_; }
+  inline const uint8_t* string8() const { return reinterpret_cast<const uint8_t*>(string_); }
   inline uint32_t length() const { return length_; }
+  inline bool is_one_byte() const { return is_one_byte_; }
+  inline uint16_t CharAt(uint32_t index) const { return is_one_byte_ ? string8()[index] : string_[index]; }
 
   // Dart FFI use ole32 as it's allocator, we need to override the default allocator to compact with Dart FFI.
   static void* operator new(std::size_t size);
@@ -33,6 +40,8 @@ struct SharedNativeString {
   SharedNativeString() = default;
   const uint16_t* string_;
   uint32_t length_;
+  // Keep in sync with NativeString in webf/lib/src/bridge/native_types.dart.
+  uint32_t is_one_byte_{0};
 };
 
 // NativeString is a container class that accepts allocated on Heap UTF-16 strings,
@@ -29,6 +29,23 @@ void SharedUICommand::addCommand(UICommand type,
   front_buffer_->addCommand(type, std::move(args_01), nativePtr, nativePtr2, request_ui_update);
 }
 
+void SharedUICommand::addCommand(UICommand type,
+                                 int32_t args_01,
+                                 void* nativePtr,
+                                 void* nativePtr2,
+                                 bool request_ui_update) {
+  if (!context_->isDedicated()) {
+    front_buffer_->addCommand(type, args_01, nativePtr, nativePtr2, request_ui_update);
+    return;
+  }
+
+  while (is_blocking_writing_) {
+    // simply spin wait for the swapBuffers to finish.
+  }
+
+  front_buffer_->addCommand(type, args_01, nativePtr, nativePtr2, request_ui_update);
+}
+
 // first called by dart to begin read commands.
 void* SharedUICommand::data() {
   return front_buffer_->data();
@@ -20,8 +20,10 @@ class SharedUICommand : public DartReadable {
                   void* nativePtr,
                   void* nativePtr2,
                   bool request_ui_update = true);
+  void addCommand(UICommand type, int32_t args_01, void* nativePtr, void* nativePtr2, bool request_ui_update = true);
 
   void* data();
+  UICommandBuffer* frontBuffer() { return front_buffer_.get(); }
   uint32_t kindFlag();
   int64_t size();
   bool empty();
@@ -9,7 +9,7 @@ namespace webf {
 StringView::StringView(const std::string& string) : bytes_(string.data()), length_(string.length()), is_8bit_(true) {}
 
 StringView::StringView(const SharedNativeString* string)
-    : bytes_(string->string()), length_(string->length()), is_8bit_(false) {}
+    : bytes_(string->string()), length_(string->length()), is_8bit_(string->is_one_byte()) {}
 
 StringView::StringView(void* bytes, unsigned length, bool is_wide_char)
     : bytes_(bytes), length_(length), is_8bit_(!is_wide_char) {}
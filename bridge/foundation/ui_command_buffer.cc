@@ -7,6 +7,7 @@
 #include "core/dart_methods.h"
 #include "core/executing_context.h"
 #include "foundation/logging.h"
+#include "foundation/native_type.h"
 #include "include/webf_bridge.h"
 
 namespace webf {
@@ -23,8 +24,11 @@ UICommandKind GetKindFromUICommand(UICommand command) {
     case UICommand::kCreateSVGElement:
     case UICommand::kCreateElementNS:
     case UICommand::kCloneNode:
+    case UICommand::kCloneNodes:
       return UICommandKind::kNodeCreation;
     case UICommand::kInsertAdjacentNode:
+    case UICommand::kInsertAdjacentNodes:
+    case UICommand::kRemoveAllChildren:
       return UICommandKind::kNodeMutation;
     case UICommand::kAddEvent:
     case UICommand::kRemoveEvent:
@@ -34,6 +38,9 @@ UICommandKind GetKindFromUICommand(UICommand command) {
       return UICommandKind::kStyleUpdate;
     case UICommand::kSetAttribute:
     case UICommand::kRemoveAttribute:
+    case UICommand::kSetTextData:
+    case UICommand::kAddClass:
+    case UICommand::kRemoveClass:
       return UICommandKind::kAttributeUpdate;
     case UICommand::kDisposeBindingObject:
       return UICommandKind::kDisposeBindingObject;
@@ -55,13 +62,16 @@ void UICommandBuffer::addCommand(UICommand command,
                                  void* nativePtr,
                                  void* nativePtr2,
                                  bool request_ui_update) {
-  if (!is_recording_) {
-    UICommandItem recording_item{static_cast<int32_t>(UICommand::kStartRecordingCommand), nullptr, nullptr, nullptr};
-    updateFlags(command);
-    addCommand(recording_item, false);
-    is_recording_ = true;
+  if (UNLIKELY(ShouldSkip(command))) {
+    // Free the strings which would have been released by Dart.
+    delete static_cast<AutoFreeNativeString*>(args_01.release());
+    if (command == UICommand::kCreateElementNS)
+      delete static_cast<AutoFreeNativeString*>(nativePtr2);
+    return;
   }
 
+  startRecording(command);
+
   if (command == UICommand::kFinishRecordingCommand) {
     if (size_ == 0)
       return;
@@ -69,9 +79,74 @@ void UICommandBuffer::addCommand(UICommand command,
       return;
   }
 
+  UpdateTextDataSlots(command, nativePtr);
+  if (command == UICommand::kSetTextData && UpdatePendingTextData(args_01.get(), nativePtr))
+    return;
+
+  int64_t index = size_;
   UICommandItem item{static_cast<int32_t>(command), args_01.get(), nativePtr, nativePtr2};
   updateFlags(command);
   addCommand(item, request_ui_update);
+  if (command == UICommand::kSetTextData && size_ > index)
+    text_data_slots_[nativePtr] = index;
+}
+
+void UICommandBuffer::addCommand(UICommand command,
+                                 int32_t args_01,
+                                 void* nativePtr,
+                                 void* nativePtr2,
+                                 bool request_ui_update) {
+  if (UNLIKELY(ShouldSkip(command))) {
+    if (command == UICommand::kInsertAdjacentNodes)
+      dart_free(nativePtr2);
+    return;
+  }
+
+  startRecording(command);
+
+  UICommandItem item{static_cast<int32_t>(command), args_01, nativePtr, nativePtr2};
+  updateFlags(command);
+  addCommand(item, request_ui_update);
+}
+
+bool UICommandBuffer::ShouldSkip(UICommand command) const {
+  if (skip_node_commands_ == 0)
+    return false;
+  UICommandKind kind = GetKindFromUICommand(command);
+  return command != UICommand::kCloneNodes &&
+         (kind == UICommandKind::kNodeCreation || kind == UICommandKind::kNodeMutation);
+}
+
+// Only the last value written to a text node in a batch is sent, in the place of its first update.
+bool UICommandBuffer::UpdatePendingTextData(SharedNativeString* data, void* nativePtr) {
+  auto it = text_data_slots_.find(nativePtr);
+  if (it == text_data_slots_.end())
+    return false;
+  UICommandItem& item = buffer_[it->second];
+  dart_free(reinterpret_cast<void*>(item.string_01));
+  item = UICommandItem{static_cast<int32_t>(UICommand::kSetTextData), data, nativePtr, nullptr};
+  return true;
+}
+
+void UICommandBuffer::UpdateTextDataSlots(UICommand command, void* nativePtr) {
+  if (text_data_slots_.empty())
+    return;
+  if (command == UICommand::kCloneNode || command == UICommand::kCloneNodes) {
+    // The clones copy the data of the text nodes when they are created, a later update must not move before them.
+    text_data_slots_.clear();
+  } else if (command == UICommand::kDisposeBindingObject) {
+    // The address may be reused by a new text node in the same batch.
+    text_data_slots_.erase(nativePtr);
+  }
+}
+
+void UICommandBuffer::startRecording(UICommand command) {
+  if (is_recording_)
+    return;
+  UICommandItem recording_item{static_cast<int32_t>(UICommand::kStartRecordingCommand), nullptr, nullptr, nullptr};
+  updateFlags(command);
+  addCommand(recording_item, false);
+  is_recording_ = true;
 }
 
 void UICommandBuffer::updateFlags(UICommand command) {
@@ -124,6 +199,7 @@ void UICommandBuffer::clear() {
   memset(buffer_, 0, sizeof(UICommandItem) * size_);
   size_ = 0;
   kind_flag = 0;
+  text_data_slots_.clear();
   update_batched_ = false;
 }
 
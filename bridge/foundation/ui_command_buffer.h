@@ -7,6 +7,7 @@
 #define BRIDGE_FOUNDATION_UI_COMMAND_BUFFER_H_
 
 #include <cinttypes>
+#include <unordered_map>
 #include "bindings/qjs/native_string_utils.h"
 
 namespace webf {
@@ -43,19 +44,43 @@ enum class UICommand {
   kCreateDocumentFragment,
   kCreateSVGElement,
   kCreateElementNS,
+  kInsertAdjacentNodes,
+  kRemoveAllChildren,
+  kCloneNodes,
+  kSetTextData,
+  kAddClass,
+  kRemoveClass,
   kFinishRecordingCommand,
 };
 
+// Where kInsertAdjacentNode and kInsertAdjacentNodes insert relative to their target, carried in args_01_length.
+// Keep in sync with AdjacentPosition in webf/lib/src/bridge/to_native.dart.
+enum class AdjacentPosition : int32_t {
+  kBeforeBegin,
+  kAfterBegin,
+  kBeforeEnd,
+  kAfterEnd,
+};
+
 #define MAXIMUM_UI_COMMAND_SIZE 2048
 
+// Set in UICommandItem::type when string_01 holds one byte (Latin-1) characters instead of UTF-16.
+#define UI_COMMAND_ONE_BYTE_ARGS_FLAG (1 << 16)
+
 struct UICommandItem {
   UICommandItem() = default;
   explicit UICommandItem(int32_t type, SharedNativeString* args_01, void* nativePtr, void* nativePtr2)
-      : type(type),
+      : type(args_01 != nullptr && args_01->is_one_byte() ? type | UI_COMMAND_ONE_BYTE_ARGS_FLAG : type),
         string_01(reinterpret_cast<int64_t>(args_01 != nullptr ? args_01->string() : nullptr)),
         args_01_length(args_01 != nullptr ? args_01->length() : 0),
         nativePtr(reinterpret_cast<int64_t>(nativePtr)),
         nativePtr2(reinterpret_cast<int64_t>(nativePtr2)){};
+  // For the commands which take an integer argument instead of a string.
+  explicit UICommandItem(int32_t type, int32_t args_01, void* nativePtr, void* nativePtr2)
+      : type(type),
+        args_01_length(args_01),
+        nativePtr(reinterpret_cast<int64_t>(nativePtr)),
+        nativePtr2(reinterpret_cast<int64_t>(nativePtr2)){};
   int32_t type{0};
   int32_t args_01_length{0};
   int64_t string_01{0};
@@ -67,6 +92,19 @@ UICommandKind GetKindFromUICommand(UICommand type);
 
 class UICommandBuffer {
  public:
+  // Drops the node creation and tree mutation commands while alive, for nodes which Dart builds on its own from a
+  // single kCloneNodes command.
+  class SkipNodeCommandsScope {
+   public:
+    explicit SkipNodeCommandsScope(UICommandBuffer* buffer) : buffer_(buffer) { buffer_->skip_node_commands_++; }
+    ~SkipNodeCommandsScope() { buffer_->skip_node_commands_--; }
+    SkipNodeCommandsScope(const SkipNodeCommandsScope&) = delete;
+    SkipNodeCommandsScope& operator=(const SkipNodeCommandsScope&) = delete;
+
+   private:
+    UICommandBuffer* buffer_;
+  };
+
   UICommandBuffer() = delete;
   explicit UICommandBuffer(ExecutingContext* context);
   ~UICommandBuffer();
@@ -75,6 +113,7 @@ class UICommandBuffer {
                   void* nativePtr,
                   void* nativePtr2,
                   bool request_ui_update = true);
+  void addCommand(UICommand type, int32_t args_01, void* nativePtr, void* nativePtr2, bool request_ui_update = true);
   UICommandItem* data();
   uint32_t kindFlag();
   bool isRecording();
@@ -84,6 +123,10 @@ class UICommandBuffer {
 
  private:
   void addCommand(const UICommandItem& item, bool request_ui_update = true);
+  bool ShouldSkip(UICommand command) const;
+  bool UpdatePendingTextData(SharedNativeString* data, void* nativePtr);
+  void UpdateTextDataSlots(UICommand command, void* nativePtr);
+  void startRecording(UICommand command);
   void updateFlags(UICommand command);
 
   ExecutingContext* context_{nullptr};
@@ -93,6 +136,10 @@ class UICommandBuffer {
   int64_t size_{0};
   int64_t max_size_{MAXIMUM_UI_COMMAND_SIZE};
   bool is_recording_{false};
+  int32_t skip_node_commands_{0};
+  // The index of the pending kSetTextData command of each text node, which is overwritten by the later updates of
+  // the node in the same batch.
+  std::unordered_map<void*, int64_t> text_data_slots_;
 };
 
 }  // namespace webf
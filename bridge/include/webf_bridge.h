@@ -30,6 +30,14 @@ struct WebFInfo {
   const char* system_name{nullptr};
 };
 
+struct NativePageMemoryUsage {
+  int64_t malloc_size{0};
+  int64_t malloc_count{0};
+  int64_t soft_limit{0};
+  int64_t hard_limit{0};
+  int8_t soft_limit_exceeded{0};
+};
+
 typedef void (*Task)(void*);
 typedef std::function<void(bool)> DartWork;
 typedef void (*AllocateNewPageCallback)(Dart_Handle dart_handle, void*);
@@ -119,6 +127,17 @@ void registerPluginCode(const char* code, int32_t length, const char* pluginName
 WEBF_EXPORT_C
 int32_t profileModeEnabled();
 
+// Read the memory charged to a page's JSContext. Blocks until the JS thread of the page has copied its counters into
+// |usage|, which is left untouched when the page is being disposed.
+WEBF_EXPORT_C
+void getPageMemoryUsage(void* page, NativePageMemoryUsage* usage);
+WEBF_EXPORT_C
+void setPageMemoryLimit(void* page, int64_t soft_limit, int64_t hard_limit);
+// Compile the function bodies of the scripts evaluated later in the page on their first call. Faster startup for
+// large bundles, but syntax errors inside a function body are only thrown when it is called.
+WEBF_EXPORT_C
+void setPageLazyFunctionCompilation(void* page, int8_t enabled);
+
 WEBF_EXPORT_C int8_t isJSThreadBlocked(void* dart_isolate_context, double context_id);
 
 WEBF_EXPORT_C void executeNativeCallback(DartWork* work_ptr);
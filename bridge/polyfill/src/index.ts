@@ -12,12 +12,10 @@ import { history } from './history';
 import { navigator } from './navigator';
 import { XMLHttpRequest } from './xhr';
 import { asyncStorage } from './async-storage';
-import { URLSearchParams } from './url-search-params';
 import { localStorage } from './local-storage';
 import { sessionStorage } from './session-storage';
 import { DOMException } from './dom-exception';
 import { Storage } from './storage';
-import { URL } from './url';
 import { webf } from './webf';
 import { WebSocket } from './websocket'
 import { ResizeObserver } from './resize-observer';
@@ -36,9 +34,7 @@ defineGlobalProperty('asyncStorage', asyncStorage);
 defineGlobalProperty('localStorage', localStorage);
 defineGlobalProperty('sessionStorage', sessionStorage);
 defineGlobalProperty('Storage', Storage);
-defineGlobalProperty('URLSearchParams', URLSearchParams);
 defineGlobalProperty('DOMException', DOMException);
-defineGlobalProperty('URL', URL);
 defineGlobalProperty('webf', webf);
 defineGlobalProperty('WebSocket', WebSocket);
 defineGlobalProperty('ResizeObserver', ResizeObserver);
@@ -329,9 +329,16 @@ if (UNLIKELY(exception_state.HasException())) {
 }`;
 }
 
+// JavaScript method names which are reserved words in C++, e.g. URLSearchParams.prototype.delete.
+const cppReservedMethodNames = new Set(['delete', 'new', 'default', 'operator', 'register']);
+
+function getMethodSymbolName(name: string) {
+  return cppReservedMethodNames.has(name) ? `${name}_` : name;
+}
+
 function generateCallMethodName(name: string) {
   if (name === 'constructor') return 'Create';
-  return name;
+  return getMethodSymbolName(name);
 }
 
 function generateDartImplCallCode(blob: IDLBlob, declare: FunctionDeclaration, isLayoutIndependent: boolean, args: FunctionArguments[]): string {
@@ -443,7 +450,7 @@ ${optionalArgumentsInit.join('\n')}
 function generateOverLoadSwitchBody(overloadMethods: FunctionDeclaration[]) {
   let callBodyList = overloadMethods.map((overload, index) => {
     return `if (${overload.args.length} == argc) {
-  return ${overload.name}_overload_${index}(ctx, this_val, argc, argv);
+  return ${getMethodSymbolName(overload.name)}_overload_${index}(ctx, this_val, argc, argv);
 }
     `;
   });
@@ -451,7 +458,7 @@ function generateOverLoadSwitchBody(overloadMethods: FunctionDeclaration[]) {
   return `
 ${callBodyList.join('\n')}
 
-return ${overloadMethods[0].name}_overload_${0}(ctx, this_val, argc, argv);
+return ${getMethodSymbolName(overloadMethods[0].name)}_overload_${0}(ctx, this_val, argc, argv);
 `;
 }
 
@@ -574,7 +581,7 @@ export function generateCppSource(blob: IDLBlob, options: GenerateOptions) {
           } else {
             overloadMethods[method.name] = [method];
             filtedMethods.push(method);
-            options.classPropsInstallList.push(`{"${method.name}", ${method.name}, ${method.args.length}}`)
+            options.classPropsInstallList.push(`{"${method.name}", ${getMethodSymbolName(method.name)}, ${method.args.length}}`)
           }
         }
 
@@ -650,6 +657,7 @@ const WrapperTypeInfo& ${className}::wrapper_type_info_ = QJS${className}::wrapp
           generateCoreTypeValue,
           generateRawTypeValue,
           generateOverLoadSwitchBody,
+          getMethodSymbolName,
           isTypeNeedAllocate,
           overloadMethods,
           isJSArrayBuiltInProps,
@@ -37,6 +37,9 @@ export function getClassName(blob: IDLBlob) {
   if (raw.slice(0, 2) == 'ui') {
     return 'UI' + raw.slice(2);
   }
+  if (raw.slice(0, 3) == 'url') {
+    return 'URL' + raw.slice(3);
+  }
 
   return `${raw[0].toUpperCase() + raw.slice(1)}`;
 }
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+// atob and btoa on a 256 KiB image sized binary string, and its decoding to bytes.
+
+#include <benchmark/benchmark.h>
+#include "benchmark_env.h"
+
+using namespace webf;
+
+static const char* kImage = R"(
+var image = '';
+for (var i = 0; i < 256 * 1024; i++) image += String.fromCharCode((i * 31) & 0xff);
+var encoded = btoa(image);
+var wrapped = encoded.replace(/.{76}/g, '$&\n');
+)";
+
+static void Encode(benchmark::State& state) {
+  RunScript(state, kImage, "for (var i = 0; i < 10; i++) btoa(image);");
+}
+
+static void Decode(benchmark::State& state) {
+  RunScript(state, kImage, "for (var i = 0; i < 10; i++) atob(encoded);");
+}
+
+static void DecodeWrapped(benchmark::State& state) {
+  RunScript(state, kImage, "for (var i = 0; i < 10; i++) atob(wrapped);");
+}
+
+static void DecodeToBytes(benchmark::State& state) {
+  RunScript(state, kImage, "for (var i = 0; i < 10; i++) __webf_base64_decode__(encoded);");
+}
+
+BENCHMARK(Encode)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(Decode)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(DecodeWrapped)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(DecodeToBytes)->Threads(1)->Unit(benchmark::kMillisecond);
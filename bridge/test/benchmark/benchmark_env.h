@@ -0,0 +1,40 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+#ifndef BRIDGE_TEST_BENCHMARK_BENCHMARK_ENV_H_
+#define BRIDGE_TEST_BENCHMARK_BENCHMARK_ENV_H_
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include "webf_test_env.h"
+
+namespace webf {
+
+// The page every benchmark of webf_benchmark runs on, created on first use. Scripts evaluated on it share one global
+// object, setup scripts declare their state with `var` and benchmark scripts keep their bindings inside a function.
+inline ExecutingContext* BenchmarkContext() {
+  static std::unique_ptr<WebFTestEnv> env =
+      TEST_init([](double contextId, const char* errmsg) { WEBF_LOG(ERROR) << errmsg; });
+  return env->page()->executingContext();
+}
+
+// Evaluates |setup| once, then |code| on every iteration. The benchmark fails instead of measuring a script that
+// throws, the exception is logged above its report.
+inline void RunScript(benchmark::State& state, const std::string& setup, const std::string& code) {
+  ExecutingContext* context = BenchmarkContext();
+  if (!setup.empty() && !context->EvaluateJavaScript(setup.c_str(), setup.size(), "internal://setup", 0)) {
+    state.SkipWithError("The setup script threw an exception.");
+    return;
+  }
+  for (auto _ : state) {
+    if (!context->EvaluateJavaScript(code.c_str(), code.size(), "internal://", 0)) {
+      state.SkipWithError("The benchmark script threw an exception.");
+      break;
+    }
+  }
+}
+
+}  // namespace webf
+
+#endif  // BRIDGE_TEST_BENCHMARK_BENCHMARK_ENV_H_
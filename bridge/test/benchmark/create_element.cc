@@ -4,14 +4,12 @@
  */
 
 #include <benchmark/benchmark.h>
-#include "webf_test_env.h"
+#include "benchmark_env.h"
 
 using namespace webf;
 
-auto env = TEST_init();
-
 static void CreateRawJavaScriptObjects(benchmark::State& state) {
-  auto context = env->page()->executingContext();
+  auto context = BenchmarkContext();
   uint8_t bytes[] = {1, 2, 2, 97, 12, 97, 97,  97, 46, 106, 115, 14, 0,   6, 0, 160, 1,  0,  1,
                      0, 1, 0, 0,  20, 1,  162, 1,  0,  0,   0,   63, 210, 0, 0, 0,   0,  62, 210,
                      0, 0, 0, 0,  11, 57, 210, 0,  0,  0,   195, 40, 166, 3, 1, 2,   31, 33};
@@ -22,7 +20,6 @@ static void CreateRawJavaScriptObjects(benchmark::State& state) {
 }
 
 static void CreateDivElement(benchmark::State& state) {
-  auto context = env->page()->executingContext();
   std::string code = R"(
 (() => {
 let container = document.createElement('div');
@@ -38,14 +35,10 @@ for(let i = 0; i < 1000; i ++) {
 }
 })();
 )";
-  // Perform setup here
-  for (auto _ : state) {
-    context->EvaluateJavaScript(code.c_str(), code.size(), "internal://", 0);
-  }
+  RunScript(state, "", code);
 }
 
 static void InsertElement(benchmark::State& state) {
-  auto context = env->page()->executingContext();
   std::string code = R"(
 (() => {
 let container = document.createElement('div');
@@ -63,10 +56,7 @@ for(let i = 0; i < 1000; i ++) {
 }
 })();
 )";
-  // Perform setup here
-  for (auto _ : state) {
-    context->EvaluateJavaScript(code.c_str(), code.size(), "internal://", 0);
-  }
+  RunScript(state, "", code);
 }
 
 BENCHMARK(CreateRawJavaScriptObjects)->Threads(1);
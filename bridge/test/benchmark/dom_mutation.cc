@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+// appendChild and removeChild throughput, every tree mutation clears and sets the sibling and child members.
+// Text updates measure the commands sent for a node whose data is rewritten many times in a batch, class list changes
+// the token set shared between elements with the same class.
+
+#include <benchmark/benchmark.h>
+#include "benchmark_env.h"
+
+using namespace webf;
+
+static void AppendAndRemoveChildren(benchmark::State& state) {
+  RunScript(state, "",
+            "var container = document.createElement('div');"
+            "var children = [];"
+            "for (var i = 0; i < 1000; i++) children.push(document.createElement('span'));"
+            "for (var i = 0; i < 1000; i++) container.appendChild(children[i]);"
+            "for (var i = 0; i < 1000; i++) container.removeChild(children[i]);");
+}
+
+static void MoveChildren(benchmark::State& state) {
+  RunScript(state, "",
+            "var from = document.createElement('div');"
+            "var to = document.createElement('div');"
+            "for (var i = 0; i < 1000; i++) from.appendChild(document.createElement('span'));"
+            "while (from.firstChild) to.insertBefore(from.lastChild, to.firstChild);");
+}
+
+static void UpdateTextData(benchmark::State& state) {
+  RunScript(state, "",
+            "var counter = document.createTextNode('0');"
+            "document.body.appendChild(counter);"
+            "for (var i = 0; i < 1000; i++) counter.data = 'count: ' + i;"
+            "document.body.removeChild(counter);");
+}
+
+static void ToggleClassList(benchmark::State& state) {
+  RunScript(state, "",
+            "var items = [];"
+            "for (var i = 0; i < 1000; i++) {"
+            "  var item = document.createElement('div');"
+            "  item.className = 'item row visible';"
+            "  items.push(item);"
+            "}"
+            "for (var i = 0; i < 1000; i++) {"
+            "  items[i].classList.toggle('selected');"
+            "  items[i].classList.contains('visible');"
+            "  items[i].classList.remove('selected');"
+            "}");
+}
+
+BENCHMARK(AppendAndRemoveChildren)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(MoveChildren)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(UpdateTextData)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(ToggleClassList)->Threads(1)->Unit(benchmark::kMillisecond);
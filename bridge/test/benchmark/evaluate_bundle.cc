@@ -0,0 +1,64 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+// Startup cost of a multi-MB bundle where only a few of the module functions run, the way framework and library
+// code is loaded by apps. EvaluateBundle enables lazy function compilation, which defers the compilation of function
+// bodies until their first call. EvaluateBundleEager compiles every function up front for comparison.
+
+#include <benchmark/benchmark.h>
+#include "benchmark_env.h"
+
+using namespace webf;
+
+static std::string GenerateBundle(int module_count) {
+  std::string code = "var modules = [];\n";
+  for (int i = 0; i < module_count; i++) {
+    std::string id = std::to_string(i);
+    code += R"(modules.push(function (exports, require) {
+  var state = { id: )" + id + R"(, items: [], name: 'module_)" + id + R"(' };
+  function helper(a, b) {
+    var r = 0;
+    for (var k = 0; k < a.length; k++) { r += a[k] * b + state.id; }
+    return { value: r, label: state.name + ':' + r, tags: ['x', 'y', 'z'] };
+  }
+  function render(props) {
+    var out = [];
+    if (props.visible) { out.push('<div class="' + props.cls + '">'); }
+    for (var j = 0; j < props.children.length; j++) { out.push(helper(props.children[j], j).label); }
+    return out.join('');
+  }
+  exports.render = render;
+  exports.helper = helper;
+});
+)";
+  }
+  // Only one module out of fifty is used during startup.
+  code += R"(
+var used = 0;
+for (var i = 0; i < modules.length; i += 50) {
+  var e = {};
+  modules[i](e, null);
+  used += e.render({ visible: true, cls: 'c', children: [[1, 2], [3]] }).length;
+}
+)";
+  return code;
+}
+
+static void EvaluateBundle(benchmark::State& state) {
+  std::string code = GenerateBundle(6000);
+  // The page is shared with the other benchmarks, lazy compilation is only enabled for this one.
+  BenchmarkContext()->SetLazyFunctionCompilation(true);
+  RunScript(state, "", code);
+  BenchmarkContext()->SetLazyFunctionCompilation(false);
+  state.SetBytesProcessed(state.iterations() * code.size());
+}
+
+static void EvaluateBundleEager(benchmark::State& state) {
+  std::string code = GenerateBundle(6000);
+  RunScript(state, "", code);
+  state.SetBytesProcessed(state.iterations() * code.size());
+}
+
+BENCHMARK(EvaluateBundle)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(EvaluateBundleEager)->Threads(1)->Unit(benchmark::kMillisecond);
@@ -1,9 +1,158 @@
 /*
-* Copyright (C) 2019-2022 The Kraken authors. All rights reserved.
-* Copyright (C) 2022-present The WebF authors. All rights reserved.
-*/
+ * Copyright (C) 2019-2022 The Kraken authors. All rights reserved.
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+// The TypeScript URL and URLSearchParams polyfills replaced by the native bindings, with the types stripped and the
+// classes renamed, so that test/benchmark/url.cc can compare both implementations. Only the two classes are exposed
+// to the page the benchmarks share, which makes the file safe to evaluate more than once.
+
+(function() {
+
+// https://github.com/WebReflection/url-search-params
+
+const find = /[!'\(\)~]|%20|%00/g;
+const plus = /\+/g;
+const replace = {
+  '!': '%21',
+  "'": '%27',
+  '(': '%28',
+  ')': '%29',
+  '~': '%7E',
+  '%20': '+',
+  '%00': '\x00'
+};
+const replacer = function(match) {
+  return replace[match];
+};
+const DICT_KEY = '__PolyfillURLSearchParams__';
+
+function encode(str) {
+  return encodeURIComponent(str).replace(find, replacer);
+}
+
+function decode(str) {
+  return decodeURIComponent(str.replace(plus, ' '));
+}
 
-import { URLSearchParams } from './url-search-params';
+class PolyfillURLSearchParams {
+  constructor(query) {
+    this._reset();
+    if (!query) return;
+
+    if (typeof query === 'string') {
+      this._fromString(query);
+    } else if(query instanceof PolyfillURLSearchParams) {
+      query.forEach((value, name) => {
+        this.append(name, value);
+      });
+    } else if (Array.isArray(query)) {
+      for (var i = 0, length = query.length; i < length; i++) {
+        var value = query[i];
+        this.append(value[0], value[1]);
+      }
+    } else {
+      for (var key in query) {
+        this.append(key, query[key]);
+      }
+    }
+  }
+
+  _reset() {
+    this[DICT_KEY] = Object.create(null);
+  }
+
+  _fromString(query) {
+    if (query.charAt(0) === '?') {
+      query = query.slice(1);
+    }
+    for (var index, value, pairs = (query || '').split('&'), i = 0, length = pairs.length; i < length; i++) {
+      value = pairs[i];
+      index = value.indexOf('=');
+      if (-1 < index) {
+        this.append(
+          decode(value.slice(0, index)),
+          decode(value.slice(index + 1))
+        );
+      } else if (value.length) {
+        this.append(
+          decode(value),
+          ''
+        );
+      }
+    }
+  }
+  /**
+   * Appends a specified key/value pair as a new search parameter.
+   */
+  append(name, value) {
+    var dict = this[DICT_KEY];
+    if (name in dict) {
+      dict[name].push('' + value);
+    } else {
+      dict[name] = ['' + value];
+    }
+  }
+  /**
+   * Deletes the given search parameter, and its associated value, from the list of all search parameters.
+   */
+  delete(name) {
+    delete this[DICT_KEY][name];
+  }
+  /**
+   * Returns the first value associated to the given search parameter.
+   */
+  get(name) {
+    var dict = this[DICT_KEY];
+    return name in dict ? dict[name][0] : null;
+  }
+  /**
+   * Returns all the values association with a given search parameter.
+   */
+  getAll(name) {
+    var dict = this[DICT_KEY];
+    return name in dict ? dict[name].slice(0) : [];
+  }
+  /**
+   * Returns a Boolean indicating if such a search parameter exists.
+   */
+  has(name) {
+    return name in this[DICT_KEY];
+  }
+  /**
+   * Sets the value associated to a given search parameter to the given value. If there were several values, delete the others.
+   */
+  set(name, value) {
+    this[DICT_KEY][name] = ['' + value];
+  }
+  /**
+   * Allows iteration through all values contained in this object via a callback function.
+   * @param callback A callback function that is executed against each parameter, with the param value provided as its parameter.
+   * @param thisArg
+   */
+  forEach(callback, thisArg) {
+    var dict = this[DICT_KEY];
+    var params = this;
+    Object.getOwnPropertyNames(dict).forEach(function(name) {
+      dict[name].forEach(function invokeCallback(value) {
+        callback.call(thisArg, value, name, params);
+      }, params);
+    }, params);
+  }
+  /**
+   * Returns a string containing a query string suitable for use in a URL. Does not include the question mark.
+   */
+  toString() {
+    var dict = this[DICT_KEY], query = [], i, key, name, value;
+    for (key in dict) {
+      name = encode(key);
+      for (i = 0, value = dict[key]; i < value.length; i++) {
+        query.push(name + '=' + encode(value[i]));
+      }
+    }
+    return query.join('&');
+  }
+}
 
 // https://github.com/Polymer/URL
 var relative = Object.create(null);
@@ -21,11 +170,11 @@ relativePathDotMapping['.%2e'] = '..';
 relativePathDotMapping['%2e.'] = '..';
 relativePathDotMapping['%2e%2e'] = '..';
 
-function isRelativeScheme(scheme: string) {
+function isRelativeScheme(scheme) {
   return relative[scheme] !== undefined;
 }
 
-function percentEscape(c: string) {
+function percentEscape(c) {
   var unicode = c.charCodeAt(0);
   if (unicode > 0x20 &&
      unicode < 0x7F &&
@@ -37,7 +186,7 @@ function percentEscape(c: string) {
   return encodeURIComponent(c);
 }
 
-function percentEscapeQuery(c: string) {
+function percentEscapeQuery(c) {
   // XXX This actually needs to encode c using encoding and then
   // convert the bytes one-by-one.
 
@@ -52,32 +201,19 @@ function percentEscapeQuery(c: string) {
   return encodeURIComponent(c);
 }
 
-const EOF = undefined;
+var EOF = undefined;
 const ALPHA = /[a-zA-Z]/;
 const ALPHANUMERIC = /[a-zA-Z0-9\+\-\.]/;
 
 // Does not process domain names or IP addresses.
 // Does not handle encoding for the query parameter.
 
-export class URL {
-  _url: string;
-  _isInvalid: boolean;
-  _isRelative: boolean;
-  _username: string;
-  _password: null | string;
-  _scheme: string;
-  _query: string;
-  _fragment: string;
-  _host: string;
-  _port: string;
-  _path: any[];
-  _schemeData: string;
-  _searchParams: URLSearchParams;
+class PolyfillURL {
   _shouldUpdateSearchParams = true;
 
-  constructor(url: string, base?: string | URL) {
-    if (base !== undefined && !(base instanceof URL))
-    base = new URL(String(base));
+  constructor(url, base) {
+    if (base !== undefined && !(base instanceof PolyfillURL))
+    base = new PolyfillURL(String(base));
 
     this._url = url;
     this._clear();
@@ -87,12 +223,12 @@ export class URL {
 
     this._parse(input, null, base);
 
-    const searchParams = this._searchParams = new URLSearchParams(this.search);
+    const searchParams = this._searchParams = new PolyfillURLSearchParams(this.search);
 
     ['append', 'delete', 'set'].forEach((methodName) => {
       var method = searchParams[methodName];
 
-      searchParams[methodName] = (...args: any) => {
+      searchParams[methodName] = (...args) => {
         method.apply(searchParams, args);
         this._shouldUpdateSearchParams = false;
         this.search = searchParams.toString();
@@ -101,7 +237,7 @@ export class URL {
     });
   }
 
-  private _clear() {
+  _clear() {
     this._scheme = '';
     this._schemeData = '';
     this._username = '';
@@ -115,12 +251,12 @@ export class URL {
     this._isRelative = false;
   }
 
-  private _invalid() {
+  _invalid() {
     this._clear();
     this._isInvalid = true;
   }
 
-  private _IDNAToASCII(h: string) {
+  _IDNAToASCII(h) {
     if ('' == h) {
       this._invalid();
     }
@@ -128,7 +264,7 @@ export class URL {
     return h.toLowerCase();
   }
 
-  private _parse(input: string, stateOverride: any, base?: any) {
+  _parse(input, stateOverride, base) {
 
     var state = stateOverride || 'scheme start',
       cursor = 0,
@@ -138,7 +274,7 @@ export class URL {
       seenBracket = false,
       errors = [];
 
-    function err(message: string) {
+    function err(message) {
       errors.push(message);
     }
 
@@ -573,7 +709,7 @@ export class URL {
     return this._isInvalid || !this._query || '?' == this._query ?
       '' : this._query;
   }
-  set search(search: string) {
+  set search(search) {
     if (this._isInvalid || !this._isRelative)
       return;
 
@@ -641,3 +777,7 @@ export class URL {
     return this.href;
   }
 }
+
+globalThis.PolyfillURLSearchParams = PolyfillURLSearchParams;
+globalThis.PolyfillURL = PolyfillURL;
+})();
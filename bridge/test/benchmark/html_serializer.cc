@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+// innerHTML and outerHTML of deep and wide trees, as read by devtools and by apps that snapshot their markup.
+
+#include <benchmark/benchmark.h>
+#include "benchmark_env.h"
+
+using namespace webf;
+
+static void SerializeDeepTree(benchmark::State& state) {
+  RunScript(state,
+            "globalThis.deepRoot = document.createElement('div');"
+            "var node = deepRoot;"
+            "for (var i = 0; i < 10000; i++) {"
+            "  var child = document.createElement('span');"
+            "  child.setAttribute('class', 'level');"
+            "  node.appendChild(child);"
+            "  node = child;"
+            "}",
+            "deepRoot.outerHTML;");
+}
+
+static void SerializeWideTree(benchmark::State& state) {
+  RunScript(state,
+            "globalThis.wideRoot = document.createElement('ul');"
+            "for (var i = 0; i < 10000; i++) {"
+            "  var item = document.createElement('li');"
+            "  item.setAttribute('data-index', 'item ' + i);"
+            "  item.appendChild(document.createTextNode('Item <' + i + '> & more'));"
+            "  wideRoot.appendChild(item);"
+            "}",
+            "wideRoot.innerHTML;");
+}
+
+BENCHMARK(SerializeDeepTree)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(SerializeWideTree)->Threads(1)->Unit(benchmark::kMillisecond);
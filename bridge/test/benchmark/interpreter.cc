@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+// Pure JavaScript workloads shaped like framework code. They stress property access, method calls and
+// small integer arithmetic in the interpreter loop, compare runs with and without ENABLE_SUPERINSTRUCTIONS.
+
+#include <benchmark/benchmark.h>
+#include "benchmark_env.h"
+
+using namespace webf;
+
+static void VirtualDOMDiff(benchmark::State& state) {
+  std::string code = R"(
+(() => {
+function h(tag, props, children) {
+  return { tag: tag, key: props.key, props: props, children: children };
+}
+function render(items, selected) {
+  let rows = [];
+  for (let i = 0; i < items.length; i++) {
+    let item = items[i];
+    rows.push(h('tr', { key: item.id, className: item.id === selected ? 'danger' : '' }, [
+      h('td', { key: 1, className: 'col-md-1' }, [item.id + 1]),
+      h('td', { key: 2, className: 'col-md-4' }, [item.label]),
+    ]));
+  }
+  return h('tbody', { key: 0 }, rows);
+}
+function diffProps(a, b, patches) {
+  for (let k in b) {
+    if (a[k] !== b[k]) patches.push(k);
+  }
+}
+function diff(a, b, patches) {
+  if (a.tag !== b.tag || a.key !== b.key) {
+    patches.push(b);
+    return;
+  }
+  diffProps(a.props, b.props, patches);
+  let ac = a.children, bc = b.children;
+  let n = ac.length < bc.length ? ac.length : bc.length;
+  for (let i = 0; i < n; i++) {
+    let x = ac[i], y = bc[i];
+    if (typeof x === 'object') diff(x, y, patches);
+    else if (x !== y) patches.push(y);
+  }
+}
+let items = [];
+for (let i = 0; i < 1000; i++) items.push({ id: i, label: 'item ' + i });
+let prev = render(items, -1);
+let patches = [];
+for (let round = 0; round < 10; round++) {
+  items[round * 7].label += '!';
+  let next = render(items, round);
+  diff(prev, next, patches);
+  prev = next;
+}
+})();
+)";
+  RunScript(state, "", code);
+}
+
+static void JSONRoundTrip(benchmark::State& state) {
+  std::string code = R"(
+(() => {
+let records = [];
+for (let i = 0; i < 500; i++) {
+  records.push({ id: i, name: 'user' + i, active: (i & 1) === 0, score: i * 1.5, tags: ['a', 'b', 'c'] });
+}
+let text = JSON.stringify({ total: records.length, records: records });
+let data = JSON.parse(text);
+let sum = 0, active = 0;
+for (let i = 0; i < data.records.length; i++) {
+  let r = data.records[i];
+  sum = sum + r.score;
+  if (r.active) active = active + 1;
+  r.name = r.name.toUpperCase();
+}
+return JSON.stringify(data.records.slice(0, 10)).length + sum + active;
+})();
+)";
+  RunScript(state, "", code);
+}
+
+static void PropertyAccessLoop(benchmark::State& state) {
+  std::string code = R"(
+(() => {
+class Point {
+  constructor(x, y) { this.x = x; this.y = y; }
+  length() { return this.x * this.x + this.y * this.y; }
+}
+let points = [];
+for (let i = 0; i < 1000; i++) points.push(new Point(i, i + 1));
+let total = 0;
+for (let round = 0; round < 20; round++) {
+  for (let i = 0; i < points.length; i++) {
+    let p = points[i];
+    total = total + p.length() + p.x + 1;
+  }
+}
+return total;
+})();
+)";
+  RunScript(state, "", code);
+}
+
+BENCHMARK(VirtualDOMDiff)->Threads(1);
+BENCHMARK(JSONRoundTrip)->Threads(1);
+BENCHMARK(PropertyAccessLoop)->Threads(1);
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+// JSON.parse and JSON.stringify over a corpus shaped like the API payloads of apps: arrays of records sharing
+// their keys, long text fields with a few escapes, and the same data pretty printed.
+
+#include <benchmark/benchmark.h>
+#include "benchmark_env.h"
+
+using namespace webf;
+
+static const char* kCorpus = R"(
+var corpus = { records: [], articles: [] };
+for (var i = 0; i < 5000; i++) {
+  corpus.records.push({
+    id: i,
+    name: 'user name number ' + i,
+    email: 'user' + i + '@example.com',
+    active: i % 2 == 0,
+    score: i * 1.5,
+    tags: ['alpha', 'beta', 'gamma'],
+    address: { street: i + ' Main Street', city: 'Springfield', zip: '0' + (10000 + i) }
+  });
+}
+for (var i = 0; i < 200; i++) {
+  corpus.articles.push({
+    title: 'Article ' + i,
+    body: 'Lorem ipsum dolor sit amet, "consectetur" adipiscing elit.\n'.repeat(40) + '中文 ' + i
+  });
+}
+var compact = JSON.stringify(corpus);
+var pretty = JSON.stringify(corpus, null, 2);
+)";
+
+static void JSONParse(benchmark::State& state) {
+  RunScript(state, kCorpus, "JSON.parse(compact);");
+}
+
+static void JSONParsePretty(benchmark::State& state) {
+  RunScript(state, kCorpus, "JSON.parse(pretty);");
+}
+
+static void JSONStringify(benchmark::State& state) {
+  RunScript(state, kCorpus, "JSON.stringify(corpus);");
+}
+
+static void JSONStringifyPretty(benchmark::State& state) {
+  RunScript(state, kCorpus, "JSON.stringify(corpus, null, 2);");
+}
+
+BENCHMARK(JSONParse)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(JSONParsePretty)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(JSONStringify)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(JSONStringifyPretty)->Threads(1)->Unit(benchmark::kMillisecond);
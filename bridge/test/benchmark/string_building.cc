@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+// Building a long string piece by piece, the way templating and serialization code does. Concatenations past a
+// few hundred characters produce rope strings, which are only flattened when the characters are read.
+
+#include <benchmark/benchmark.h>
+#include "benchmark_env.h"
+
+using namespace webf;
+
+static void AppendInLoop(benchmark::State& state) {
+  RunScript(state, "", R"(
+(() => {
+let s = '';
+for (let i = 0; i < 100000; i++) { s += 'item ' + i + ','; }
+return s.length;
+})();
+)");
+}
+
+static void ConcatMarkup(benchmark::State& state) {
+  RunScript(state, "", R"(
+(() => {
+let html = '';
+for (let i = 0; i < 20000; i++) { html = html + '<div class="row">' + i + '</div>'; }
+return html.charCodeAt(html.length - 1);
+})();
+)");
+}
+
+static void PrependInLoop(benchmark::State& state) {
+  RunScript(state, "", R"(
+(() => {
+let s = '';
+for (let i = 0; i < 20000; i++) { s = '<li>' + i + '</li>' + s; }
+return s.indexOf('</li>');
+})();
+)");
+}
+
+BENCHMARK(AppendInLoop)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(ConcatMarkup)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(PrependInLoop)->Threads(1)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+// String searching builtins over chat log and markdown like text: indexOf/includes of a missing word, split on
+// lines and words, replaceAll with a literal replacement, on both Latin-1 and two-byte (CJK) strings.
+
+#include <benchmark/benchmark.h>
+#include "benchmark_env.h"
+
+using namespace webf;
+
+static const char* kTexts = R"(
+var latin1 = '';
+var wide = '';
+for (var i = 0; i < 2000; i++) {
+  latin1 += '[12:' + (i % 60) + '] user' + (i % 7) + ': The **quick** brown fox jumps over the `lazy` dog.\n';
+  wide += '[12:' + (i % 60) + '] 用户' + (i % 7) + ': 敏捷的棕色狐狸跳过了懒狗 **quick** fox.\n';
+}
+)";
+
+static void IndexOfLatin1(benchmark::State& state) {
+  RunScript(state, kTexts, "for (var i = 0; i < 20; i++) latin1.indexOf('missing word'); latin1.includes('user9');");
+}
+
+static void IndexOfWide(benchmark::State& state) {
+  RunScript(state, kTexts, "for (var i = 0; i < 20; i++) wide.indexOf('不存在'); wide.includes('用户9');");
+}
+
+static void SplitLines(benchmark::State& state) {
+  RunScript(state, kTexts, "latin1.split('\\n'); wide.split('\\n');");
+}
+
+static void SplitWords(benchmark::State& state) {
+  RunScript(state, kTexts, "latin1.split(' ');");
+}
+
+static void ReplaceAllLiteral(benchmark::State& state) {
+  RunScript(state, kTexts, "latin1.replaceAll('**', '__'); wide.replaceAll('狐狸', 'fox');");
+}
+
+BENCHMARK(IndexOfLatin1)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(IndexOfWide)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(SplitLines)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(SplitWords)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(ReplaceAllLiteral)->Threads(1)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,46 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+// TextEncoder and TextDecoder on binary protocol sized messages: JSON payloads encoded into a reused buffer, and
+// decoded whole or as a stream of 1 KiB frames.
+
+#include <benchmark/benchmark.h>
+#include "benchmark_env.h"
+
+using namespace webf;
+
+static const char* kMessages = R"(
+var encoder = new TextEncoder();
+var decoder = new TextDecoder();
+var message = JSON.stringify(Array.from({length: 200}, (_, i) => ({id: i, name: 'user' + i, text: '你好 café 👋'})));
+var bytes = encoder.encode(message);
+var buffer = new Uint8Array(bytes.length);
+)";
+
+static void Encode(benchmark::State& state) {
+  RunScript(state, kMessages, "for (var i = 0; i < 100; i++) encoder.encode(message);");
+}
+
+static void EncodeInto(benchmark::State& state) {
+  RunScript(state, kMessages, "for (var i = 0; i < 100; i++) encoder.encodeInto(message, buffer);");
+}
+
+static void Decode(benchmark::State& state) {
+  RunScript(state, kMessages, "for (var i = 0; i < 100; i++) decoder.decode(bytes);");
+}
+
+static void DecodeStream(benchmark::State& state) {
+  RunScript(state, kMessages,
+            "for (var i = 0; i < 10; i++) {"
+            "  var text = '';"
+            "  for (var offset = 0; offset < bytes.length; offset += 1024)"
+            "    text += decoder.decode(bytes.subarray(offset, offset + 1024), {stream: true});"
+            "  text += decoder.decode();"
+            "}");
+}
+
+BENCHMARK(Encode)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(EncodeInto)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(Decode)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(DecodeStream)->Threads(1)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+// The bulk builtins of typed arrays and of plain arrays of numbers: fill, search, conversion by set() and sort
+// without a comparator, over arrays of a million elements (typed) and a hundred thousand elements (plain).
+
+#include <benchmark/benchmark.h>
+#include "benchmark_env.h"
+
+using namespace webf;
+
+static const char* kArrays = R"(
+var seed = 1;
+function random() { seed = (seed * 1103515245 + 12345) & 0x7fffffff; return seed; }
+var i32 = new Int32Array(1 << 20), f64 = new Float64Array(1 << 20), u16 = new Uint16Array(1 << 20);
+for (var i = 0; i < i32.length; i++) {
+  i32[i] = random() - 0x40000000;
+  f64[i] = (random() - 0x40000000) / 7;
+}
+var numbers = [];
+for (var i = 0; i < 100000; i++)
+  numbers.push(random() % 100000);
+)";
+
+static void TypedArrayFill(benchmark::State& state) {
+  RunScript(state, kArrays, "u16.slice().fill(7); f64.slice().fill(0.5);");
+}
+
+static void TypedArrayIndexOf(benchmark::State& state) {
+  RunScript(state, kArrays, "i32.indexOf(0x7fffffff); f64.indexOf(0.25); u16.includes(1);");
+}
+
+static void TypedArraySetConvert(benchmark::State& state) {
+  RunScript(state, kArrays, "new Float64Array(i32.length).set(i32);");
+}
+
+static void TypedArraySort(benchmark::State& state) {
+  RunScript(state, kArrays, "i32.slice().sort(); f64.slice().sort();");
+}
+
+static void ArrayIndexOfNumber(benchmark::State& state) {
+  RunScript(state, kArrays, "for (var i = 0; i < 20; i++) numbers.indexOf(-1);");
+}
+
+static void ArraySortInt32(benchmark::State& state) {
+  RunScript(state, kArrays, "numbers.slice().sort();");
+}
+
+BENCHMARK(TypedArrayFill)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(TypedArrayIndexOf)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(TypedArraySetConvert)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(TypedArraySort)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(ArrayIndexOfNumber)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(ArraySortInt32)->Threads(1)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2022-present The WebF authors. All rights reserved.
+ */
+
+// UTF-8 <-> UTF-16 conversions at the bridge boundary: short UI labels, long Latin-1 paragraphs and CJK text,
+// converted to JS strings, to NativeString for Dart and back.
+
+#include <benchmark/benchmark.h>
+#include "benchmark_env.h"
+#include "bindings/qjs/native_string_utils.h"
+
+using namespace webf;
+
+static std::string Repeat(const std::string& text, size_t count) {
+  std::string result;
+  for (size_t i = 0; i < count; i++) {
+    result += text;
+  }
+  return result;
+}
+
+static const std::string kLabel = "Submit order";
+static const std::string kParagraph =
+    Repeat("The quick brown fox jumps over the lazy dog, caf\xc3\xa9 cr\xc3\xa8me br\xc3\xbbl\xc3\xa9" "e. ", 400);
+static const std::string kCJK = Repeat("\xe6\x95\x8f\xe6\x8d\xb7\xe7\x9a\x84\xe6\xa3\x95\xe8\x89\xb2 fox \xf0\x9f\xa6\x8a ", 400);
+
+static void ToJSString(benchmark::State& state, const std::string& text) {
+  JSContext* ctx = BenchmarkContext()->ctx();
+  for (auto _ : state) {
+    for (int i = 0; i < 100; i++) {
+      JSValue value = JS_NewStringLen(ctx, text.c_str(), text.size());
+      size_t length;
+      const char* utf8 = JS_ToCStringLen(ctx, &length, value);
+      benchmark::DoNotOptimize(utf8);
+      JS_FreeCString(ctx, utf8);
+      JS_FreeValue(ctx, value);
+    }
+  }
+}
+
+static void ToNativeString(benchmark::State& state, const std::string& text) {
+  for (auto _ : state) {
+    for (int i = 0; i < 100; i++) {
+      auto native_string = stringToNativeString(text);
+      benchmark::DoNotOptimize(nativeStringToStdString(native_string.get()));
+    }
+  }
+}
+
+static void JSStringLabel(benchmark::State& state) {
+  ToJSString(state, kLabel);
+}
+
+static void JSStringParagraph(benchmark::State& state) {
+  ToJSString(state, kParagraph);
+}
+
+static void JSStringCJK(benchmark::State& state) {
+  ToJSString(state, kCJK);
+}
+
+static void NativeStringLabel(benchmark::State& state) {
+  ToNativeString(state, kLabel);
+}
+
+static void NativeStringParagraph(benchmark::State& state) {
+  ToNativeString(state, kParagraph);
+}
+
+static void NativeStringCJK(benchmark::State& state) {
+  ToNativeString(state, kCJK);
+}
+
+BENCHMARK(JSStringLabel)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(JSStringParagraph)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(JSStringCJK)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(NativeStringLabel)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(NativeStringParagraph)->Threads(1)->Unit(benchmark::kMillisecond);
+BENCHMARK(NativeStringCJK)->Threads(1)->Unit(benchmark::kMillisecond);
@@ -19,6 +19,7 @@ list(APPEND WEBF_UNIT_TEST_SOURCEURCE
   ./bindings/qjs/atomic_string_test.cc
   ./bindings/qjs/script_value_test.cc
   ./bindings/qjs/qjs_engine_patch_test.cc
+  ./bindings/qjs/script_compiler_test.cc
   ./core/dom/events/custom_event_test.cc
   ./core/executing_context_test.cc
   ./core/frame/console_test.cc
@@ -35,6 +36,7 @@ list(APPEND WEBF_UNIT_TEST_SOURCEURCE
   ./core/html/html_element_test.cc
   ./core/html/custom/widget_element_test.cc
   ./core/timing/performance_test.cc
+  ./core/url/url_record_test.cc
 )
 
 ### webf_unit_test executable
@@ -83,6 +85,18 @@ add_executable(webf_benchmark
   ./test/webf_test_env.cc
   ./test/webf_test_env.h
   ./test/benchmark/create_element.cc
+  ./test/benchmark/interpreter.cc
+  ./test/benchmark/evaluate_bundle.cc
+  ./test/benchmark/string_building.cc
+  ./test/benchmark/json.cc
+  ./test/benchmark/typed_array.cc
+  ./test/benchmark/string_search.cc
+  ./test/benchmark/utf_transcoding.cc
+  ./test/benchmark/url.cc
+  ./test/benchmark/text_codec.cc
+  ./test/benchmark/base64.cc
+  ./test/benchmark/html_serializer.cc
+  ./test/benchmark/dom_mutation.cc
 )
 target_include_directories(webf_benchmark PUBLIC
   ./third_party/googletest/googletest/include
@@ -92,6 +106,7 @@ target_include_directories(webf_benchmark PUBLIC
 target_link_libraries(webf_benchmark gtest gtest_main benchmark::benchmark  ${BRIDGE_LINK_LIBS})
 target_compile_definitions(webf_benchmark PUBLIC -DFLUTTER_BACKEND=0)
 target_compile_definitions(webf_benchmark PUBLIC -DUNIT_TEST=1)
+target_compile_definitions(webf_benchmark PUBLIC -DSPEC_FILE_PATH="${CMAKE_CURRENT_SOURCE_DIR}")
 
 # Built libwebf_test.dylib library for integration test with flutter.
 add_library(webf_test SHARED ${WEBF_TEST_SOURCE})
@@ -336,6 +336,81 @@ int unicode_to_utf8(uint8_t *buf, unsigned int c);
 int unicode_from_utf8(const uint8_t *p, int max_len, const uint8_t **pp);
 int utf8_str_len(const uint8_t *p_start, const uint8_t *p_end);
 
+/* Bulk transcoding between UTF-8, Latin-1 and UTF-16. Runs of ASCII are
+   processed with SIMD instructions when available. */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Decode lone (resp. encoded) surrogates as U+FFFD instead of keeping
+   them as WTF-8. */
+#define UTF8_STRICT 1
+
+enum {
+    UTF8_PLAIN_ASCII = 0, /* 7-bit ASCII only */
+    UTF8_NON_ASCII   = 1, /* has non ASCII code points */
+    UTF8_HAS_16BIT   = 2, /* has code points above 0xFF */
+    UTF8_HAS_ERRORS  = 4, /* has ill-formed sequences, decoded as U+FFFD */
+};
+
+/* Return the UTF8_xxx kind of src[0..len) and store its length in
+   UTF-16 code units in *plen16. */
+int utf8_scan(const uint8_t *src, size_t len, size_t *plen16, int flags);
+/* Decode to Latin-1, src must have been scanned without UTF8_HAS_16BIT.
+   Return the number of bytes written. */
+size_t utf8_decode_buf8(uint8_t *dst, const uint8_t *src, size_t len);
+/* Decode to UTF-16, ill-formed sequences are replaced with U+FFFD as
+   specified by the WHATWG Encoding standard. Return the number of code
+   units written. */
+size_t utf8_decode_buf16(uint16_t *dst, const uint8_t *src, size_t len, int flags);
+/* Length in UTF-8 of the Latin-1 string src[0..len). */
+size_t utf8_encode_len8(const uint8_t *src, size_t len);
+size_t utf8_encode_buf8(uint8_t *dst, const uint8_t *src, size_t len);
+/* Length in UTF-8 of the UTF-16 string src[0..len). */
+size_t utf8_encode_len16(const uint16_t *src, size_t len);
+/* Encode to UTF-8, lone surrogates are kept as WTF-8 unless UTF8_STRICT.
+   Return the number of bytes written. */
+size_t utf8_encode_buf16(uint8_t *dst, const uint16_t *src, size_t len, int flags);
+/* Same as utf8_encode_buf8() and utf8_encode_buf16(), but stop before
+   the first code point which does not fit in dst[0..dst_len). The number
+   of source characters consumed is stored in *pread. */
+size_t utf8_encode_buf8_partial(uint8_t *dst, size_t dst_len,
+                                const uint8_t *src, size_t len, size_t *pread);
+size_t utf8_encode_buf16_partial(uint8_t *dst, size_t dst_len,
+                                 const uint16_t *src, size_t len,
+                                 size_t *pread, int flags);
+
+/* Length of the prefix of src[0..len) which fits in Latin-1. */
+size_t utf16_latin1_len(const uint16_t *src, size_t len);
+void latin1_to_utf16(uint16_t *dst, const uint8_t *src, size_t len);
+/* The code units of src[0..len) must all fit in Latin-1. */
+void utf16_to_latin1(uint8_t *dst, const uint16_t *src, size_t len);
+
+/* Base64 with the standard alphabet, as used by atob() and btoa(). */
+
+#define B64_ERROR ((size_t)-1)
+
+static inline size_t b64_encode_len(size_t len)
+{
+    return (len + 2) / 3 * 4;
+}
+/* Encode with padding. Return the number of characters written. */
+size_t b64_encode(uint8_t *dst, const uint8_t *src, size_t len);
+/* Upper bound of the decoded length of src[0..len). */
+static inline size_t b64_decode_len(size_t len)
+{
+    return (len + 3) / 4 * 3;
+}
+/* Forgiving-base64 decode as specified by the WHATWG Infra standard: ASCII
+   whitespace is skipped and the padding is optional. Return the number of
+   bytes written, or B64_ERROR if src is not correctly encoded. */
+size_t b64_decode(uint8_t *dst, const uint8_t *src, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
 static inline int from_hex(int c)
 {
     if (c >= '0' && c <= '9')
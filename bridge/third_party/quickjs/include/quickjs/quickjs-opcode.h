@@ -366,6 +366,16 @@ DEF(     get_field2_ic, 5, 1, 2, none)
 DEF(      put_field_ic, 5, 2, 0, none)
 DEF(      debugger, 1, 0, 0, none)
 
+#ifdef CONFIG_SUPERINSTRUCTIONS
+/* fused sequences emitted by resolve_labels(). They are appended so that
+   bytecode compiled without them keeps its opcode numbering. */
+DEF(get_loc_get_field, 7, 0, 1, atom_u16) /* get_loc(n) get_field(a) */
+DEF(get_arg_get_field, 7, 0, 1, atom_u16) /* get_arg(n) get_field(a) */
+DEF(get_loc_get_field_ic, 7, 0, 1, none)
+DEF(get_arg_get_field_ic, 7, 0, 1, none)
+DEF(   push_i32_add, 5, 1, 1, i32) /* push_i32(x) add */
+#endif
+
 #undef DEF
 #undef def
 #endif  /* DEF */
@@ -86,6 +86,7 @@ enum {
   JS_TAG_BIG_FLOAT = -9,
   JS_TAG_SYMBOL = -8,
   JS_TAG_STRING = -7,
+  JS_TAG_STRING_ROPE = -6,       /* used internally */
   JS_TAG_MODULE = -3,            /* used internally */
   JS_TAG_FUNCTION_BYTECODE = -2, /* used internally */
   JS_TAG_OBJECT = -1,
@@ -328,6 +329,12 @@ static inline JS_BOOL JS_VALUE_IS_NAN(JSValue v) {
 #define JS_EVAL_FLAG_COMPILE_ONLY (1 << 5)
 /* don't include the stack frames before this eval in the Error() backtraces */
 #define JS_EVAL_FLAG_BACKTRACE_BARRIER (1 << 6)
+/* defer the compilation of the function bodies until their first call
+  (global code only, ignored with JS_EVAL_FLAG_COMPILE_ONLY). The syntax
+  errors of a deferred body are thrown when it is first called, so this
+  is not spec compliant and must be enabled explicitly. Lazy functions
+  cannot be serialized with JS_WriteObject(). */
+#define JS_EVAL_FLAG_LAZY_FUNCTIONS (1 << 7)
 
 typedef JSValue JSCFunction(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv);
 typedef JSValue JSCFunctionMagic(JSContext *ctx, JSValueConst this_val, int argc, JSValueConst *argv, int magic);
@@ -362,7 +369,21 @@ void JS_SetMaxStackSize(JSRuntime *rt, size_t stack_size);
   used to check stack overflow. */
 void JS_UpdateStackTop(JSRuntime *rt);
 JSRuntime *JS_NewRuntime2(const JSMallocFunctions *mf, void *opaque);
+/* same as JS_NewRuntime() but attribute every allocation to the context
+   which made it, see JS_GetContextMemoryUsage() */
+JSRuntime *JS_NewRuntimeWithMemoryAccounting(void);
 void JS_FreeRuntime(JSRuntime *rt);
+/* Compiled RegExp bytecode is cached per runtime, keyed by source and
+   flags, and shared by all its contexts. A capacity of 0 disables and
+   empties the cache. */
+typedef struct JSRegExpCacheStats {
+  uint32_t count;
+  uint32_t capacity;
+  uint64_t hit_count;
+  uint64_t miss_count;
+} JSRegExpCacheStats;
+void JS_SetRegExpCacheCapacity(JSRuntime *rt, uint32_t capacity);
+void JS_GetRegExpCacheStats(JSRuntime *rt, JSRegExpCacheStats *s);
 void *JS_GetRuntimeOpaque(JSRuntime *rt);
 void JS_SetRuntimeOpaque(JSRuntime *rt, void *opaque);
 typedef void JS_MarkFunc(JSRuntime *rt, JSGCObjectHeader *gp);
@@ -436,6 +457,21 @@ typedef struct JSMemoryUsage {
 } JSMemoryUsage;
 
 void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s);
+
+typedef struct JSContextMemoryUsage {
+  int64_t malloc_size;
+  int64_t malloc_count;
+  int64_t soft_limit;
+  int64_t hard_limit;
+  JS_BOOL soft_limit_exceeded;
+} JSContextMemoryUsage;
+
+/* Only meaningful for runtimes created with
+   JS_NewRuntimeWithMemoryAccounting(), otherwise all the counters are 0. */
+void JS_GetContextMemoryUsage(JSContext *ctx, JSContextMemoryUsage *s);
+/* Crossing 'soft_limit' runs a GC and flags the context, allocations beyond
+   'hard_limit' fail with an out of memory error. Use 0 to disable a limit. */
+void JS_SetContextMemoryLimit(JSContext *ctx, size_t soft_limit, size_t hard_limit);
 void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt);
 
 /* atom support */
@@ -637,9 +673,10 @@ static inline JS_BOOL JS_IsUninitialized(JSValueConst v)
   return js_unlikely(JS_VALUE_GET_TAG(v) == JS_TAG_UNINITIALIZED);
 }
 
+/* Also true for ropes, which are only flat strings once converted with JS_ToString() */
 static inline JS_BOOL JS_IsString(JSValueConst v)
 {
-  return JS_VALUE_GET_TAG(v) == JS_TAG_STRING;
+  return JS_VALUE_GET_TAG(v) == JS_TAG_STRING || JS_VALUE_GET_TAG(v) == JS_TAG_STRING_ROPE;
 }
 
 static inline JS_BOOL JS_IsSymbol(JSValueConst v)
@@ -742,6 +779,17 @@ JSValue JS_NewArray(JSContext *ctx);
 int JS_IsArray(JSContext *ctx, JSValueConst val);
 
 typedef struct InlineCache InlineCache;
+/* Property access inline cache counters of a bytecode function. They are
+   only collected when QuickJS is built with CONFIG_IC_STATS, otherwise -1 is
+   returned. 'megamorphic_count' counts the accesses served by the shared stub
+   cache. */
+typedef struct JSInlineCacheStats {
+  int64_t hit_count;
+  int64_t miss_count;
+  int64_t megamorphic_count;
+} JSInlineCacheStats;
+int JS_GetFunctionInlineCacheStats(JSContext *ctx, JSValueConst func, JSInlineCacheStats *s);
+void JS_DumpInlineCacheStats(JSRuntime *rt, FILE *fp);
 JSValue JS_GetPropertyInternal(JSContext* ctx, JSValueConst obj, JSAtom prop, JSValueConst receiver, InlineCache *ic, JS_BOOL throw_ref_error);
 JSValue JS_GetPropertyInternalWithIC(JSContext* ctx, JSValueConst obj, JSAtom prop, JSValueConst receiver, InlineCache *ic, int32_t offset, JS_BOOL throw_ref_error);
 static js_force_inline JSValue JS_GetProperty(JSContext* ctx, JSValueConst this_obj, JSAtom prop) {
@@ -809,6 +857,16 @@ JSValue JS_NewArrayBufferCopy(JSContext* ctx, const uint8_t* buf, size_t len);
 void JS_DetachArrayBuffer(JSContext *ctx, JSValueConst obj);
 uint8_t* JS_GetArrayBuffer(JSContext* ctx, size_t* psize, JSValueConst obj);
 JSValue JS_GetTypedArrayBuffer(JSContext* ctx, JSValueConst obj, size_t* pbyte_offset, size_t* pbyte_length, size_t* pbytes_per_element);
+/* Bytes viewed by an ArrayBuffer, SharedArrayBuffer, typed array or
+   DataView. Return -1 with an exception if 'obj' is none of them. */
+int JS_GetBufferSourceBytes(JSContext* ctx, uint8_t** pdata, size_t* psize, JSValueConst obj);
+/* Create a Uint8Array of 'len' bytes. Its contents are left uninitialized
+   and must be filled by the caller through *pdata. */
+JSValue JS_NewUint8Array(JSContext* ctx, size_t len, uint8_t** pdata);
+/* Create a Uint8Array of 'len' bytes which takes 'buf', allocated with
+   js_malloc() and possibly larger than 'len'. 'buf' is freed with the
+   array, or right away on failure. */
+JSValue JS_NewUint8ArrayFromData(JSContext* ctx, uint8_t* buf, size_t len);
 typedef struct {
   void* (*sab_alloc)(void* opaque, size_t size);
   void (*sab_free)(void* opaque, void* ptr);
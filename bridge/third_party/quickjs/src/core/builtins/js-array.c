@@ -792,6 +792,8 @@ exception:
 JSValue js_array_fill(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
   JSValue obj;
   int64_t len, start, end;
+  JSValue* arrp;
+  uint32_t count;
 
   obj = JS_ToObject(ctx, this_val);
   if (js_get_length64(ctx, &len, obj))
@@ -809,7 +811,11 @@ JSValue js_array_fill(JSContext* ctx, JSValueConst this_val, int argc, JSValueCo
       goto exception;
   }
 
-  /* XXX: should special case fast arrays */
+  if (js_get_fast_array(ctx, obj, &arrp, &count) && end <= count) {
+    for (; start < end; start++)
+      set_value(ctx, &arrp[start], JS_DupValue(ctx, argv[0]));
+    return obj;
+  }
   while (start < end) {
     if (JS_SetPropertyInt64(ctx, obj, start, JS_DupValue(ctx, argv[0])) < 0)
       goto exception;
@@ -822,6 +828,60 @@ exception:
   return JS_EXCEPTION;
 }
 
+/* A number or an object is strictly equal to an element only if the
+   element holds the same number or object: such values are searched in
+   the fast array elements directly, without js_strict_eq2. */
+static BOOL js_array_fast_find_supported(JSValueConst val) {
+  int tag = JS_VALUE_GET_NORM_TAG(val);
+  return tag == JS_TAG_INT || tag == JS_TAG_FLOAT64 || tag == JS_TAG_OBJECT;
+}
+
+/* Return the index of the first element of arrp[n..count) equal to val,
+   -1 if none. NaN is found only with 'same_value_zero' (includes). */
+static int64_t js_array_fast_find(const JSValue* arrp, int64_t n, uint32_t count, JSValueConst val, BOOL same_value_zero) {
+  JSValueConst v;
+  double d, e;
+
+  if (JS_VALUE_GET_TAG(val) == JS_TAG_OBJECT) {
+    JSObject* p = JS_VALUE_GET_OBJ(val);
+    for (; n < count; n++) {
+      v = arrp[n];
+      if (JS_VALUE_GET_TAG(v) == JS_TAG_OBJECT && JS_VALUE_GET_OBJ(v) == p)
+        return n;
+    }
+    return -1;
+  }
+  if (JS_VALUE_GET_TAG(val) == JS_TAG_INT) {
+    int32_t i = JS_VALUE_GET_INT(val);
+    for (; n < count; n++) {
+      v = arrp[n];
+      if (JS_VALUE_GET_TAG(v) == JS_TAG_INT) {
+        if (JS_VALUE_GET_INT(v) == i)
+          return n;
+      } else if (JS_TAG_IS_FLOAT64(JS_VALUE_GET_TAG(v))) {
+        if (JS_VALUE_GET_FLOAT64(v) == i)
+          return n;
+      }
+    }
+    return -1;
+  }
+  d = JS_VALUE_GET_FLOAT64(val);
+  if (isnan(d) && !same_value_zero)
+    return -1;
+  for (; n < count; n++) {
+    v = arrp[n];
+    if (JS_VALUE_GET_TAG(v) == JS_TAG_INT) {
+      if (JS_VALUE_GET_INT(v) == d)
+        return n;
+    } else if (JS_TAG_IS_FLOAT64(JS_VALUE_GET_TAG(v))) {
+      e = JS_VALUE_GET_FLOAT64(v);
+      if (e == d || (isnan(e) && isnan(d)))
+        return n;
+    }
+  }
+  return -1;
+}
+
 JSValue js_array_includes(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
   JSValue obj, val;
   int64_t len, n, res;
@@ -840,6 +900,13 @@ JSValue js_array_includes(JSContext* ctx, JSValueConst this_val, int argc, JSVal
         goto exception;
     }
     if (js_get_fast_array(ctx, obj, &arrp, &count)) {
+      if (js_array_fast_find_supported(argv[0])) {
+        if (js_array_fast_find(arrp, n, count, argv[0], TRUE) >= 0) {
+          res = TRUE;
+          goto done;
+        }
+        n = max_int64(n, count);
+      }
       for (; n < count; n++) {
         if (js_strict_eq2(ctx, JS_DupValue(ctx, argv[0]), JS_DupValue(ctx, arrp[n]), JS_EQ_SAME_VALUE_ZERO)) {
           res = TRUE;
@@ -884,6 +951,12 @@ JSValue js_array_indexOf(JSContext* ctx, JSValueConst this_val, int argc, JSValu
         goto exception;
     }
     if (js_get_fast_array(ctx, obj, &arrp, &count)) {
+      if (js_array_fast_find_supported(argv[0])) {
+        res = js_array_fast_find(arrp, n, count, argv[0], FALSE);
+        if (res >= 0)
+          goto done;
+        n = max_int64(n, count);
+      }
       for (; n < count; n++) {
         if (js_strict_eq2(ctx, JS_DupValue(ctx, argv[0]), JS_DupValue(ctx, arrp[n]), JS_EQ_STRICT)) {
           res = n;
@@ -1464,6 +1537,10 @@ exception:
 }
 
 /* Array sort */
+static const uint32_t js_pow10_u32[10] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000,
+};
+
 typedef struct ValueSlot {
   JSValue val;
   JSString* str;
@@ -1538,6 +1615,64 @@ exception:
   return 0;
 }
 
+/* Without a comparator, the elements are sorted by their string values.
+   A fast array of int32 values is sorted without converting them: each
+   value is mapped to a key whose order is the order of its decimal
+   string. From the high bits: 1 for the non negative values ('-' sorts
+   before the digits), the digits of the absolute value padded with zeros
+   to 10 digits, then the number of digits so that a prefix sorts first. */
+#define JS_ARRAY_SORT_KEY_POSITIVE ((uint64_t)1 << 40)
+
+static uint64_t js_array_sort_int32_key(int32_t v) {
+  uint32_t a = v < 0 ? -(uint32_t)v : v;
+  uint64_t scaled = a;
+  int digits = 1;
+
+  while (digits < 10 && a >= js_pow10_u32[digits])
+    digits++;
+  if (digits < 10)
+    scaled *= js_pow10_u32[10 - digits];
+  return (v < 0 ? 0 : JS_ARRAY_SORT_KEY_POSITIVE) | (scaled << 4) | digits;
+}
+
+static int32_t js_array_sort_int32_value(uint64_t key) {
+  int digits = key & 15;
+  uint64_t a = (key & (JS_ARRAY_SORT_KEY_POSITIVE - 1)) >> 4;
+
+  if (digits < 10)
+    a /= js_pow10_u32[10 - digits];
+  return (key & JS_ARRAY_SORT_KEY_POSITIVE) ? (int32_t)a : (int32_t)-(int64_t)a;
+}
+
+static int js_array_cmp_sort_key(const void* a, const void* b, void* opaque) {
+  uint64_t x = *(const uint64_t*)a;
+  uint64_t y = *(const uint64_t*)b;
+  return (y < x) - (y > x);
+}
+
+/* Return 1 if the array was sorted, 0 if it does not only hold int32
+   values and -1 if exception. */
+static int js_array_sort_int32(JSContext* ctx, JSValue* arrp, uint32_t count) {
+  uint64_t* keys;
+  uint32_t i;
+
+  for (i = 0; i < count; i++) {
+    if (JS_VALUE_GET_TAG(arrp[i]) != JS_TAG_INT)
+      return 0;
+  }
+  keys = js_malloc(ctx, count * sizeof(keys[0]));
+  if (!keys)
+    return -1;
+  for (i = 0; i < count; i++)
+    keys[i] = js_array_sort_int32_key(JS_VALUE_GET_INT(arrp[i]));
+  /* equal keys are equal values, stability does not matter */
+  rqsort(keys, count, sizeof(keys[0]), js_array_cmp_sort_key, NULL);
+  for (i = 0; i < count; i++)
+    arrp[i] = JS_NewInt32(ctx, js_array_sort_int32_value(keys[i]));
+  js_free(ctx, keys);
+  return 1;
+}
+
 JSValue js_array_sort(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
   struct array_sort_context asc = {ctx, 0, 0, argv[0]};
   JSValue obj = JS_UNDEFINED;
@@ -1545,6 +1680,8 @@ JSValue js_array_sort(JSContext* ctx, JSValueConst this_val, int argc, JSValueCo
   size_t array_size = 0, pos = 0, n = 0;
   int64_t i, len, undefined_count = 0;
   int present;
+  JSValue* arrp;
+  uint32_t count;
 
   if (!JS_IsUndefined(asc.method)) {
     if (check_function(ctx, asc.method))
@@ -1555,6 +1692,14 @@ JSValue js_array_sort(JSContext* ctx, JSValueConst this_val, int argc, JSValueCo
   if (js_get_length64(ctx, &len, obj))
     goto exception;
 
+  if (!asc.has_method && len > 1 && js_get_fast_array(ctx, obj, &arrp, &count) && count == len) {
+    int sorted = js_array_sort_int32(ctx, arrp, count);
+    if (sorted < 0)
+      goto exception;
+    if (sorted)
+      return obj;
+  }
+
   /* XXX: should special case fast arrays */
   for (i = 0; i < len; i++) {
     if (pos >= array_size) {
@@ -234,6 +234,7 @@ redo:
       bf_rint(r, BF_RNDZ);
       JS_FreeValue(ctx, val);
       break;
+    case JS_TAG_STRING_ROPE:
     case JS_TAG_STRING:
       val = JS_StringToBigIntErr(ctx, val);
       if (JS_IsException(val))
@@ -1519,10 +1520,10 @@ no_inline __exception int js_add_slow(JSContext *ctx, JSValue *sp)
     /* try to call an overloaded operator */
     if ((tag1 == JS_TAG_OBJECT &&
          (tag2 != JS_TAG_NULL && tag2 != JS_TAG_UNDEFINED &&
-          tag2 != JS_TAG_STRING)) ||
+          !tag_is_string(tag2))) ||
         (tag2 == JS_TAG_OBJECT &&
          (tag1 != JS_TAG_NULL && tag1 != JS_TAG_UNDEFINED &&
-          tag1 != JS_TAG_STRING))) {
+          !tag_is_string(tag1)))) {
       ret = js_call_binary_op_fallback(ctx, &res, op1, op2, OP_add,
                                        FALSE, HINT_NONE);
       if (ret != 0) {
@@ -1552,7 +1553,7 @@ no_inline __exception int js_add_slow(JSContext *ctx, JSValue *sp)
     tag2 = JS_VALUE_GET_NORM_TAG(op2);
   }
 
-  if (tag1 == JS_TAG_STRING || tag2 == JS_TAG_STRING) {
+  if (tag_is_string(tag1) || tag_is_string(tag2)) {
     sp[-2] = JS_ConcatString(ctx, op1, op2);
     if (JS_IsException(sp[-2]))
       goto exception;
@@ -1835,6 +1836,8 @@ no_inline int js_relational_slow(JSContext *ctx, JSValue *sp,
     JS_FreeValue(ctx, op1);
     goto exception;
   }
+  if (js_string_flatten2(ctx, &op1, &op2))
+    goto exception;
   tag1 = JS_VALUE_GET_NORM_TAG(op1);
   tag2 = JS_VALUE_GET_NORM_TAG(op2);
 
@@ -1969,6 +1972,9 @@ no_inline __exception int js_eq_slow(JSContext *ctx, JSValue *sp,
   op1 = sp[-2];
   op2 = sp[-1];
 redo:
+  /* ropes compare as their flat strings */
+  if (js_string_flatten2(ctx, &op1, &op2))
+    goto exception;
   tag1 = JS_VALUE_GET_NORM_TAG(op1);
   tag2 = JS_VALUE_GET_NORM_TAG(op2);
   if (tag_is_number(tag1) && tag_is_number(tag2)) {
@@ -2352,7 +2358,7 @@ no_inline __exception int js_add_slow(JSContext *ctx, JSValue *sp)
     }
     tag1 = JS_VALUE_GET_TAG(op1);
     tag2 = JS_VALUE_GET_TAG(op2);
-    if (tag1 == JS_TAG_STRING || tag2 == JS_TAG_STRING) {
+    if (tag_is_string(tag1) || tag_is_string(tag2)) {
       sp[-2] = JS_ConcatString(ctx, op1, op2);
       if (JS_IsException(sp[-2]))
         goto exception;
@@ -2447,6 +2453,8 @@ no_inline int js_relational_slow(JSContext *ctx, JSValue *sp,
     JS_FreeValue(ctx, op1);
     goto exception;
   }
+  if (js_string_flatten2(ctx, &op1, &op2))
+    goto exception;
   if (JS_VALUE_GET_TAG(op1) == JS_TAG_STRING &&
       JS_VALUE_GET_TAG(op2) == JS_TAG_STRING) {
     JSString *p1, *p2;
@@ -2512,6 +2520,9 @@ no_inline __exception int js_eq_slow(JSContext *ctx, JSValue *sp,
   op1 = sp[-2];
   op2 = sp[-1];
 redo:
+  /* ropes compare as their flat strings */
+  if (js_string_flatten2(ctx, &op1, &op2))
+    goto exception;
   tag1 = JS_VALUE_GET_NORM_TAG(op1);
   tag2 = JS_VALUE_GET_NORM_TAG(op2);
   if (tag1 == tag2 ||
@@ -2955,6 +2966,7 @@ redo:
       if (JS_IsException(val))
         break;
       goto redo;
+    case JS_TAG_STRING_ROPE:
     case JS_TAG_STRING:
       val = JS_StringToBigIntErr(ctx, val);
       break;
@@ -3509,6 +3521,7 @@ JSValue js_bigfloat_constructor(JSContext *ctx,
         if (JS_IsException(val))
           break;
         goto redo;
+      case JS_TAG_STRING_ROPE:
       case JS_TAG_STRING:
       {
         const char *str, *p;
@@ -4187,6 +4200,7 @@ redo:
       if (JS_IsException(val))
         break;
       goto redo;
+    case JS_TAG_STRING_ROPE:
     case JS_TAG_STRING:
     {
       const char *str, *p;
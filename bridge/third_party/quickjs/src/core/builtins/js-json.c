@@ -30,6 +30,7 @@
 #include "../object.h"
 #include "../parser.h"
 #include "../runtime.h"
+#include "../shape.h"
 #include "../string.h"
 #include "../types.h"
 #include "js-array.h"
@@ -307,6 +308,25 @@ JSValue js_json_parse(JSContext *ctx, JSValueConst this_val,
   return obj;
 }
 
+/* Enumerable keys of a plain object shape, in JSON.stringify() order.
+   Records of the same kind share their shape, so their keys are listed
+   and quoted once per call instead of once per object. */
+typedef struct JSONShapeProp {
+  uint32_t idx; /* index in the property array of the object */
+  JSAtom atom;
+  JSValue key; /* passed to toJSON() and to the replacer */
+  JSValue quoted_key;
+} JSONShapeProp;
+
+typedef struct JSONShapeEntry {
+  int ref_count; /* the cache slot and the objects being serialized */
+  JSShape *shape;
+  uint32_t prop_count;
+  JSONShapeProp props[0];
+} JSONShapeEntry;
+
+#define JSON_SHAPE_CACHE_SIZE 16
+
 typedef struct JSONStringifyContext {
   JSValueConst replacer_func;
   JSValue stack;
@@ -314,8 +334,136 @@ typedef struct JSONStringifyContext {
   JSValue gap;
   JSValue empty;
   StringBuffer *b;
+  JSONShapeEntry *shape_cache[JSON_SHAPE_CACHE_SIZE];
 } JSONStringifyContext;
 
+JSValue js_json_check(JSContext *ctx, JSONStringifyContext *jsc,
+                      JSValueConst holder, JSValue val, JSValueConst key);
+int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
+                   JSValueConst holder, JSValue val, JSValueConst indent);
+
+static void json_free_shape_entry(JSContext *ctx, JSONShapeEntry *se)
+{
+  uint32_t i;
+
+  if (--se->ref_count > 0)
+    return;
+  for(i = 0; i < se->prop_count; i++) {
+    JS_FreeAtom(ctx, se->props[i].atom);
+    JS_FreeValue(ctx, se->props[i].key);
+    JS_FreeValue(ctx, se->props[i].quoted_key);
+  }
+  js_free_shape(ctx->rt, se->shape);
+  js_free(ctx, se);
+}
+
+/* Return in *pse the key list of the shape of p with a reference, or
+   NULL when p must go through the generic path. Only hashed shapes are
+   cached: the reference held by the cache makes any later change of
+   the properties of an object clone its shape instead of updating it
+   in place. */
+static int json_get_shape_entry(JSContext *ctx, JSONStringifyContext *jsc,
+                                JSObject *p, JSONShapeEntry **pse)
+{
+  JSShape *sh = p->shape;
+  JSShapeProperty *prs;
+  JSONShapeEntry *se, **pslot;
+  uint32_t i, n, idx;
+
+  *pse = NULL;
+  if (p->class_id != JS_CLASS_OBJECT || !sh->is_hashed ||
+      !JS_IsUndefined(jsc->property_list))
+    return 0;
+  pslot = &jsc->shape_cache[((uintptr_t)sh >> 4) & (JSON_SHAPE_CACHE_SIZE - 1)];
+  se = *pslot;
+  if (se && se->shape == sh)
+    goto done;
+
+  n = 0;
+  for(i = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+    if (prs->atom == JS_ATOM_NULL || !JS_AtomIsString(ctx, prs->atom) ||
+        !(prs->flags & JS_PROP_ENUMERABLE))
+      continue;
+    /* getters run user code, and the index keys are listed first */
+    if ((prs->flags & JS_PROP_TMASK) != JS_PROP_NORMAL ||
+        JS_AtomIsArrayIndex(ctx, &idx, prs->atom))
+      return 0;
+    n++;
+  }
+  se = js_malloc(ctx, sizeof(*se) + n * sizeof(se->props[0]));
+  if (!se)
+    return -1;
+  se->ref_count = 1;
+  se->shape = js_dup_shape(sh);
+  se->prop_count = 0;
+  for(i = 0, prs = get_shape_prop(sh); i < sh->prop_count; i++, prs++) {
+    JSONShapeProp *sp;
+    if (prs->atom == JS_ATOM_NULL || !JS_AtomIsString(ctx, prs->atom) ||
+        !(prs->flags & JS_PROP_ENUMERABLE))
+      continue;
+    sp = &se->props[se->prop_count];
+    sp->key = JS_AtomToString(ctx, prs->atom);
+    if (JS_IsException(sp->key))
+      goto fail;
+    sp->quoted_key = JS_ToQuotedString(ctx, sp->key);
+    if (JS_IsException(sp->quoted_key)) {
+      JS_FreeValue(ctx, sp->key);
+      goto fail;
+    }
+    sp->idx = i;
+    sp->atom = JS_DupAtom(ctx, prs->atom);
+    se->prop_count++;
+  }
+  if (*pslot)
+    json_free_shape_entry(ctx, *pslot);
+  *pslot = se;
+done:
+  se->ref_count++;
+  *pse = se;
+  return 0;
+fail:
+  json_free_shape_entry(ctx, se);
+  return -1;
+}
+
+/* Serialize the properties of val listed in se, in the same way as the
+   generic path does with the result of Object.keys(). */
+static int json_to_str_shape(JSContext *ctx, JSONStringifyContext *jsc,
+                             JSValueConst val, JSONShapeEntry *se,
+                             JSValueConst sep, JSValueConst sep1,
+                             JSValueConst indent1, BOOL *phas_content)
+{
+  JSObject *p = JS_VALUE_GET_OBJ(val);
+  JSValue v;
+  uint32_t i;
+
+  for(i = 0; i < se->prop_count; i++) {
+    JSONShapeProp *sp = &se->props[i];
+    /* toJSON() or the replacer may have changed the object meanwhile */
+    if (likely(p->shape == se->shape))
+      v = JS_DupValue(ctx, p->prop[sp->idx].u.value);
+    else
+      v = JS_GetProperty(ctx, val, sp->atom);
+    if (JS_IsException(v))
+      return -1;
+    v = js_json_check(ctx, jsc, val, v, sp->key);
+    if (JS_IsException(v))
+      return -1;
+    if (!JS_IsUndefined(v)) {
+      if (*phas_content)
+        string_buffer_putc8(jsc->b, ',');
+      string_buffer_concat_value(jsc->b, sep);
+      string_buffer_concat_value(jsc->b, sp->quoted_key);
+      string_buffer_putc8(jsc->b, ':');
+      string_buffer_concat_value(jsc->b, sep1);
+      if (js_json_to_str(ctx, jsc, val, v, indent1))
+        return -1;
+      *phas_content = TRUE;
+    }
+  }
+  return 0;
+}
+
 JSValue JS_ToQuotedStringFree(JSContext *ctx, JSValue val) {
   JSValue r = JS_ToQuotedString(ctx, val);
   JS_FreeValue(ctx, val);
@@ -362,6 +510,7 @@ JSValue js_json_check(JSContext *ctx, JSONStringifyContext *jsc,
       if (JS_IsFunction(ctx, val))
         break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
     case JS_TAG_INT:
     case JS_TAG_FLOAT64:
 #ifdef CONFIG_BIGNUM
@@ -489,6 +638,18 @@ int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
         }
         string_buffer_putc8(jsc->b, ']');
       } else {
+        JSONShapeEntry *se;
+        if (json_get_shape_entry(ctx, jsc, p, &se))
+          goto exception;
+        if (se) {
+          string_buffer_putc8(jsc->b, '{');
+          has_content = FALSE;
+          ret = json_to_str_shape(ctx, jsc, val, se, sep, sep1, indent1, &has_content);
+          json_free_shape_entry(ctx, se);
+          if (ret)
+            goto exception;
+          goto close_object;
+        }
         if (!JS_IsUndefined(jsc->property_list))
           tab = JS_DupValue(ctx, jsc->property_list);
         else
@@ -527,6 +688,7 @@ int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
             has_content = TRUE;
           }
         }
+      close_object:
         if (has_content && JS_VALUE_GET_STRING(jsc->gap)->len != 0) {
           string_buffer_putc8(jsc->b, '\n');
           string_buffer_concat_value(jsc->b, indent);
@@ -543,10 +705,16 @@ int js_json_to_str(JSContext *ctx, JSONStringifyContext *jsc,
       JS_FreeValue(ctx, prop);
       return 0;
     case JS_TAG_STRING:
-      val = JS_ToQuotedStringFree(ctx, val);
-      if (JS_IsException(val))
+    case JS_TAG_STRING_ROPE:
+    {
+      /* quoted straight into the output */
+      JSString *str = JS_VALUE_GET_TAG(val) == JS_TAG_STRING ? JS_VALUE_GET_STRING(val) : js_string_rope_flatten(ctx, val);
+      if (!str)
         goto exception;
-      goto concat_value;
+      ret = string_buffer_put_quoted(jsc->b, str);
+      JS_FreeValue(ctx, val);
+      return ret;
+    }
     case JS_TAG_FLOAT64:
       if (!isfinite(JS_VALUE_GET_FLOAT64(val))) {
         val = JS_NULL;
@@ -595,6 +763,7 @@ JSValue JS_JSONStringify(JSContext *ctx, JSValueConst obj,
   jsc->gap = JS_UNDEFINED;
   jsc->b = &b_s;
   jsc->empty = JS_AtomToString(ctx, JS_ATOM_empty_string);
+  memset(jsc->shape_cache, 0, sizeof(jsc->shape_cache));
   ret = JS_UNDEFINED;
   wrapper = JS_UNDEFINED;
 
@@ -672,8 +841,8 @@ JSValue JS_JSONStringify(JSContext *ctx, JSValueConst obj,
       goto exception;
     jsc->gap = JS_NewStringLen(ctx, "          ", n);
   } else if (JS_IsString(space)) {
-    JSString *p = JS_VALUE_GET_STRING(space);
-    jsc->gap = js_sub_string(ctx, p, 0, min_int(p->len, 10));
+    JSString *p = JS_VALUE_GET_TAG(space) == JS_TAG_STRING ? JS_VALUE_GET_STRING(space) : js_string_rope_flatten(ctx, space);
+    jsc->gap = p ? js_sub_string(ctx, p, 0, min_int(p->len, 10)) : JS_EXCEPTION;
   } else {
     jsc->gap = JS_DupValue(ctx, jsc->empty);
   }
@@ -706,6 +875,10 @@ exception:
 done1:
   string_buffer_free(jsc->b);
 done:
+  for(i = 0; i < JSON_SHAPE_CACHE_SIZE; i++) {
+    if (jsc->shape_cache[i])
+      json_free_shape_entry(ctx, jsc->shape_cache[i]);
+  }
   JS_FreeValue(ctx, wrapper);
   JS_FreeValue(ctx, jsc->empty);
   JS_FreeValue(ctx, jsc->gap);
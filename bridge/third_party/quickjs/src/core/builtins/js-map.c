@@ -174,6 +174,13 @@ JSValueConst map_normalize_key(JSContext *ctx, JSValueConst key)
   /* convert -0.0 to +0.0 */
   if (JS_TAG_IS_FLOAT64(tag) && JS_VALUE_GET_FLOAT64(key) == 0.0) {
     key = JS_NewInt32(ctx, 0);
+  } else if (tag == JS_TAG_STRING_ROPE) {
+    /* hash and store the flat string, it is owned by the rope */
+    JSString *p = js_string_rope_flatten(ctx, key);
+    if (p)
+      key = JS_MKPTR(JS_TAG_STRING, p);
+    else
+      JS_FreeValue(ctx, JS_GetException(ctx));
   }
   return key;
 }
@@ -79,6 +79,12 @@ JSValue JS_ToObject(JSContext* ctx, JSValueConst val) {
         JS_DefinePropertyValue(ctx, obj, JS_ATOM_length, JS_NewInt32(ctx, p1->len), 0);
       }
       goto set_value;
+    case JS_TAG_STRING_ROPE: {
+      JSString* p1 = js_string_rope_flatten(ctx, val);
+      if (!p1)
+        return JS_EXCEPTION;
+      return JS_ToObject(ctx, JS_MKPTR(JS_TAG_STRING, p1));
+    }
     case JS_TAG_BOOL:
       obj = JS_NewObjectClass(ctx, JS_CLASS_BOOLEAN);
       goto set_value;
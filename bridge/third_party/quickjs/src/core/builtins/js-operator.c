@@ -76,16 +76,16 @@ BOOL js_strict_eq2(JSContext* ctx, JSValue op1, JSValue op2, JSStrictEqModeEnum
     case JS_TAG_UNDEFINED:
       res = (tag1 == tag2);
       break;
-    case JS_TAG_STRING: {
-      JSString *p1, *p2;
-      if (tag1 != tag2) {
+    case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
+      if (!tag_is_string(tag2)) {
         res = FALSE;
+      } else if (tag1 == JS_TAG_STRING && tag2 == JS_TAG_STRING) {
+        res = (js_string_compare(ctx, JS_VALUE_GET_STRING(op1), JS_VALUE_GET_STRING(op2)) == 0);
       } else {
-        p1 = JS_VALUE_GET_STRING(op1);
-        p2 = JS_VALUE_GET_STRING(op2);
-        res = (js_string_compare(ctx, p1, p2) == 0);
+        res = js_string_value_eq(ctx, op1, op2);
       }
-    } break;
+      break;
     case JS_TAG_SYMBOL: {
       JSAtomStruct *p1, *p2;
       if (tag1 != tag2) {
@@ -304,6 +304,7 @@ __exception int js_operator_typeof(JSContext* ctx, JSValueConst op1) {
       atom = JS_ATOM_boolean;
       break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
       atom = JS_ATOM_string;
       break;
     case JS_TAG_OBJECT: {
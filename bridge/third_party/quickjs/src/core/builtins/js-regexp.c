@@ -29,6 +29,7 @@
 #include "../convertion.h"
 #include "../exception.h"
 #include "../function.h"
+#include "../malloc.h"
 #include "../object.h"
 #include "../runtime.h"
 #include "../string.h"
@@ -49,6 +50,116 @@ void js_regexp_finalizer(JSRuntime *rt, JSValue val)
   JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_STRING, re->pattern));
 }
 
+/* Compiled RegExp cache: patterns built at run time, such as new
+   RegExp(pattern) in a render loop or the string patterns given to
+   replace() and split(), are compiled once per runtime. The bytecode is
+   an immutable string, so the RegExp objects of every context share
+   it. */
+#define JS_REGEXP_CACHE_HASH_SIZE 256
+
+typedef struct JSRegExpCacheEntry {
+  struct list_head link; /* in JSRuntime.regexp_cache_list */
+  struct JSRegExpCacheEntry *hash_next;
+  uint32_t hash;
+  int re_flags;
+  JSString *pattern;
+  JSString *bytecode;
+} JSRegExpCacheEntry;
+
+static void js_regexp_cache_remove(JSRuntime *rt, JSRegExpCacheEntry *e)
+{
+  JSRegExpCacheEntry **pe;
+
+  pe = &rt->regexp_cache_hash[e->hash & (JS_REGEXP_CACHE_HASH_SIZE - 1)];
+  while (*pe != e)
+    pe = &(*pe)->hash_next;
+  *pe = e->hash_next;
+  list_del(&e->link);
+  rt->regexp_cache_count--;
+  JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_STRING, e->pattern));
+  JS_FreeValueRT(rt, JS_MKPTR(JS_TAG_STRING, e->bytecode));
+  js_free_rt(rt, e);
+}
+
+void js_regexp_cache_clear(JSRuntime *rt)
+{
+  struct list_head *el, *el1;
+
+  list_for_each_safe(el, el1, &rt->regexp_cache_list) {
+    js_regexp_cache_remove(rt, list_entry(el, JSRegExpCacheEntry, link));
+  }
+  js_free_rt(rt, rt->regexp_cache_hash);
+  rt->regexp_cache_hash = NULL;
+}
+
+static JSRegExpCacheEntry *js_regexp_cache_find(JSContext *ctx, JSString *pattern,
+                                                int re_flags, uint32_t hash)
+{
+  JSRuntime *rt = ctx->rt;
+  JSRegExpCacheEntry *e;
+
+  if (!rt->regexp_cache_hash)
+    return NULL;
+  for(e = rt->regexp_cache_hash[hash & (JS_REGEXP_CACHE_HASH_SIZE - 1)]; e; e = e->hash_next) {
+    if (e->hash == hash && e->re_flags == re_flags &&
+        e->pattern->len == pattern->len &&
+        js_string_compare(ctx, e->pattern, pattern) == 0) {
+      /* most recently used first */
+      list_del(&e->link);
+      list_add(&e->link, &rt->regexp_cache_list);
+      return e;
+    }
+  }
+  return NULL;
+}
+
+/* failing to cache is not an error, the bytecode is just not shared */
+static void js_regexp_cache_add(JSContext *ctx, JSString *pattern, int re_flags,
+                                uint32_t hash, JSValueConst bc)
+{
+  JSRuntime *rt = ctx->rt;
+  JSRegExpCacheEntry *e, **pe;
+
+  if (!rt->regexp_cache_hash) {
+    rt->regexp_cache_hash = js_mallocz_rt(rt, sizeof(rt->regexp_cache_hash[0]) * JS_REGEXP_CACHE_HASH_SIZE);
+    if (!rt->regexp_cache_hash)
+      return;
+  }
+  e = js_malloc_rt(rt, sizeof(*e));
+  if (!e)
+    return;
+  while (rt->regexp_cache_count >= rt->regexp_cache_capacity) {
+    js_regexp_cache_remove(rt, list_entry(rt->regexp_cache_list.prev, JSRegExpCacheEntry, link));
+  }
+  e->hash = hash;
+  e->re_flags = re_flags;
+  e->pattern = JS_VALUE_GET_STRING(JS_DupValue(ctx, JS_MKPTR(JS_TAG_STRING, pattern)));
+  e->bytecode = JS_VALUE_GET_STRING(JS_DupValue(ctx, bc));
+  pe = &rt->regexp_cache_hash[hash & (JS_REGEXP_CACHE_HASH_SIZE - 1)];
+  e->hash_next = *pe;
+  *pe = e;
+  list_add(&e->link, &rt->regexp_cache_list);
+  rt->regexp_cache_count++;
+}
+
+void JS_SetRegExpCacheCapacity(JSRuntime *rt, uint32_t capacity)
+{
+  rt->regexp_cache_capacity = capacity;
+  while (rt->regexp_cache_count > capacity) {
+    js_regexp_cache_remove(rt, list_entry(rt->regexp_cache_list.prev, JSRegExpCacheEntry, link));
+  }
+  if (capacity == 0)
+    js_regexp_cache_clear(rt);
+}
+
+void JS_GetRegExpCacheStats(JSRuntime *rt, JSRegExpCacheStats *s)
+{
+  s->count = rt->regexp_cache_count;
+  s->capacity = rt->regexp_cache_capacity;
+  s->hit_count = rt->regexp_cache_hits;
+  s->miss_count = rt->regexp_cache_misses;
+}
+
 /* create a string containing the RegExp bytecode */
 JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
                                  JSValueConst flags)
@@ -60,6 +171,8 @@ JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
   int re_bytecode_len;
   JSValue ret;
   char error_msg[64];
+  BOOL cacheable;
+  uint32_t hash = 0;
 
   re_flags = 0;
   if (!JS_IsUndefined(flags)) {
@@ -100,6 +213,19 @@ JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
     JS_FreeCString(ctx, str);
   }
 
+  cacheable = ctx->rt->regexp_cache_capacity > 0 &&
+              JS_VALUE_GET_TAG(pattern) == JS_TAG_STRING;
+  if (cacheable) {
+    JSRegExpCacheEntry *e;
+    hash = hash_string(JS_VALUE_GET_STRING(pattern), re_flags);
+    e = js_regexp_cache_find(ctx, JS_VALUE_GET_STRING(pattern), re_flags, hash);
+    if (e) {
+      ctx->rt->regexp_cache_hits++;
+      return JS_DupValue(ctx, JS_MKPTR(JS_TAG_STRING, e->bytecode));
+    }
+    ctx->rt->regexp_cache_misses++;
+  }
+
   str = JS_ToCStringLen2(ctx, &len, pattern, !(re_flags & LRE_FLAG_UTF16));
   if (!str)
     return JS_EXCEPTION;
@@ -113,6 +239,8 @@ JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
 
   ret = js_new_string8(ctx, re_bytecode_buf, re_bytecode_len);
   js_free(ctx, re_bytecode_buf);
+  if (cacheable && !JS_IsException(ret))
+    js_regexp_cache_add(ctx, JS_VALUE_GET_STRING(pattern), re_flags, hash, ret);
   return ret;
 }
 
@@ -482,8 +610,11 @@ BOOL lre_check_stack_overflow(void *opaque, size_t alloca_size)
 void *lre_realloc(void *opaque, void *ptr, size_t size)
 {
   JSContext *ctx = opaque;
+  JSMemoryAccount *prev = js_enter_memory_account(ctx);
   /* No JS exception is raised here */
-  return js_realloc_rt(ctx->rt, ptr, size);
+  ptr = js_realloc_rt(ctx->rt, ptr, size);
+  js_leave_memory_account(ctx->rt, prev);
+  return ptr;
 }
 
 JSValue js_regexp_exec(JSContext *ctx, JSValueConst this_val,
@@ -33,4 +33,9 @@ JSValue js_compile_regexp(JSContext *ctx, JSValueConst pattern,
 JSValue js_regexp_constructor_internal(JSContext *ctx, JSValueConst ctor,
                                               JSValue pattern, JSValue bc);
 
+/* number of compiled RegExps kept by a new runtime */
+#define JS_REGEXP_CACHE_DEFAULT_CAPACITY 64
+
+void js_regexp_cache_clear(JSRuntime *rt);
+
 #endif
\ No newline at end of file
@@ -28,6 +28,8 @@
 #include "../exception.h"
 #include "../function.h"
 #include "../object.h"
+#include "../runtime.h"
+#include "../simd.h"
 #include "../string.h"
 #include "../types.h"
 #include "js-function.h"
@@ -149,6 +151,8 @@ JSValue js_string_constructor(JSContext* ctx, JSValueConst new_target, int argc,
 JSValue js_thisStringValue(JSContext* ctx, JSValueConst this_val) {
   if (JS_VALUE_GET_TAG(this_val) == JS_TAG_STRING)
     return JS_DupValue(ctx, this_val);
+  if (JS_VALUE_GET_TAG(this_val) == JS_TAG_STRING_ROPE)
+    return JS_ToString(ctx, this_val);
 
   if (JS_VALUE_GET_TAG(this_val) == JS_TAG_OBJECT) {
     JSObject* p = JS_VALUE_GET_OBJ(this_val);
@@ -374,6 +378,16 @@ JSValue js_string_concat(JSContext* ctx, JSValueConst this_val, int argc, JSValu
 
 int string_cmp(JSString* p1, JSString* p2, int x1, int x2, int len) {
   int i, c1, c2;
+  /* the callers mostly test for equality */
+  if (p1->is_wide_char == p2->is_wide_char) {
+    if (p1->is_wide_char) {
+      if (!memcmp(p1->u.str16 + x1, p2->u.str16 + x2, len * 2))
+        return 0;
+    } else {
+      if (!memcmp(p1->u.str8 + x1, p2->u.str8 + x2, len))
+        return 0;
+    }
+  }
   for (i = 0; i < len; i++) {
     if ((c1 = string_get(p1, x1 + i)) != (c2 = string_get(p2, x2 + i)))
       return c1 - c2;
@@ -385,32 +399,159 @@ int string_indexof_char(JSString* p, int c, int from) {
   /* assuming 0 <= from <= p->len */
   int i, len = p->len;
   if (p->is_wide_char) {
-    for (i = from; i < len; i++) {
-      if (p->u.str16[i] == c)
+    if ((c & ~0xffff) == 0) {
+      i = from + js_simd_find_u16(p->u.str16 + from, len - from, c);
+      if (i < len)
         return i;
     }
   } else {
     if ((c & ~0xff) == 0) {
-      for (i = from; i < len; i++) {
-        if (p->u.str8[i] == (uint8_t)c)
-          return i;
+      const uint8_t* q = memchr(p->u.str8 + from, c, len - from);
+      if (q)
+        return q - p->u.str8;
+    }
+  }
+  return -1;
+}
+
+/* Crochemore-Perrin critical factorization of p[0..n): return the
+   position of the factorization and the period of its right part. */
+static int string_critical_factorization(JSString* p, int n, int* period) {
+  int ms, ms_rev, j, k, per, a, b;
+
+  /* maximal suffix for the '<' order */
+  ms = -1;
+  j = 0;
+  k = per = 1;
+  while (j + k < n) {
+    a = string_get(p, j + k);
+    b = string_get(p, ms + k);
+    if (a < b) {
+      j += k;
+      k = 1;
+      per = j - ms;
+    } else if (a == b) {
+      if (k != per) {
+        k++;
+      } else {
+        j += per;
+        k = 1;
+      }
+    } else {
+      ms = j++;
+      k = per = 1;
+    }
+  }
+  *period = per;
+
+  /* maximal suffix for the '>' order */
+  ms_rev = -1;
+  j = 0;
+  k = per = 1;
+  while (j + k < n) {
+    a = string_get(p, j + k);
+    b = string_get(p, ms_rev + k);
+    if (b < a) {
+      j += k;
+      k = 1;
+      per = j - ms_rev;
+    } else if (a == b) {
+      if (k != per) {
+        k++;
+      } else {
+        j += per;
+        k = 1;
+      }
+    } else {
+      ms_rev = j++;
+      k = per = 1;
+    }
+  }
+  if (ms_rev < ms)
+    return ms + 1;
+  *period = per;
+  return ms_rev + 1;
+}
+
+/* Two-way string matching, linear in the worst case. */
+static int string_indexof_two_way(JSString* p1, JSString* p2, int from) {
+  int len1 = p1->len, len2 = p2->len;
+  int suffix, period, memory, i, j;
+
+  suffix = string_critical_factorization(p2, len2, &period);
+  j = from;
+  if (period + suffix <= len2 && !string_cmp(p2, p2, 0, period, suffix)) {
+    /* periodic needle: remember the length of the matched prefix */
+    memory = 0;
+    while (j <= len1 - len2) {
+      i = max_int(suffix, memory);
+      while (i < len2 && string_get(p2, i) == string_get(p1, i + j))
+        i++;
+      if (i >= len2) {
+        i = suffix - 1;
+        while (i >= memory && string_get(p2, i) == string_get(p1, i + j))
+          i--;
+        if (i < memory)
+          return j;
+        j += period;
+        memory = len2 - period;
+      } else {
+        j += i - suffix + 1;
+        memory = 0;
+      }
+    }
+  } else {
+    period = max_int(suffix, len2 - suffix) + 1;
+    while (j <= len1 - len2) {
+      i = suffix;
+      while (i < len2 && string_get(p2, i) == string_get(p1, i + j))
+        i++;
+      if (i >= len2) {
+        i = suffix - 1;
+        while (i >= 0 && string_get(p2, i) == string_get(p1, i + j))
+          i--;
+        if (i < 0)
+          return j;
+        j += period;
+      } else {
+        j += i - suffix + 1;
       }
     }
   }
   return -1;
 }
 
+/* The positions where both the first and the last characters of p2
+   match are found 16 bytes at a time, then compared. When too many of
+   them fail, as with periodic strings, the search goes on with the
+   two-way algorithm. */
 int string_indexof(JSString* p1, JSString* p2, int from) {
   /* assuming 0 <= from <= p1->len */
-  int c, i, j, len1 = p1->len, len2 = p2->len;
+  int c0, c1, i, n, fails, len1 = p1->len, len2 = p2->len;
   if (len2 == 0)
     return from;
-  for (i = from, c = string_get(p2, 0); i + len2 <= len1; i = j + 1) {
-    j = string_indexof_char(p1, c, i);
-    if (j < 0 || j + len2 > len1)
+  if (len2 == 1)
+    return string_indexof_char(p1, string_get(p2, 0), from);
+  if (len2 > len1 - from)
+    return -1;
+  c0 = string_get(p2, 0);
+  c1 = string_get(p2, len2 - 1);
+  if (!p1->is_wide_char && (c0 > 0xff || c1 > 0xff))
+    return -1;
+  /* number of candidate positions */
+  n = len1 - len2 + 1;
+  fails = 0;
+  for (i = from; i < n; i++) {
+    if (p1->is_wide_char)
+      i += js_simd_find_pair_u16(p1->u.str16 + i, n - i, c0, c1, len2 - 1);
+    else
+      i += js_simd_find_pair_u8(p1->u.str8 + i, n - i, c0, c1, len2 - 1);
+    if (i >= n)
       break;
-    if (!string_cmp(p1, p2, j + 1, 1, len2 - 1))
-      return j;
+    if (!string_cmp(p1, p2, i + 1, 1, len2 - 2))
+      return i;
+    if (++fails > 16 && fails > (i - from) >> 3)
+      return string_indexof_two_way(p1, p2, i + 1);
   }
   return -1;
 }
@@ -469,7 +610,10 @@ JSValue js_string_indexOf(JSContext* ctx, JSValueConst this_val, int argc, JSVal
     inc = 1;
   }
   ret = -1;
-  if (len >= v_len && inc * (stop - start) >= 0) {
+  if (len >= v_len && inc > 0) {
+    if (start <= stop)
+      ret = string_indexof(p, p1, start);
+  } else if (len >= v_len && inc * (stop - start) >= 0) {
     for (i = start;; i += inc) {
       if (!string_cmp(p, p1, i, 0, v_len)) {
         ret = i;
@@ -494,7 +638,7 @@ int js_is_regexp(JSContext* ctx, JSValueConst obj);
 
 JSValue js_string_includes(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv, int magic) {
   JSValue str, v = JS_UNDEFINED;
-  int i, len, v_len, pos, start, stop, ret;
+  int len, v_len, pos, start, stop, ret;
   JSString* p;
   JSString* p1;
 
@@ -534,14 +678,10 @@ JSValue js_string_includes(JSContext* ctx, JSValueConst this_val, int argc, JSVa
     start = stop = pos;
   }
   if (start >= 0 && start <= stop) {
-    for (i = start;; i++) {
-      if (!string_cmp(p, p1, i, 0, v_len)) {
-        ret = 1;
-        break;
-      }
-      if (i == stop)
-        break;
-    }
+    if (magic == 0)
+      ret = string_indexof(p, p1, start) >= 0;
+    else
+      ret = !string_cmp(p, p1, start, 0, v_len);
   }
 done:
   JS_FreeValue(ctx, str);
@@ -646,7 +786,7 @@ JSValue js_string___GetSubstitution(JSContext* ctx, JSValueConst this_val, int a
   namedCaptures = argv[4];
   rep = argv[5];
 
-  if (!JS_IsString(rep) || !JS_IsString(str))
+  if (JS_VALUE_GET_TAG(rep) != JS_TAG_STRING || JS_VALUE_GET_TAG(str) != JS_TAG_STRING)
     return JS_ThrowTypeError(ctx, "not a string");
 
   sp = JS_VALUE_GET_STRING(str);
@@ -743,7 +883,7 @@ JSValue js_string_replace(JSContext* ctx, JSValueConst this_val, int argc, JSVal
   JSValue str, search_str, replaceValue_str, repl_str;
   JSString *sp, *searchp;
   StringBuffer b_s, *b = &b_s;
-  int pos, functionalReplace, endOfLastMatch;
+  int pos, functionalReplace, literalReplace, endOfLastMatch;
   BOOL is_first;
 
   if (JS_IsUndefined(O) || JS_IsNull(O))
@@ -777,10 +917,13 @@ JSValue js_string_replace(JSContext* ctx, JSValueConst this_val, int argc, JSVal
   if (JS_IsException(search_str))
     goto exception;
   functionalReplace = JS_IsFunction(ctx, replaceValue);
+  literalReplace = FALSE;
   if (!functionalReplace) {
     replaceValue_str = JS_ToString(ctx, replaceValue);
     if (JS_IsException(replaceValue_str))
       goto exception;
+    /* without '$' patterns, the replacement is copied as is */
+    literalReplace = string_indexof_char(JS_VALUE_GET_STRING(replaceValue_str), '$', 0) < 0;
   }
 
   sp = JS_VALUE_GET_STRING(str);
@@ -808,7 +951,9 @@ JSValue js_string_replace(JSContext* ctx, JSValueConst this_val, int argc, JSVal
         break;
       }
     }
-    if (functionalReplace) {
+    if (literalReplace) {
+      repl_str = JS_DupValue(ctx, replaceValue_str);
+    } else if (functionalReplace) {
       args[0] = search_str;
       args[1] = JS_NewInt32(ctx, pos);
       args[2] = str;
@@ -911,16 +1056,17 @@ JSValue js_string_split(JSContext* ctx, JSValueConst this_val, int argc, JSValue
     T = js_sub_string(ctx, sp, p, e);
     if (JS_IsException(T))
       goto exception;
-    if (JS_CreateDataPropertyUint32(ctx, A, lengthA++, T, 0) < 0)
+    /* A is a new fast array, append the parts in place */
+    if (add_fast_array_element(ctx, JS_VALUE_GET_OBJ(A), T, 0) < 0)
       goto exception;
-    if (lengthA == lim)
+    if (++lengthA == lim)
       goto done;
   }
 add_tail:
   T = js_sub_string(ctx, sp, p, s);
   if (JS_IsException(T))
     goto exception;
-  if (JS_CreateDataPropertyUint32(ctx, A, lengthA++, T, 0) < 0)
+  if (add_fast_array_element(ctx, JS_VALUE_GET_OBJ(A), T, 0) < 0)
     goto exception;
 done:
   JS_FreeValue(ctx, S);
@@ -29,6 +29,7 @@
 #include "../function.h"
 #include "../object.h"
 #include "../runtime.h"
+#include "../simd.h"
 #include "../string.h"
 #include "js-array.h"
 #include "js-atomics.h"
@@ -430,6 +431,69 @@ JSValue JS_GetTypedArrayBuffer(JSContext* ctx, JSValueConst obj, size_t* pbyte_o
   return JS_DupValue(ctx, JS_MKPTR(JS_TAG_OBJECT, ta->buffer));
 }
 
+int JS_GetBufferSourceBytes(JSContext* ctx, uint8_t** pdata, size_t* psize, JSValueConst obj) {
+  JSObject* p;
+  JSArrayBuffer* abuf;
+  JSTypedArray* ta;
+
+  if (JS_VALUE_GET_TAG(obj) != JS_TAG_OBJECT)
+    goto fail;
+  p = JS_VALUE_GET_OBJ(obj);
+  if (p->class_id == JS_CLASS_ARRAY_BUFFER || p->class_id == JS_CLASS_SHARED_ARRAY_BUFFER) {
+    abuf = p->u.array_buffer;
+    *pdata = abuf->data;
+    *psize = abuf->byte_length;
+    return 0;
+  }
+  if (p->class_id >= JS_CLASS_UINT8C_ARRAY && p->class_id <= JS_CLASS_DATAVIEW) {
+    ta = p->u.typed_array;
+    abuf = ta->buffer->u.array_buffer;
+    /* a detached buffer views no bytes */
+    if (abuf->detached) {
+      *pdata = NULL;
+      *psize = 0;
+    } else {
+      *pdata = abuf->data + ta->offset;
+      *psize = ta->length;
+    }
+    return 0;
+  }
+fail:
+  JS_ThrowTypeError(ctx, "not an ArrayBuffer or ArrayBufferView");
+  return -1;
+}
+
+JSValue JS_NewUint8Array(JSContext* ctx, size_t len, uint8_t** pdata) {
+  uint8_t* buf;
+
+  /* the contents are not zeroed, the caller writes all of them */
+  buf = js_malloc(ctx, max_int(len, 1));
+  if (!buf)
+    return JS_EXCEPTION;
+  *pdata = buf;
+  return JS_NewUint8ArrayFromData(ctx, buf, len);
+}
+
+JSValue JS_NewUint8ArrayFromData(JSContext* ctx, uint8_t* buf, size_t len) {
+  JSValue buffer, obj;
+
+  buffer = js_array_buffer_constructor3(ctx, JS_UNDEFINED, len, JS_CLASS_ARRAY_BUFFER, buf, js_array_buffer_free, NULL, FALSE);
+  if (JS_IsException(buffer)) {
+    js_free(ctx, buf);
+    return JS_EXCEPTION;
+  }
+  obj = js_create_from_ctor(ctx, JS_UNDEFINED, JS_CLASS_UINT8_ARRAY);
+  if (JS_IsException(obj)) {
+    JS_FreeValue(ctx, buffer);
+    return JS_EXCEPTION;
+  }
+  if (typed_array_init(ctx, obj, buffer, 0, len)) {
+    JS_FreeValue(ctx, obj);
+    return JS_EXCEPTION;
+  }
+  return obj;
+}
+
 JSValue js_typed_array_get_toStringTag(JSContext* ctx, JSValueConst this_val) {
   JSObject* p;
   if (JS_VALUE_GET_TAG(this_val) != JS_TAG_OBJECT)
@@ -440,6 +504,94 @@ JSValue js_typed_array_get_toStringTag(JSContext* ctx, JSValueConst this_val) {
   return JS_AtomToString(ctx, ctx->rt->class_array[p->class_id].class_name);
 }
 
+/* Copy the elements of the typed array src to dst from the element
+   dst_pos, converting them to the element type of dst. Only the
+   conversions which are exact C casts of the source values are handled:
+   from an integer array to any non BigInt array, or between the float
+   arrays. Return FALSE if the element types are not handled. */
+static BOOL js_typed_array_convert(JSObject* dst, uint32_t dst_pos, JSObject* src) {
+  double buf[64];
+  uint32_t len = src->u.array.count, i, j, n;
+  BOOL src_float = (src->class_id == JS_CLASS_FLOAT32_ARRAY || src->class_id == JS_CLASS_FLOAT64_ARRAY);
+  BOOL dst_float = (dst->class_id == JS_CLASS_FLOAT32_ARRAY || dst->class_id == JS_CLASS_FLOAT64_ARRAY);
+
+  if ((src->class_id > JS_CLASS_UINT32_ARRAY && !src_float) || (dst->class_id > JS_CLASS_UINT32_ARRAY && !dst_float))
+    return FALSE;
+  if (src_float && !dst_float)
+    return FALSE;
+
+  for (i = 0; i < len; i += n) {
+    n = min_uint32(len - i, countof(buf));
+    switch (src->class_id) {
+      case JS_CLASS_INT8_ARRAY:
+        for (j = 0; j < n; j++)
+          buf[j] = src->u.array.u.int8_ptr[i + j];
+        break;
+      case JS_CLASS_UINT8C_ARRAY:
+      case JS_CLASS_UINT8_ARRAY:
+        for (j = 0; j < n; j++)
+          buf[j] = src->u.array.u.uint8_ptr[i + j];
+        break;
+      case JS_CLASS_INT16_ARRAY:
+        for (j = 0; j < n; j++)
+          buf[j] = src->u.array.u.int16_ptr[i + j];
+        break;
+      case JS_CLASS_UINT16_ARRAY:
+        for (j = 0; j < n; j++)
+          buf[j] = src->u.array.u.uint16_ptr[i + j];
+        break;
+      case JS_CLASS_INT32_ARRAY:
+        for (j = 0; j < n; j++)
+          buf[j] = src->u.array.u.int32_ptr[i + j];
+        break;
+      case JS_CLASS_UINT32_ARRAY:
+        for (j = 0; j < n; j++)
+          buf[j] = src->u.array.u.uint32_ptr[i + j];
+        break;
+      case JS_CLASS_FLOAT32_ARRAY:
+        for (j = 0; j < n; j++)
+          buf[j] = src->u.array.u.float_ptr[i + j];
+        break;
+      case JS_CLASS_FLOAT64_ARRAY:
+        memcpy(buf, src->u.array.u.double_ptr + i, n * sizeof(double));
+        break;
+      default:
+        abort();
+    }
+    switch (dst->class_id) {
+      case JS_CLASS_UINT8C_ARRAY:
+        for (j = 0; j < n; j++)
+          dst->u.array.u.uint8_ptr[dst_pos + i + j] = buf[j] < 0 ? 0 : buf[j] > 255 ? 255 : (uint8_t)buf[j];
+        break;
+      case JS_CLASS_INT8_ARRAY:
+      case JS_CLASS_UINT8_ARRAY:
+        for (j = 0; j < n; j++)
+          dst->u.array.u.uint8_ptr[dst_pos + i + j] = (int64_t)buf[j];
+        break;
+      case JS_CLASS_INT16_ARRAY:
+      case JS_CLASS_UINT16_ARRAY:
+        for (j = 0; j < n; j++)
+          dst->u.array.u.uint16_ptr[dst_pos + i + j] = (int64_t)buf[j];
+        break;
+      case JS_CLASS_INT32_ARRAY:
+      case JS_CLASS_UINT32_ARRAY:
+        for (j = 0; j < n; j++)
+          dst->u.array.u.uint32_ptr[dst_pos + i + j] = (int64_t)buf[j];
+        break;
+      case JS_CLASS_FLOAT32_ARRAY:
+        for (j = 0; j < n; j++)
+          dst->u.array.u.float_ptr[dst_pos + i + j] = buf[j];
+        break;
+      case JS_CLASS_FLOAT64_ARRAY:
+        memcpy(dst->u.array.u.double_ptr + dst_pos + i, buf, n * sizeof(double));
+        break;
+      default:
+        abort();
+    }
+  }
+  return TRUE;
+}
+
 JSValue js_typed_array_set_internal(JSContext* ctx, JSValueConst dst, JSValueConst src, JSValueConst off) {
   JSObject* p;
   JSObject* src_p;
@@ -486,7 +638,13 @@ JSValue js_typed_array_set_internal(JSContext* ctx, JSValueConst dst, JSValueCon
     if (dest_abuf->data == src_abuf->data) {
       /* copying between the same buffer using different types of mappings
          would require a temporary buffer */
+      uint32_t dst_start = dest_ta->offset + (offset << shift);
+      uint32_t src_start = src_ta->offset;
+      if (dst_start < src_start + src_ta->length && src_start < dst_start + (src_len << shift))
+        goto slow_path;
     }
+    if (js_typed_array_convert(p, offset, src_p))
+      goto done;
     /* otherwise, default behavior is slow but correct */
   } else {
     if (js_get_length64(ctx, &src_len, src_obj))
@@ -497,6 +655,7 @@ JSValue js_typed_array_set_internal(JSContext* ctx, JSValueConst dst, JSValueCon
       goto fail;
     }
   }
+slow_path:
   for (i = 0; i < src_len; i++) {
     val = JS_GetPropertyUint32(ctx, src_obj, i);
     if (JS_IsException(val))
@@ -758,6 +917,20 @@ JSValue js_typed_array_copyWithin(JSContext* ctx, JSValueConst this_val, int arg
   return JS_DupValue(ctx, this_val);
 }
 
+/* Replicate the first element of ptr[0..size) over the whole range. The
+   copies are done by memcpy from the start of the range, which stays in
+   the cache, in blocks growing up to JS_TA_FILL_BLOCK_SIZE bytes. */
+#define JS_TA_FILL_BLOCK_SIZE 4096
+
+static void js_typed_array_fill_pattern(uint8_t* ptr, size_t size, size_t elt_size) {
+  size_t filled = elt_size, n;
+  while (filled < size) {
+    n = min_int64(min_int64(filled, size - filled), JS_TA_FILL_BLOCK_SIZE);
+    memcpy(ptr + filled, ptr, n);
+    filled += n;
+  }
+}
+
 JSValue js_typed_array_fill(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
   JSObject* p;
   int len, k, final, shift;
@@ -819,29 +992,26 @@ JSValue js_typed_array_fill(JSContext* ctx, JSValueConst this_val, int argc, JSV
     return JS_ThrowTypeErrorDetachedArrayBuffer(ctx);
 
   shift = typed_array_size_log2(p->class_id);
-  switch (shift) {
-    case 0:
-      if (k < final) {
-        memset(p->u.array.u.uint8_ptr + k, v64, final - k);
-      }
-      break;
-    case 1:
-      for (; k < final; k++) {
-        p->u.array.u.uint16_ptr[k] = v64;
-      }
-      break;
-    case 2:
-      for (; k < final; k++) {
-        p->u.array.u.uint32_ptr[k] = v64;
-      }
-      break;
-    case 3:
-      for (; k < final; k++) {
-        p->u.array.u.uint64_ptr[k] = v64;
-      }
-      break;
-    default:
-      abort();
+  if (k < final) {
+    uint8_t* ptr = p->u.array.u.uint8_ptr + ((size_t)k << shift);
+    switch (shift) {
+      case 0:
+        memset(ptr, v64, final - k);
+        break;
+      case 1:
+        *(uint16_t*)ptr = v64;
+        break;
+      case 2:
+        *(uint32_t*)ptr = v64;
+        break;
+      case 3:
+        *(uint64_t*)ptr = v64;
+        break;
+      default:
+        abort();
+    }
+    if (shift != 0)
+      js_typed_array_fill_pattern(ptr, (size_t)(final - k) << shift, 1 << shift);
   }
   return JS_DupValue(ctx, this_val);
 }
@@ -1027,10 +1197,16 @@ JSValue js_typed_array_indexOf(JSContext* ctx, JSValueConst this_val, int argc,
       scan16:
         pv = p->u.array.u.uint16_ptr;
         v = v64;
-        for (; k != stop; k += inc) {
-          if (pv[k] == v) {
+        if (inc > 0) {
+          k += js_simd_find_u16(pv + k, len - k, v);
+          if (k < len)
             res = k;
-            break;
+        } else {
+          for (; k != stop; k += inc) {
+            if (pv[k] == v) {
+              res = k;
+              break;
+            }
           }
         }
       }
@@ -1046,10 +1222,16 @@ JSValue js_typed_array_indexOf(JSContext* ctx, JSValueConst this_val, int argc,
       scan32:
         pv = p->u.array.u.uint32_ptr;
         v = v64;
-        for (; k != stop; k += inc) {
-          if (pv[k] == v) {
+        if (inc > 0) {
+          k += js_simd_find_u32(pv + k, len - k, v);
+          if (k < len)
             res = k;
-            break;
+        } else {
+          for (; k != stop; k += inc) {
+            if (pv[k] == v) {
+              res = k;
+              break;
+            }
           }
         }
       }
@@ -1062,18 +1244,21 @@ JSValue js_typed_array_indexOf(JSContext* ctx, JSValueConst this_val, int argc,
         /* special case: indexOf returns -1, includes finds NaN */
         if (special != special_includes)
           goto done;
-        for (; k != stop; k += inc) {
-          if (isnan(pv[k])) {
-            res = k;
-            break;
-          }
-        }
+        k += js_simd_find_nan_f32(pv + k, len - k);
+        if (k < len)
+          res = k;
       } else if ((f = (float)d) == d) {
         const float* pv = p->u.array.u.float_ptr;
-        for (; k != stop; k += inc) {
-          if (pv[k] == f) {
+        if (inc > 0) {
+          k += js_simd_find_f32(pv + k, len - k, f);
+          if (k < len)
             res = k;
-            break;
+        } else {
+          for (; k != stop; k += inc) {
+            if (pv[k] == f) {
+              res = k;
+              break;
+            }
           }
         }
       }
@@ -1086,18 +1271,21 @@ JSValue js_typed_array_indexOf(JSContext* ctx, JSValueConst this_val, int argc,
         /* special case: indexOf returns -1, includes finds NaN */
         if (special != special_includes)
           goto done;
-        for (; k != stop; k += inc) {
-          if (isnan(pv[k])) {
-            res = k;
-            break;
-          }
-        }
+        k += js_simd_find_nan_f64(pv + k, len - k);
+        if (k < len)
+          res = k;
       } else {
         const double* pv = p->u.array.u.double_ptr;
-        for (; k != stop; k += inc) {
-          if (pv[k] == d) {
+        if (inc > 0) {
+          k += js_simd_find_f64(pv + k, len - k, d);
+          if (k < len)
             res = k;
-            break;
+        } else {
+          for (; k != stop; k += inc) {
+            if (pv[k] == d) {
+              res = k;
+              break;
+            }
           }
         }
       }
@@ -1507,6 +1695,165 @@ int js_TA_cmp_generic(const void* a, const void* b, void* opaque) {
   return cmp;
 }
 
+/* Sorting without a comparator: counting sort for the 8 bit elements,
+   LSD radix sort on the bytes of the elements otherwise. The elements
+   are first mapped to keys whose unsigned order is the order of
+   js_TA_cmp_*, the mapping is reverted once sorted. */
+#define JS_TA_RADIX_SORT_MIN_LEN 64
+
+#define JS_TA_RADIX_SORT(name, type)                            \
+  static type* name(type* a, type* tmp, uint32_t len) {         \
+    uint32_t count[sizeof(type)][256];                          \
+    uint32_t i, pos, c, *cb;                                    \
+    type* t;                                                    \
+    int b;                                                      \
+                                                                \
+    memset(count, 0, sizeof(count));                            \
+    for (i = 0; i < len; i++) {                                 \
+      for (b = 0; b < (int)sizeof(type); b++)                   \
+        count[b][(a[i] >> (b * 8)) & 0xff]++;                   \
+    }                                                           \
+    for (b = 0; b < (int)sizeof(type); b++) {                   \
+      cb = count[b];                                            \
+      /* skip the bytes shared by all the keys */               \
+      if (cb[(a[0] >> (b * 8)) & 0xff] == len)                  \
+        continue;                                               \
+      for (i = 0, pos = 0; i < 256; i++) {                      \
+        c = cb[i];                                              \
+        cb[i] = pos;                                            \
+        pos += c;                                               \
+      }                                                         \
+      for (i = 0; i < len; i++)                                 \
+        tmp[cb[(a[i] >> (b * 8)) & 0xff]++] = a[i];             \
+      t = a;                                                    \
+      a = tmp;                                                  \
+      tmp = t;                                                  \
+    }                                                           \
+    return a;                                                   \
+  }
+
+JS_TA_RADIX_SORT(js_TA_radix_sort16, uint16_t)
+JS_TA_RADIX_SORT(js_TA_radix_sort32, uint32_t)
+JS_TA_RADIX_SORT(js_TA_radix_sort64, uint64_t)
+
+static void js_TA_sort_u8(uint8_t* a, uint32_t len, uint8_t bias) {
+  uint32_t count[256];
+  uint32_t i;
+
+  memset(count, 0, sizeof(count));
+  for (i = 0; i < len; i++)
+    count[a[i] ^ bias]++;
+  for (i = 0; i < 256; i++) {
+    memset(a, i ^ bias, count[i]);
+    a += count[i];
+  }
+}
+
+/* Map the elements to sort keys, or back if 'revert' is set. The float
+   keys put -0 before +0, NaN is partitioned out before. */
+static void js_TA_sort_keys(void* array_ptr, uint32_t len, int class_id, BOOL revert) {
+  uint32_t i;
+
+  switch (class_id) {
+    case JS_CLASS_INT16_ARRAY: {
+      uint16_t* a = array_ptr;
+      for (i = 0; i < len; i++)
+        a[i] ^= 0x8000;
+    } break;
+    case JS_CLASS_INT32_ARRAY: {
+      uint32_t* a = array_ptr;
+      for (i = 0; i < len; i++)
+        a[i] ^= 0x80000000;
+    } break;
+#ifdef CONFIG_BIGNUM
+    case JS_CLASS_BIG_INT64_ARRAY: {
+      uint64_t* a = array_ptr;
+      for (i = 0; i < len; i++)
+        a[i] ^= (uint64_t)1 << 63;
+    } break;
+#endif
+    case JS_CLASS_FLOAT32_ARRAY: {
+      uint32_t* a = array_ptr;
+      for (i = 0; i < len; i++) {
+        if (revert)
+          a[i] = (a[i] & 0x80000000) ? a[i] ^ 0x80000000 : ~a[i];
+        else
+          a[i] = (a[i] & 0x80000000) ? ~a[i] : a[i] ^ 0x80000000;
+      }
+    } break;
+    case JS_CLASS_FLOAT64_ARRAY: {
+      uint64_t* a = array_ptr;
+      uint64_t sign = (uint64_t)1 << 63;
+      for (i = 0; i < len; i++) {
+        if (revert)
+          a[i] = (a[i] & sign) ? a[i] ^ sign : ~a[i];
+        else
+          a[i] = (a[i] & sign) ? ~a[i] : a[i] ^ sign;
+      }
+    } break;
+    default:
+      break;
+  }
+}
+
+static int js_TA_sort_numeric(JSContext* ctx, JSObject* p, uint32_t len) {
+  void* array_ptr = p->u.array.u.ptr;
+  void *tmp, *res;
+  size_t elt_size = 1 << typed_array_size_log2(p->class_id);
+  uint32_t i, n;
+
+  if (elt_size == 1) {
+    js_TA_sort_u8(array_ptr, len, p->class_id == JS_CLASS_INT8_ARRAY ? 0x80 : 0);
+    return 0;
+  }
+  tmp = js_malloc(ctx, len * elt_size);
+  if (!tmp)
+    return -1;
+  /* the NaNs go last in their original order, they are kept in tmp
+     while the other elements are sorted */
+  n = len;
+  if (p->class_id == JS_CLASS_FLOAT32_ARRAY) {
+    float* a = array_ptr;
+    for (i = 0, n = 0; i < len; i++) {
+      if (isnan(a[i]))
+        ((float*)tmp)[i - n] = a[i];
+      else
+        a[n++] = a[i];
+    }
+    memcpy(a + n, tmp, (len - n) * elt_size);
+  } else if (p->class_id == JS_CLASS_FLOAT64_ARRAY) {
+    double* a = array_ptr;
+    for (i = 0, n = 0; i < len; i++) {
+      if (isnan(a[i]))
+        ((double*)tmp)[i - n] = a[i];
+      else
+        a[n++] = a[i];
+    }
+    memcpy(a + n, tmp, (len - n) * elt_size);
+  }
+  if (n > 1) {
+    js_TA_sort_keys(array_ptr, n, p->class_id, FALSE);
+    switch (elt_size) {
+      case 2:
+        res = js_TA_radix_sort16(array_ptr, tmp, n);
+        break;
+      case 4:
+        res = js_TA_radix_sort32(array_ptr, tmp, n);
+        break;
+      case 8:
+        res = js_TA_radix_sort64(array_ptr, tmp, n);
+        break;
+      default:
+        abort();
+    }
+    if (res != array_ptr)
+      memcpy(array_ptr, res, n * elt_size);
+    js_TA_sort_keys(array_ptr, n, p->class_id, TRUE);
+  }
+  js_free(ctx, tmp);
+  return 0;
+}
+
 JSValue js_typed_array_sort(JSContext* ctx, JSValueConst this_val, int argc, JSValueConst* argv) {
   JSObject* p;
   int len;
@@ -1630,6 +1977,9 @@ JSValue js_typed_array_sort(JSContext* ctx, JSValueConst this_val, int argc, JSV
       }
       js_free(ctx, array_tmp);
       js_free(ctx, array_idx);
+    } else if (len >= JS_TA_RADIX_SORT_MIN_LEN) {
+      if (js_TA_sort_numeric(ctx, p, len))
+        return JS_EXCEPTION;
     } else {
       rqsort(array_ptr, len, elt_size, cmpfun, &tsc);
       if (tsc.exception)
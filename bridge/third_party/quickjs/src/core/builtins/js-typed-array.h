@@ -35,6 +35,7 @@ JSValue js_typed_array_constructor(JSContext* ctx, JSValueConst new_target, int
 
 JSArrayBuffer* js_get_array_buffer(JSContext* ctx, JSValueConst obj);
 BOOL typed_array_is_detached(JSContext* ctx, JSObject* p);
+int typed_array_init(JSContext* ctx, JSValueConst obj, JSValue buffer, uint64_t offset, uint64_t len);
 JSValue JS_ThrowTypeErrorDetachedArrayBuffer(JSContext* ctx);
 
 #endif
\ No newline at end of file
@@ -514,6 +514,13 @@ static int JS_WriteFunctionTag(BCWriterState* s, JSValueConst obj) {
   uint32_t flags;
   int idx, i;
 
+  /* a lazy function is compiled from its source, which is not written:
+     once read back there would be no body to compile */
+  if (b->is_lazy) {
+    JS_ThrowTypeError(s->ctx, "cannot serialize a lazily compiled function");
+    return -1;
+  }
+
   bc_put_u8(s, BC_TAG_FUNCTION_BYTECODE);
   flags = idx = 0;
   bc_set_flags(&flags, &idx, b->has_prototype, 1);
@@ -820,6 +827,13 @@ static int JS_WriteObjectRec(BCWriterState* s, JSValueConst obj) {
       bc_put_u8(s, BC_TAG_STRING);
       JS_WriteString(s, p);
     } break;
+    case JS_TAG_STRING_ROPE: {
+      JSString* p = js_string_rope_flatten(s->ctx, obj);
+      if (!p)
+        goto fail;
+      bc_put_u8(s, BC_TAG_STRING);
+      JS_WriteString(s, p);
+    } break;
     case JS_TAG_FUNCTION_BYTECODE:
       if (!s->allow_bytecode)
         goto invalid_tag;
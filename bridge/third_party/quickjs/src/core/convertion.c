@@ -265,6 +265,11 @@ redo:
       if (JS_IsException(val))
         return JS_EXCEPTION;
       goto redo;
+    case JS_TAG_STRING_ROPE:
+      val = js_string_flatten_free(ctx, val);
+      if (JS_IsException(val))
+        return JS_EXCEPTION;
+      goto redo;
     case JS_TAG_STRING: {
       const char* str;
       const char* p;
@@ -727,8 +732,9 @@ int JS_ToBoolFree(JSContext* ctx, JSValue val) {
       return JS_VALUE_GET_INT(val);
     case JS_TAG_EXCEPTION:
       return -1;
-    case JS_TAG_STRING: {
-      BOOL ret = JS_VALUE_GET_STRING(val)->len != 0;
+    case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE: {
+      BOOL ret = js_string_value_len(val) != 0;
       JS_FreeValue(ctx, val);
       return ret;
     }
@@ -1532,6 +1538,12 @@ JSValue JS_ToStringInternal(JSContext* ctx, JSValueConst val, BOOL is_ToProperty
   switch (tag) {
     case JS_TAG_STRING:
       return JS_DupValue(ctx, val);
+    case JS_TAG_STRING_ROPE: {
+      JSString* p = js_string_rope_flatten(ctx, val);
+      if (!p)
+        return JS_EXCEPTION;
+      return JS_DupValue(ctx, JS_MKPTR(JS_TAG_STRING, p));
+    }
     case JS_TAG_INT:
       snprintf(buf, sizeof(buf), "%d", JS_VALUE_GET_INT(val));
       str = buf;
@@ -1610,10 +1622,7 @@ JSValue JS_ToStringCheckObject(JSContext* ctx, JSValueConst val) {
 JSValue JS_ToQuotedString(JSContext* ctx, JSValueConst val1) {
   JSValue val;
   JSString* p;
-  int i;
-  uint32_t c;
   StringBuffer b_s, *b = &b_s;
-  char buf[16];
 
   val = JS_ToStringCheckObject(ctx, val1);
   if (JS_IsException(val))
@@ -1622,48 +1631,7 @@ JSValue JS_ToQuotedString(JSContext* ctx, JSValueConst val1) {
 
   if (string_buffer_init(ctx, b, p->len + 2))
     goto fail;
-
-  if (string_buffer_putc8(b, '\"'))
-    goto fail;
-  for (i = 0; i < p->len;) {
-    c = string_getc(p, &i);
-    switch (c) {
-      case '\t':
-        c = 't';
-        goto quote;
-      case '\r':
-        c = 'r';
-        goto quote;
-      case '\n':
-        c = 'n';
-        goto quote;
-      case '\b':
-        c = 'b';
-        goto quote;
-      case '\f':
-        c = 'f';
-        goto quote;
-      case '\"':
-      case '\\':
-      quote:
-        if (string_buffer_putc8(b, '\\'))
-          goto fail;
-        if (string_buffer_putc8(b, c))
-          goto fail;
-        break;
-      default:
-        if (c < 32 || (c >= 0xd800 && c < 0xe000)) {
-          snprintf(buf, sizeof(buf), "\\u%04x", c);
-          if (string_buffer_puts8(b, buf))
-            goto fail;
-        } else {
-          if (string_buffer_putc(b, c))
-            goto fail;
-        }
-        break;
-    }
-  }
-  if (string_buffer_putc8(b, '\"'))
+  if (string_buffer_put_quoted(b, p))
     goto fail;
   JS_FreeValue(ctx, val);
   return string_buffer_end(b);
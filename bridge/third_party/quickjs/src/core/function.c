@@ -289,6 +289,11 @@ JSValue JS_CallInternal(JSContext* caller_ctx,
     return call_func(caller_ctx, func_obj, this_obj, argc, (JSValueConst*)argv, flags);
   }
   b = p->u.func.function_bytecode;
+  if (unlikely(b->is_lazy)) {
+    if (js_instantiate_lazy_function(b->realm, p))
+      return JS_EXCEPTION;
+    b = p->u.func.function_bytecode;
+  }
 
   if (unlikely(argc < b->arg_count || (flags & JS_CALL_FLAG_COPY_ARGV))) {
     arg_allocated_size = b->arg_count;
@@ -1588,6 +1593,85 @@ restart:
       }
       BREAK;
 
+#ifdef CONFIG_SUPERINSTRUCTIONS
+      CASE(OP_get_loc_get_field):
+      CASE(OP_get_arg_get_field): {
+        JSValue val;
+        JSAtom atom;
+        int idx;
+        atom = get_u32(pc);
+        idx = get_u16(pc + 4);
+        pc += 6;
+
+        /* the getter may overwrite the variable, keep the object alive */
+        *sp++ = JS_DupValue(ctx, opcode == OP_get_loc_get_field ? var_buf[idx] : arg_buf[idx]);
+        val = JS_GetPropertyInternal(ctx, sp[-1], atom, sp[-1], ic, FALSE);
+        if (unlikely(JS_IsException(val)))
+          goto exception;
+        if (ic != NULL && ic->updated == TRUE) {
+          ic->updated = FALSE;
+          put_u8(pc - 7, opcode == OP_get_loc_get_field ? OP_get_loc_get_field_ic : OP_get_arg_get_field_ic);
+          put_u32(pc - 6, ic->updated_offset);
+          // safe free call because ic struct will retain atom
+          JS_FreeAtom(ctx, atom);
+        }
+        JS_FreeValue(ctx, sp[-1]);
+        sp[-1] = val;
+      }
+      BREAK;
+
+      CASE(OP_get_loc_get_field_ic):
+      CASE(OP_get_arg_get_field_ic): {
+        JSValue val;
+        JSAtom atom;
+        int32_t ic_offset;
+        int idx;
+        ic_offset = get_u32(pc);
+        idx = get_u16(pc + 4);
+        atom = get_ic_atom(ic, ic_offset);
+        pc += 6;
+
+        *sp++ = JS_DupValue(ctx, opcode == OP_get_loc_get_field_ic ? var_buf[idx] : arg_buf[idx]);
+        val = JS_GetPropertyInternalWithIC(ctx, sp[-1], atom, sp[-1], ic, ic_offset, FALSE);
+        ic->updated = FALSE;
+        if (unlikely(JS_IsException(val)))
+          goto exception;
+        JS_FreeValue(ctx, sp[-1]);
+        sp[-1] = val;
+      }
+      BREAK;
+
+      CASE(OP_push_i32_add): {
+        JSValue op1;
+        int32_t v;
+        v = get_i32(pc);
+        pc += 4;
+
+        op1 = sp[-1];
+        if (likely(JS_VALUE_GET_TAG(op1) == JS_TAG_INT)) {
+          int64_t r;
+          r = (int64_t)JS_VALUE_GET_INT(op1) + v;
+          if (unlikely((int)r != r))
+            goto push_i32_add_slow;
+          sp[-1] = JS_NewInt32(ctx, r);
+        } else if (JS_TAG_IS_FLOAT64(JS_VALUE_GET_TAG(op1))) {
+          sp[-1] = __JS_NewFloat64(ctx, JS_VALUE_GET_FLOAT64(op1) + v);
+        } else {
+          JSValue ops[2];
+        push_i32_add_slow:
+          /* the stack has no room for the immediate operand. In case of
+             exception, js_add_slow frees ops[0] and ops[1] */
+          ops[0] = op1;
+          ops[1] = JS_NewInt32(ctx, v);
+          sp[-1] = JS_UNDEFINED;
+          if (js_add_slow(ctx, ops + 2))
+            goto exception;
+          sp[-1] = ops[0];
+        }
+      }
+      BREAK;
+#endif
+
       CASE(OP_debugger):
       BREAK;
 
@@ -1931,17 +2015,22 @@ restart:
             goto add_loc_slow;
           *pv = JS_NewInt32(ctx, r);
           sp--;
-        } else if (JS_VALUE_GET_TAG(*pv) == JS_TAG_STRING) {
+        } else if (tag_is_string(JS_VALUE_GET_TAG(*pv))) {
           JSValue op1;
           op1 = sp[-1];
           sp--;
           op1 = JS_ToPrimitiveFree(ctx, op1, HINT_NONE);
           if (JS_IsException(op1))
             goto exception;
-          op1 = JS_ConcatString(ctx, JS_DupValue(ctx, *pv), op1);
-          if (JS_IsException(op1))
-            goto exception;
-          set_value(ctx, pv, op1);
+          /* the variable is often the only reference to the string being built */
+          if (js_concat_string_in_place(ctx, *pv, op1)) {
+            JS_FreeValue(ctx, op1);
+          } else {
+            op1 = JS_ConcatString(ctx, JS_DupValue(ctx, *pv), op1);
+            if (JS_IsException(op1))
+              goto exception;
+            set_value(ctx, pv, op1);
+          }
         } else {
           JSValue ops[2];
         add_loc_slow:
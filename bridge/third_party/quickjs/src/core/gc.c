@@ -235,6 +235,10 @@ __maybe_unused void JS_DumpValueShort(JSRuntime* rt, JSValueConst val) {
       p = JS_VALUE_GET_STRING(val);
       JS_DumpString(rt, p);
     } break;
+    case JS_TAG_STRING_ROPE: {
+      JSStringRope* r = JS_VALUE_GET_PTR(val);
+      printf("[rope len=%u]", (unsigned)r->len);
+    } break;
     case JS_TAG_FUNCTION_BYTECODE: {
       JSFunctionBytecode* b = JS_VALUE_GET_PTR(val);
       char buf[ATOM_GET_STR_BUF_SIZE];
@@ -462,6 +466,9 @@ void __JS_FreeValueRT(JSRuntime* rt, JSValue v) {
 #endif
 
   switch (tag) {
+    case JS_TAG_STRING_ROPE:
+      js_free_string_rope(rt, JS_VALUE_GET_PTR(v));
+      break;
     case JS_TAG_STRING: {
       JSString* p = JS_VALUE_GET_STRING(v);
       if (p->atom_type) {
@@ -24,6 +24,7 @@
  */
 
 #include "ic.h"
+#include "string.h"
 
 static force_inline uint32_t get_index_hash(JSAtom atom, int hash_bits) {
   return (atom * 0x9e370001) >> (32 - hash_bits);
@@ -45,6 +46,9 @@ InlineCache *init_ic(JSContext *ctx) {
   ic->cache = NULL;
   ic->updated = FALSE;
   ic->updated_offset = 0;
+#ifdef CONFIG_IC_STATS
+  memset(&ic->stats, 0, sizeof(ic->stats));
+#endif
   return ic;
 fail:
   return NULL;
@@ -174,11 +178,22 @@ force_inline uint32_t add_ic_slot(InlineCache *ic, JSAtom atom, JSObject *object
 
     i = (i + 1) % IC_CACHE_ITEM_CAPACITY;
     if (unlikely(i == cr->index)) {
-      cr->index = (cr->index + 1) % IC_CACHE_ITEM_CAPACITY;
       break;
     }
   }
 
+  i = (cr->index + 1) % IC_CACHE_ITEM_CAPACITY;
+  if (cr->buffer[i].shape != NULL) {
+    /* the ring is full: stop evicting shapes which are still in use, the
+       site is megamorphic and own properties go to the stub cache. */
+    cr->megamorphic = TRUE;
+  }
+  if (cr->megamorphic) {
+    if (!prototype)
+      add_ic_stub_entry(rt, object->shape, atom, prop_offset);
+    goto end;
+  }
+  cr->index = i;
   ci = cr->buffer + cr->index;
   sh = ci->shape;
   if (ci->watchpoint_ref)
@@ -226,6 +241,98 @@ end:
   return 0;
 }
 
+void add_ic_stub_entry(JSRuntime *rt, JSShape *shape, JSAtom atom, uint32_t prop_offset) {
+  InlineCacheStubEntry *e;
+  if (unlikely(!rt->ic_stub_cache)) {
+    rt->ic_stub_cache = js_mallocz_rt(rt, sizeof(InlineCacheStubEntry) * IC_STUB_CACHE_SIZE);
+    if (unlikely(!rt->ic_stub_cache))
+      return;
+  }
+  e = rt->ic_stub_cache + get_ic_stub_cache_index(shape, atom);
+  e->shape = shape;
+  e->atom = atom;
+  e->prop_offset = prop_offset;
+  shape->in_ic_stub_cache = TRUE;
+}
+
+/* called before a hashed shape is modified or freed. Entries only cache
+   own properties, so the shape's own atoms locate all of them. */
+void ic_stub_cache_remove_shape(JSRuntime *rt, JSShape *shape) {
+  uint32_t i;
+  JSShapeProperty *pr;
+  InlineCacheStubEntry *e;
+  shape->in_ic_stub_cache = FALSE;
+  if (!rt->ic_stub_cache)
+    return;
+  pr = get_shape_prop(shape);
+  for (i = 0; i < shape->prop_count; i++, pr++) {
+    e = rt->ic_stub_cache + get_ic_stub_cache_index(shape, pr->atom);
+    if (e->shape == shape)
+      e->shape = NULL;
+  }
+}
+
+void free_ic_stub_cache(JSRuntime *rt) {
+  js_free_rt(rt, rt->ic_stub_cache);
+  rt->ic_stub_cache = NULL;
+}
+
+int JS_GetFunctionInlineCacheStats(JSContext *ctx, JSValueConst func, JSInlineCacheStats *s) {
+#ifdef CONFIG_IC_STATS
+  JSObject *p;
+  JSFunctionBytecode *b;
+  if (JS_VALUE_GET_TAG(func) != JS_TAG_OBJECT)
+    return -1;
+  p = JS_VALUE_GET_OBJ(func);
+  if (p->class_id != JS_CLASS_BYTECODE_FUNCTION)
+    return -1;
+  b = p->u.func.function_bytecode;
+  memset(s, 0, sizeof(*s));
+  if (b->ic) {
+    s->hit_count = b->ic->stats.hit_count;
+    s->miss_count = b->ic->stats.miss_count;
+    s->megamorphic_count = b->ic->stats.megamorphic_count;
+  }
+  return 0;
+#else
+  return -1;
+#endif
+}
+
+void JS_DumpInlineCacheStats(JSRuntime *rt, FILE *fp) {
+#ifdef CONFIG_IC_STATS
+  struct list_head *el;
+  JSGCObjectHeader *gp;
+  JSFunctionBytecode *b;
+  InlineCacheStats *st;
+  char name[ATOM_GET_STR_BUF_SIZE], filename[ATOM_GET_STR_BUF_SIZE];
+  int64_t total;
+
+  fprintf(fp, "%10s %10s %10s %6s  %s\n", "HITS", "MISSES", "MEGA", "HIT%", "FUNCTION");
+  list_for_each(el, &rt->gc_obj_list) {
+    gp = list_entry(el, JSGCObjectHeader, link);
+    if (gp->gc_obj_type != JS_GC_OBJ_TYPE_FUNCTION_BYTECODE)
+      continue;
+    b = (JSFunctionBytecode *)gp;
+    if (!b->ic)
+      continue;
+    st = &b->ic->stats;
+    total = st->hit_count + st->miss_count;
+    if (total == 0)
+      continue;
+    fprintf(fp, "%10" PRId64 " %10" PRId64 " %10" PRId64 " %5.1f%%  %s", st->hit_count, st->miss_count,
+            st->megamorphic_count, st->hit_count * 100.0 / total,
+            JS_AtomGetStrRT(rt, name, sizeof(name), b->func_name));
+    if (b->has_debug)
+      fprintf(fp, " (%s:%d)", JS_AtomGetStrRT(rt, filename, sizeof(filename), b->debug.filename),
+              b->debug.line_num);
+    fprintf(fp, "\n");
+  }
+#else
+  fprintf(fp, "inline cache statistics are disabled, rebuild with CONFIG_IC_STATS\n");
+#endif
+}
+
 int ic_watchpoint_delete_handler(JSRuntime* rt, intptr_t ref, JSAtom atom, void* target) {
   InlineCacheRingItem *ci;
   ci = (InlineCacheRingItem *)ref;
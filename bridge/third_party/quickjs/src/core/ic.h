@@ -68,6 +68,36 @@ force_inline JSAtom get_ic_atom(InlineCache *ic, uint32_t cache_offset) {
   return ic->cache[cache_offset].atom;
 }
 
+force_inline BOOL is_ic_megamorphic(InlineCache *ic, uint32_t cache_offset) {
+  return ic->cache[cache_offset].megamorphic;
+}
+
+force_inline uint32_t get_ic_stub_cache_index(JSShape *shape, JSAtom atom) {
+  uint32_t h = (uint32_t)((uintptr_t)shape >> 4) ^ atom;
+  return (h * 0x9e370001) >> (32 - IC_STUB_CACHE_BITS);
+}
+
+/* own data property offset of 'atom' in 'shape' or -1 if not cached */
+force_inline int32_t get_ic_stub_prop_offset(JSRuntime *rt, JSShape *shape, JSAtom atom) {
+  InlineCacheStubEntry *e;
+  if (unlikely(!rt->ic_stub_cache))
+    return -1;
+  e = rt->ic_stub_cache + get_ic_stub_cache_index(shape, atom);
+  if (likely(e->shape == shape && e->atom == atom))
+    return e->prop_offset;
+  return -1;
+}
+
+void add_ic_stub_entry(JSRuntime *rt, JSShape *shape, JSAtom atom, uint32_t prop_offset);
+void ic_stub_cache_remove_shape(JSRuntime *rt, JSShape *shape);
+void free_ic_stub_cache(JSRuntime *rt);
+
+#ifdef CONFIG_IC_STATS
+#define IC_STATS_INC(ic, field) ((ic)->stats.field++)
+#else
+#define IC_STATS_INC(ic, field) ((void)0)
+#endif
+
 int ic_watchpoint_delete_handler(JSRuntime* rt, intptr_t ref, JSAtom atom, void* target);
 int ic_watchpoint_free_handler(JSRuntime* rt, intptr_t ref, JSAtom atom);
 int ic_delete_shape_proto_watchpoints(JSRuntime *rt, JSShape *shape, JSAtom atom);
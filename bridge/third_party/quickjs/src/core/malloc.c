@@ -27,12 +27,15 @@
 #include "malloc.h"
 #include "exception.h"
 
-void js_trigger_gc(JSRuntime* rt, size_t size) {
+void js_trigger_gc(JSRuntime* rt, JSMemoryAccount* acc, size_t size) {
   BOOL force_gc;
 #ifdef FORCE_GC_AT_MALLOC
   force_gc = TRUE;
 #else
   force_gc = ((rt->malloc_state.malloc_size + size) > rt->malloc_gc_threshold);
+  /* a context over its soft limit collects before the whole runtime has to */
+  if (acc && acc->soft_limit != 0 && (acc->malloc_size + size) > acc->gc_threshold)
+    force_gc = TRUE;
 #endif
   if (force_gc) {
 #ifdef DUMP_GC
@@ -40,10 +43,16 @@ void js_trigger_gc(JSRuntime* rt, size_t size) {
 #endif
     JS_RunGC(rt);
     rt->malloc_gc_threshold = rt->malloc_state.malloc_size + (rt->malloc_state.malloc_size >> 1);
+    /* the account belongs to the live context that is allocating */
+    if (acc && acc->soft_limit != 0) {
+      if (acc->malloc_size > acc->soft_limit)
+        acc->gc_threshold = acc->malloc_size + (acc->malloc_size >> 1);
+      else
+        acc->gc_threshold = acc->soft_limit;
+    }
   }
 }
 
-
 /* default memory allocation functions with memory limitation */
 static inline size_t js_def_malloc_usable_size(void* ptr) {
 #if ENABLE_MI_MALLOC
@@ -68,20 +77,131 @@ size_t js_malloc_usable_size_unknown(const void* ptr) {
   return 0;
 }
 
+/* Memory accounting: each block is prefixed with the JSMemoryAccount it is
+   charged to. The account is chosen at allocation time and stays attached to
+   the block until it is freed, even if it is freed by another context. */
+static inline size_t js_account_block_size(JSRuntime* rt, const void* base) {
+  return rt->mf.js_malloc_usable_size(base) + MALLOC_OVERHEAD;
+}
+
+/* the hard limit is lifted while the out of memory error itself is built */
+static inline BOOL js_account_can_grow(JSRuntime* rt, JSMemoryAccount* acc, size_t size) {
+  return acc->hard_limit == 0 || acc->malloc_size + size <= acc->hard_limit || rt->in_out_of_memory;
+}
+
+static void js_account_release(JSRuntime* rt, JSMemoryAccount* acc) {
+  if (acc->ctx == NULL && acc->malloc_count == 0)
+    rt->mf.js_free(&rt->malloc_state, acc);
+}
+
+JSMemoryAccount* js_new_memory_account(JSRuntime* rt) {
+  JSMemoryAccount* acc;
+
+  acc = rt->mf.js_malloc(&rt->malloc_state, sizeof(JSMemoryAccount));
+  if (!acc)
+    return NULL;
+  memset(acc, 0, sizeof(*acc));
+  return acc;
+}
+
+/* called when the owning context goes away: the account lives on until
+   the last block charged to it is freed */
+void js_detach_memory_account(JSRuntime* rt, JSMemoryAccount* acc) {
+  acc->ctx = NULL;
+  if (rt->current_account == acc)
+    rt->current_account = NULL;
+  js_account_release(rt, acc);
+}
+
+static void* js_account_malloc(JSRuntime* rt, size_t size) {
+  JSMemoryAccount* acc = rt->current_account;
+  uint8_t* base;
+
+  if (acc && unlikely(!js_account_can_grow(rt, acc, size)))
+    return NULL;
+  base = rt->mf.js_malloc(&rt->malloc_state, size + JS_MEMORY_ACCOUNT_HEADER_SIZE);
+  if (!base)
+    return NULL;
+  *(JSMemoryAccount**)base = acc;
+  if (acc) {
+    acc->malloc_count++;
+    acc->malloc_size += js_account_block_size(rt, base);
+  }
+  return base + JS_MEMORY_ACCOUNT_HEADER_SIZE;
+}
+
+static void js_account_free(JSRuntime* rt, void* ptr) {
+  uint8_t* base;
+  JSMemoryAccount* acc;
+
+  if (!ptr)
+    return;
+  base = (uint8_t*)ptr - JS_MEMORY_ACCOUNT_HEADER_SIZE;
+  acc = *(JSMemoryAccount**)base;
+  if (acc) {
+    acc->malloc_count--;
+    acc->malloc_size -= js_account_block_size(rt, base);
+  }
+  rt->mf.js_free(&rt->malloc_state, base);
+  if (acc)
+    js_account_release(rt, acc);
+}
+
+static void* js_account_realloc(JSRuntime* rt, void* ptr, size_t size) {
+  uint8_t* base;
+  JSMemoryAccount* acc;
+  size_t old_size;
+
+  if (!ptr) {
+    if (size == 0)
+      return NULL;
+    return js_account_malloc(rt, size);
+  }
+  if (size == 0) {
+    js_account_free(rt, ptr);
+    return NULL;
+  }
+  base = (uint8_t*)ptr - JS_MEMORY_ACCOUNT_HEADER_SIZE;
+  acc = *(JSMemoryAccount**)base;
+  old_size = acc ? js_account_block_size(rt, base) : 0;
+  if (acc && size + JS_MEMORY_ACCOUNT_HEADER_SIZE > old_size &&
+      unlikely(!js_account_can_grow(rt, acc, size + JS_MEMORY_ACCOUNT_HEADER_SIZE - old_size)))
+    return NULL;
+  base = rt->mf.js_realloc(&rt->malloc_state, base, size + JS_MEMORY_ACCOUNT_HEADER_SIZE);
+  if (!base)
+    return NULL;
+  if (acc)
+    acc->malloc_size += js_account_block_size(rt, base) - old_size;
+  return base + JS_MEMORY_ACCOUNT_HEADER_SIZE;
+}
+
 void* js_malloc_rt(JSRuntime* rt, size_t size) {
+  if (unlikely(rt->memory_accounting))
+    return js_account_malloc(rt, size);
   return rt->mf.js_malloc(&rt->malloc_state, size);
 }
 
 void js_free_rt(JSRuntime* rt, void* ptr) {
+  if (unlikely(rt->memory_accounting)) {
+    js_account_free(rt, ptr);
+    return;
+  }
   rt->mf.js_free(&rt->malloc_state, ptr);
 }
 
 void* js_realloc_rt(JSRuntime* rt, void* ptr, size_t size) {
+  if (unlikely(rt->memory_accounting))
+    return js_account_realloc(rt, ptr, size);
   return rt->mf.js_realloc(&rt->malloc_state, ptr, size);
 }
 
 size_t js_malloc_usable_size_rt(JSRuntime* rt, const void* ptr) {
-  return rt->mf.js_malloc_usable_size(ptr);
+  size_t size;
+
+  if (likely(!rt->memory_accounting))
+    return rt->mf.js_malloc_usable_size(ptr);
+  size = rt->mf.js_malloc_usable_size((const uint8_t*)ptr - JS_MEMORY_ACCOUNT_HEADER_SIZE);
+  return size > JS_MEMORY_ACCOUNT_HEADER_SIZE ? size - JS_MEMORY_ACCOUNT_HEADER_SIZE : 0;
 }
 
 void* js_mallocz_rt(JSRuntime* rt, size_t size) {
@@ -103,7 +223,9 @@ void* js_bf_realloc(void* opaque, void* ptr, size_t size) {
 /* Throw out of memory in case of error */
 void* js_malloc(JSContext* ctx, size_t size) {
   void* ptr;
+  JSMemoryAccount* prev = js_enter_memory_account(ctx);
   ptr = js_malloc_rt(ctx->rt, size);
+  js_leave_memory_account(ctx->rt, prev);
   if (unlikely(!ptr)) {
     JS_ThrowOutOfMemory(ctx);
     return NULL;
@@ -114,7 +236,9 @@ void* js_malloc(JSContext* ctx, size_t size) {
 /* Throw out of memory in case of error */
 void* js_mallocz(JSContext* ctx, size_t size) {
   void* ptr;
+  JSMemoryAccount* prev = js_enter_memory_account(ctx);
   ptr = js_mallocz_rt(ctx->rt, size);
+  js_leave_memory_account(ctx->rt, prev);
   if (unlikely(!ptr)) {
     JS_ThrowOutOfMemory(ctx);
     return NULL;
@@ -129,7 +253,9 @@ void js_free(JSContext* ctx, void* ptr) {
 /* Throw out of memory in case of error */
 void* js_realloc(JSContext* ctx, void* ptr, size_t size) {
   void* ret;
+  JSMemoryAccount* prev = js_enter_memory_account(ctx);
   ret = js_realloc_rt(ctx->rt, ptr, size);
+  js_leave_memory_account(ctx->rt, prev);
   if (unlikely(!ret && size != 0)) {
     JS_ThrowOutOfMemory(ctx);
     return NULL;
@@ -140,7 +266,9 @@ void* js_realloc(JSContext* ctx, void* ptr, size_t size) {
 /* store extra allocated size in *pslack if successful */
 void* js_realloc2(JSContext* ctx, void* ptr, size_t size, size_t* pslack) {
   void* ret;
+  JSMemoryAccount* prev = js_enter_memory_account(ctx);
   ret = js_realloc_rt(ctx->rt, ptr, size);
+  js_leave_memory_account(ctx->rt, prev);
   if (unlikely(!ret && size != 0)) {
     JS_ThrowOutOfMemory(ctx);
     return NULL;
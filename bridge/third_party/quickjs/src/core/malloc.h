@@ -33,7 +33,7 @@
 #include "mimalloc.h"
 #endif
 
-void js_trigger_gc(JSRuntime* rt, size_t size);
+void js_trigger_gc(JSRuntime* rt, JSMemoryAccount* acc, size_t size);
 no_inline int js_realloc_array(JSContext* ctx, void** parray, int elem_size, int* psize, int req_size);
 
 /* resize the array and update its size if req_size > *psize */
@@ -54,6 +54,23 @@ void js_def_free(JSMallocState* s, void* ptr);
 void* js_def_realloc(JSMallocState* s, void* ptr, size_t size);
 size_t js_malloc_usable_size_unknown(const void* ptr);
 
+JSMemoryAccount* js_new_memory_account(JSRuntime* rt);
+
+/* charge the allocations made until js_leave_memory_account() to the
+   context; the previous account is returned so that runtime allocations
+   made afterwards are not charged to the last context entered */
+static inline JSMemoryAccount* js_enter_memory_account(JSContext* ctx) {
+  JSMemoryAccount* prev = ctx->rt->current_account;
+  ctx->rt->current_account = ctx->mem_account;
+  return prev;
+}
+
+static inline void js_leave_memory_account(JSRuntime* rt, JSMemoryAccount* prev) {
+  rt->current_account = prev;
+}
+
+void js_detach_memory_account(JSRuntime* rt, JSMemoryAccount* acc);
+
 
 #if CONFIG_BIGNUM
 void* js_bf_realloc(void* opaque, void* ptr, size_t size);
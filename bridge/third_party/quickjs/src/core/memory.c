@@ -106,6 +106,23 @@ static void compute_value_size(JSValueConst val, JSMemoryUsage_helper *hp)
     case JS_TAG_STRING:
       compute_jsstring_size(JS_VALUE_GET_STRING(val), hp);
       break;
+    case JS_TAG_STRING_ROPE: {
+      JSStringRope *r = JS_VALUE_GET_PTR(val);
+      /* iterate on the left spine, it can be very long */
+      for(;;) {
+        hp->str_size += sizeof(*r) / (double)r->header.ref_count;
+        if (r->flat) {
+          compute_jsstring_size(r->flat, hp);
+          break;
+        }
+        compute_value_size(r->right, hp);
+        if (JS_VALUE_GET_TAG(r->left) != JS_TAG_STRING_ROPE) {
+          compute_value_size(r->left, hp);
+          break;
+        }
+        r = JS_VALUE_GET_PTR(r->left);
+      }
+    } break;
 #ifdef CONFIG_BIGNUM
     case JS_TAG_BIG_INT:
     case JS_TAG_BIG_FLOAT:
@@ -410,6 +427,31 @@ void JS_ComputeMemoryUsage(JSRuntime *rt, JSMemoryUsage *s)
                          s->js_func_pc2column_size;
 }
 
+void JS_GetContextMemoryUsage(JSContext *ctx, JSContextMemoryUsage *s)
+{
+  JSMemoryAccount *acc = ctx->mem_account;
+
+  memset(s, 0, sizeof(*s));
+  if (!acc)
+    return;
+  s->malloc_size = acc->malloc_size;
+  s->malloc_count = acc->malloc_count;
+  s->soft_limit = acc->soft_limit;
+  s->hard_limit = acc->hard_limit;
+  s->soft_limit_exceeded = acc->soft_limit != 0 && acc->malloc_size > acc->soft_limit;
+}
+
+void JS_SetContextMemoryLimit(JSContext *ctx, size_t soft_limit, size_t hard_limit)
+{
+  JSMemoryAccount *acc = ctx->mem_account;
+
+  if (!acc)
+    return;
+  acc->soft_limit = soft_limit;
+  acc->hard_limit = hard_limit;
+  acc->gc_threshold = soft_limit;
+}
+
 void JS_DumpMemoryUsage(FILE *fp, const JSMemoryUsage *s, JSRuntime *rt)
 {
   fprintf(fp, "QuickJS memory usage -- "
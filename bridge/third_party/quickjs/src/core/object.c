@@ -422,6 +422,17 @@ JSValue JS_GetPropertyInternal(JSContext *ctx, JSValueConst obj,
         }
       }
       break;
+      case JS_TAG_STRING_ROPE:
+        if (prop == JS_ATOM_length)
+          return JS_NewInt32(ctx, js_string_value_len(obj));
+        if (__JS_AtomIsTaggedInt(prop)) {
+          /* indexed access flattens the rope */
+          JSString *p1 = js_string_rope_flatten(ctx, obj);
+          if (!p1)
+            return JS_EXCEPTION;
+          return JS_GetPropertyInternal(ctx, JS_MKPTR(JS_TAG_STRING, p1), prop, this_obj, ic, throw_ref_error);
+        }
+        break;
       default:
         break;
     }
@@ -552,18 +563,28 @@ force_inline JSValue JS_GetPropertyInternalWithIC(JSContext *ctx, JSValueConst o
 #endif
 {
   uint32_t tag;
+  int32_t prop_offset;
   JSObject *p, *proto;
   tag = JS_VALUE_GET_TAG(obj);
   if (unlikely(tag != JS_TAG_OBJECT))
     goto slow_path;
   p = JS_VALUE_GET_OBJ(obj);
-  offset = get_ic_prop_offset(ic, offset, p->shape, &proto);
-  if (likely(offset >= 0)) {
+  prop_offset = get_ic_prop_offset(ic, offset, p->shape, &proto);
+  if (likely(prop_offset >= 0)) {
+    IC_STATS_INC(ic, hit_count);
     if (proto)
       p = proto;
-    return JS_DupValue(ctx, p->prop[offset].u.value);
+    return JS_DupValue(ctx, p->prop[prop_offset].u.value);
+  }
+  if (is_ic_megamorphic(ic, offset)) {
+    prop_offset = get_ic_stub_prop_offset(ctx->rt, p->shape, prop);
+    if (prop_offset >= 0) {
+      IC_STATS_INC(ic, megamorphic_count);
+      return JS_DupValue(ctx, p->prop[prop_offset].u.value);
+    }
   }
 slow_path:
+  IC_STATS_INC(ic, miss_count);
   return JS_GetPropertyInternal(ctx, obj, prop, this_obj, ic, throw_ref_error);
 }
 
@@ -1993,19 +2014,32 @@ int JS_SetPropertyInternalWithIC(JSContext* ctx, JSValueConst this_obj, JSAtom p
 force_inline int JS_SetPropertyInternalWithIC(JSContext* ctx, JSValueConst this_obj, JSAtom prop, JSValue val, int flags, InlineCache *ic, int32_t offset) {
 #endif
   uint32_t tag;
+  int32_t prop_offset;
   JSObject *p, *proto;
   tag = JS_VALUE_GET_TAG(this_obj);
   if (unlikely(tag != JS_TAG_OBJECT))
     goto slow_path;
   p = JS_VALUE_GET_OBJ(this_obj);
-  offset = get_ic_prop_offset(ic, offset, p->shape, &proto);
-  if (likely(offset >= 0)) {
+  prop_offset = get_ic_prop_offset(ic, offset, p->shape, &proto);
+  if (likely(prop_offset >= 0)) {
     if (proto)
       goto slow_path;
-    set_value(ctx, &p->prop[offset].u.value, val);
+    IC_STATS_INC(ic, hit_count);
+    set_value(ctx, &p->prop[prop_offset].u.value, val);
     return TRUE;
   }
+  if (is_ic_megamorphic(ic, offset)) {
+    prop_offset = get_ic_stub_prop_offset(ctx->rt, p->shape, prop);
+    /* the entry may come from a read of a read-only property */
+    if (prop_offset >= 0 &&
+        (get_shape_prop(p->shape)[prop_offset].flags & (JS_PROP_TMASK | JS_PROP_WRITABLE | JS_PROP_LENGTH)) == JS_PROP_WRITABLE) {
+      IC_STATS_INC(ic, megamorphic_count);
+      set_value(ctx, &p->prop[prop_offset].u.value, val);
+      return TRUE;
+    }
+  }
 slow_path:
+  IC_STATS_INC(ic, miss_count);
   return JS_SetPropertyInternal(ctx, this_obj, prop, val, flags, ic);
 }
 
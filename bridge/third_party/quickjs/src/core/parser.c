@@ -35,6 +35,7 @@
 #include "object.h"
 #include "quickjs/libregexp.h"
 #include "runtime.h"
+#include "simd.h"
 #include "string.h"
 
 static __exception int next_token(JSParseState *s);
@@ -262,6 +263,16 @@ static __exception int js_parse_string(JSParseState *s, int sep,
   if (string_buffer_init(s->ctx, b, 32))
     goto fail;
   for(;;) {
+    if (sep == '\"') {
+      /* copy the plain ASCII run up to the next quote, escape or
+         special character at once */
+      const uint8_t *p_end = js_simd_json_string_end(p, s->buf_end);
+      if (p_end != p) {
+        if (string_buffer_write8(b, p, p_end - p))
+          goto fail;
+        p = p_end;
+      }
+    }
     if (p >= s->buf_end)
       goto invalid_char;
     c = *p;
@@ -1185,7 +1196,8 @@ redo:
       /* fall through */
     case ' ':
     case '\t':
-      p++;
+      /* indentation runs of pretty printed JSON */
+      p = js_simd_skip_blanks(p + 1, s->buf_end);
       goto redo;
     case '/':
       if (!s->ext_json) {
@@ -2542,6 +2554,244 @@ done:
   return tok;
 }
 
+/* function bodies smaller than this are always compiled eagerly */
+#define JS_LAZY_FUNCTION_MIN_SIZE 128
+
+/* set of the identifiers found in a skipped function body */
+typedef struct JSLazyRefs {
+  JSAtom *tab; /* open addressing, JS_ATOM_NULL for empty slots */
+  int size; /* power of two */
+  int count;
+} JSLazyRefs;
+
+static int lazy_refs_add(JSContext *ctx, JSLazyRefs *r, JSAtom atom)
+{
+  uint32_t h, mask;
+  int i;
+
+  if (2 * (r->count + 1) > r->size) {
+    JSAtom *tab;
+    int new_size = max_int(r->size * 2, 32);
+
+    tab = js_mallocz(ctx, sizeof(tab[0]) * new_size);
+    if (!tab)
+      return -1;
+    mask = new_size - 1;
+    for (i = 0; i < r->size; i++) {
+      if (r->tab[i] != JS_ATOM_NULL) {
+        h = (r->tab[i] * 0x9e3779b1) & mask;
+        while (tab[h] != JS_ATOM_NULL)
+          h = (h + 1) & mask;
+        tab[h] = r->tab[i];
+      }
+    }
+    js_free(ctx, r->tab);
+    r->tab = tab;
+    r->size = new_size;
+  }
+  mask = r->size - 1;
+  h = (atom * 0x9e3779b1) & mask;
+  while (r->tab[h] != JS_ATOM_NULL) {
+    if (r->tab[h] == atom)
+      return 0;
+    h = (h + 1) & mask;
+  }
+  r->tab[h] = JS_DupAtom(ctx, atom);
+  r->count++;
+  return 0;
+}
+
+static void lazy_refs_free(JSContext *ctx, JSLazyRefs *r)
+{
+  int i;
+
+  for (i = 0; i < r->size; i++) {
+    if (r->tab[i] != JS_ATOM_NULL)
+      JS_FreeAtom(ctx, r->tab[i]);
+  }
+  js_free(ctx, r->tab);
+}
+
+/* Skip a function body with the lexer only. The current token is the
+   first token after '{'. Return TRUE with the closing '}' as current
+   token and the identifiers which may reference an enclosing variable
+   in 'refs'. Return FALSE if the body needs the full parser to be
+   resolved (direct eval, super, import, private names) or could not
+   be delimited, an exception may then be pending. */
+static BOOL js_parse_skip_function_body(JSParseState *s, JSLazyRefs *refs)
+{
+  char state[256];
+  size_t level = 0;
+  int last_tok, c, tok_len;
+
+  state[level++] = '{';
+  last_tok = '{';
+  for (;;) {
+    switch(s->token.val) {
+      case '(':
+      case '[':
+      case '{':
+        if (level >= sizeof(state))
+          return FALSE;
+        state[level++] = s->token.val;
+        break;
+      case ')':
+        if (state[--level] != '(')
+          return FALSE;
+        break;
+      case ']':
+        if (state[--level] != '[')
+          return FALSE;
+        break;
+      case '}':
+        if (level == 1)
+          return TRUE;
+        c = state[--level];
+        if (c == '`') {
+          /* continue the parsing of the template */
+          free_token(s, &s->token);
+          s->got_lf = FALSE;
+          s->last_line_num = s->token.line_num;
+          if (js_parse_template_part(s, s->buf_ptr))
+            return FALSE;
+          goto handle_template;
+        } else if (c != '{') {
+          return FALSE;
+        }
+        break;
+      case TOK_TEMPLATE:
+      handle_template:
+        if (s->token.u.str.sep != '`') {
+          if (level >= sizeof(state))
+            return FALSE;
+          state[level++] = '`';
+        }
+        break;
+      case TOK_IDENT:
+        if (s->token.u.ident.atom == JS_ATOM_eval)
+          return FALSE;
+        /* property names are not references */
+        if (last_tok != '.' && last_tok != TOK_QUESTION_MARK_DOT &&
+            s->token.u.ident.atom != JS_ATOM_arguments) {
+          if (lazy_refs_add(s->ctx, refs, s->token.u.ident.atom))
+            return FALSE;
+        }
+        break;
+      case TOK_DIV_ASSIGN:
+        tok_len = 2;
+        goto parse_regexp;
+      case '/':
+        tok_len = 1;
+      parse_regexp:
+        if (is_regexp_allowed(last_tok)) {
+          s->buf_ptr -= tok_len;
+          if (js_parse_regexp(s))
+            return FALSE;
+        }
+        break;
+      case TOK_EOF:
+      case TOK_SUPER:
+      case TOK_IMPORT:
+      case TOK_PRIVATE_NAME:
+        return FALSE;
+    }
+    if (s->token.val == TOK_IDENT &&
+        (token_is_pseudo_keyword(s, JS_ATOM_of) ||
+         token_is_pseudo_keyword(s, JS_ATOM_yield))) {
+      last_tok = TOK_OF;
+    } else {
+      last_tok = s->token.val;
+    }
+    if (next_token(s))
+      return FALSE;
+  }
+}
+
+/* return TRUE if the function starting at 'ptr' is likely to be
+   called immediately, in which case deferring its compilation only
+   adds work */
+static BOOL js_parse_is_pife(JSParseState *s, const uint8_t *ptr)
+{
+  while (ptr > s->buf_start) {
+    int c = ptr[-1];
+    if (c != ' ' && c != '\t' && c != '\n' && c != '\r')
+      return (c == '(' || c == '!');
+    ptr--;
+  }
+  return FALSE;
+}
+
+/* The closure variables of a lazy function are looked up again by name
+   when it is compiled, which loses the scope order needed by 'with' and
+   by the variable object of a non strict direct eval. Return TRUE if a
+   lazy function is nested in such a scope, the code must then be
+   compiled without lazy functions. */
+static BOOL js_has_lazy_function_in_dynamic_scope(JSFunctionDef *fd,
+                                                  BOOL in_dynamic_scope)
+{
+  struct list_head *el;
+  int i;
+
+  if (fd->is_lazy && in_dynamic_scope)
+    return TRUE;
+  if (fd->has_eval_call && !fd->is_eval && !(fd->js_mode & JS_MODE_STRICT))
+    in_dynamic_scope = TRUE;
+  for(i = 0; i < fd->var_count && !in_dynamic_scope; i++) {
+    if (fd->vars[i].var_name == JS_ATOM__with_)
+      in_dynamic_scope = TRUE;
+  }
+  list_for_each(el, &fd->child_list) {
+    JSFunctionDef *fd1 = list_entry(el, JSFunctionDef, link);
+    if (js_has_lazy_function_in_dynamic_scope(fd1, in_dynamic_scope))
+      return TRUE;
+  }
+  return FALSE;
+}
+
+/* Try to defer the compilation of the body of 'fd'. The current token
+   is the first token after '{'. If the body can be skipped, a reference
+   to every identifier of the body is emitted so that the closure
+   variables of the lazy function are those the full body would use,
+   and the current token is the closing '}'. Otherwise the parser is
+   left at the start of the body. */
+static __exception int js_parse_lazy_function(JSParseState *s, JSFunctionDef *fd,
+                                             const uint8_t *ptr)
+{
+  JSContext *ctx = s->ctx;
+  JSLazyRefs refs = { NULL, 0, 0 };
+  JSParsePos pos;
+  int i;
+
+  /* the function being compiled by js_compile_lazy_function() */
+  if (fd->parent->is_eval && fd->parent->eval_type == JS_EVAL_TYPE_DIRECT)
+    return 0;
+  if (js_parse_is_pife(s, ptr))
+    return 0;
+  js_parse_get_pos(s, &pos);
+  if (!js_parse_skip_function_body(s, &refs) ||
+      s->buf_ptr - pos.ptr < JS_LAZY_FUNCTION_MIN_SIZE) {
+    lazy_refs_free(ctx, &refs);
+    /* the regular parser reports the errors if any */
+    JS_FreeValue(ctx, JS_GetException(ctx));
+    return js_parse_seek_token(s, &pos);
+  }
+  for (i = 0; i < refs.size; i++) {
+    if (refs.tab[i] != JS_ATOM_NULL) {
+      emit_op(s, OP_scope_get_var);
+      emit_atom(s, refs.tab[i]);
+      emit_u16(s, fd->scope_level);
+      emit_op(s, OP_drop);
+    }
+  }
+  lazy_refs_free(ctx, &refs);
+  /* cpool[0] receives the compiled function */
+  assert(fd->cpool_count == 0);
+  if (cpool_add(s, JS_NULL) < 0)
+    return -1;
+  fd->is_lazy = TRUE;
+  return 0;
+}
+
 static void set_object_name(JSParseState *s, JSAtom name)
 {
   JSFunctionDef *fd = s->cur_func;
@@ -4811,6 +5061,7 @@ static __exception int js_parse_postfix_expr(JSParseState *s, int parse_flags)
             emit_op(s, OP_apply_eval);
             emit_u16(s, fd->scope_level);
             fd->has_eval_call = TRUE;
+            s->has_dynamic_scope = TRUE;
             break;
           default:
             if (call_type == FUNC_CALL_SUPER_CTOR) {
@@ -4855,6 +5106,7 @@ static __exception int js_parse_postfix_expr(JSParseState *s, int parse_flags)
             emit_u16(s, arg_count);
             emit_u16(s, fd->scope_level);
             fd->has_eval_call = TRUE;
+            s->has_dynamic_scope = TRUE;
             break;
           default:
             if (call_type == FUNC_CALL_SUPER_CTOR) {
@@ -6916,6 +7168,7 @@ static __exception int js_parse_statement_or_decl(JSParseState *s, int decl_mask
       } else {
         int with_idx;
 
+        s->has_dynamic_scope = TRUE;
         if (next_token(s))
           goto fail;
 
@@ -10065,6 +10318,19 @@ static void push_short_int(DynBuf *bc_out, int val)
   dbuf_put_u32(bc_out, val);
 }
 
+#ifdef CONFIG_SUPERINSTRUCTIONS
+/* property accesses are preceded by their column number: skip it so that
+   the access can be fused with the opcode pushing the object */
+static int skip_column_num(const uint8_t *bc_buf, int bc_len, int pos, int *pcolumn_num)
+{
+  if (pos < bc_len && bc_buf[pos] == OP_column_num) {
+    *pcolumn_num = get_u32(bc_buf + pos + 1);
+    pos += opcode_info[OP_column_num].size;
+  }
+  return pos;
+}
+#endif
+
 static void put_short_code(DynBuf *bc_out, int op, int idx)
 {
 #if SHORT_OPCODES
@@ -10555,6 +10821,17 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
             pos_next = cc.pos;
             break;
           }
+#ifdef CONFIG_SUPERINSTRUCTIONS
+          /* transform i32(val) add -> push_i32_add(val) */
+          if (code_match(&cc, pos_next, OP_add, -1)) {
+            if (cc.line_num >= 0) line_num = cc.line_num;
+            add_pc2line_info(s, bc_out.size, line_num);
+            dbuf_putc(&bc_out, OP_push_i32_add);
+            dbuf_put_u32(&bc_out, val);
+            pos_next = cc.pos;
+            break;
+          }
+#endif
           /* Optimize constant tests: `if (0)`, `if (1)`, `if (!0)`... */
           if (code_match(&cc, pos_next, M2(OP_if_false, OP_if_true), -1)) {
             val = (val != 0);
@@ -10781,6 +11058,21 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
             pos_next = cc.pos;
             break;
           }
+#ifdef CONFIG_SUPERINSTRUCTIONS
+          /* transformation: get_loc(n) get_field(a) -> get_loc_get_field(a, n) */
+          column_num = -1;
+          if (code_match(&cc, skip_column_num(bc_buf, bc_len, pos_next, &column_num), OP_get_field, -1) &&
+              cc.atom != JS_ATOM_length) {
+            if (cc.line_num >= 0) line_num = cc.line_num;
+            add_pc2line_info(s, bc_out.size, line_num);
+            if (column_num >= 0) add_pc2col_info(s, bc_out.size, column_num);
+            dbuf_putc(&bc_out, OP_get_loc_get_field);
+            dbuf_put_u32(&bc_out, cc.atom);
+            dbuf_put_u16(&bc_out, idx);
+            pos_next = cc.pos;
+            break;
+          }
+#endif
           add_pc2line_info(s, bc_out.size, line_num);
           put_short_code(&bc_out, op, idx);
           break;
@@ -10792,6 +11084,22 @@ static __exception int resolve_labels(JSContext *ctx, JSFunctionDef *s)
         if (OPTIMIZE) {
           int idx;
           idx = get_u16(bc_buf + pos + 1);
+#ifdef CONFIG_SUPERINSTRUCTIONS
+          /* transformation: get_arg(n) get_field(a) -> get_arg_get_field(a, n) */
+          column_num = -1;
+          if (op == OP_get_arg &&
+              code_match(&cc, skip_column_num(bc_buf, bc_len, pos_next, &column_num), OP_get_field, -1) &&
+              cc.atom != JS_ATOM_length) {
+            if (cc.line_num >= 0) line_num = cc.line_num;
+            add_pc2line_info(s, bc_out.size, line_num);
+            if (column_num >= 0) add_pc2col_info(s, bc_out.size, column_num);
+            dbuf_putc(&bc_out, OP_get_arg_get_field);
+            dbuf_put_u32(&bc_out, cc.atom);
+            dbuf_put_u16(&bc_out, idx);
+            pos_next = cc.pos;
+            break;
+          }
+#endif
           add_pc2line_info(s, bc_out.size, line_num);
           put_short_code(&bc_out, op, idx);
           break;
@@ -11467,6 +11775,8 @@ static JSValue js_create_function(JSContext *ctx, JSFunctionDef *fd)
   b->super_allowed = fd->super_allowed;
   b->arguments_allowed = fd->arguments_allowed;
   b->backtrace_barrier = fd->backtrace_barrier;
+  b->is_lazy = fd->is_lazy;
+  b->is_lazy_func_expr = fd->is_lazy && fd->is_func_expr;
   b->realm = JS_DupContext(ctx);
 
   b->ic = fd->ic;
@@ -12088,6 +12398,17 @@ static __exception int js_parse_function_decl2(JSParseState *s,
   if (js_parse_function_check_names(s, fd, func_name))
     goto fail;
 
+  if (s->lazy_functions &&
+      (func_type == JS_PARSE_FUNC_STATEMENT ||
+       func_type == JS_PARSE_FUNC_VAR ||
+       func_type == JS_PARSE_FUNC_EXPR) &&
+      func_kind == JS_FUNC_NORMAL &&
+      fd->has_simple_parameter_list &&
+      !(fd->js_mode & JS_MODE_STRIP)) {
+    if (js_parse_lazy_function(s, fd, ptr))
+      goto fail;
+  }
+
   while (s->token.val != '}') {
     if (js_parse_source_element(s))
       goto fail;
@@ -12286,6 +12607,7 @@ void js_parse_init(JSContext *ctx, JSParseState *s,
   s->column_ptr = (const uint8_t*)input;
   s->column_last_ptr = s->column_ptr;
   s->column_num_count = 0;
+  s->buf_start = (const uint8_t *)input;
   s->buf_ptr = (const uint8_t *)input;
   s->buf_end = s->buf_ptr + input_len;
   s->token.val = ' ';
@@ -12395,15 +12717,28 @@ JSValue __JS_EvalInternal(JSContext *ctx, JSValueConst this_obj,
   fd->module = m;
   s->is_module = (m != NULL);
   s->allow_html_comments = !s->is_module;
+  s->lazy_functions = ((flags & JS_EVAL_FLAG_LAZY_FUNCTIONS) &&
+                       eval_type == JS_EVAL_TYPE_GLOBAL &&
+                       !(flags & JS_EVAL_FLAG_COMPILE_ONLY));
 
   push_scope(s); /* body scope */
   fd->body_scope = fd->scope_level;
 
   err = js_parse_program(s);
-  if (err) {
+  if (err || (s->lazy_functions && s->has_dynamic_scope &&
+              js_has_lazy_function_in_dynamic_scope(fd, FALSE))) {
   fail:
     free_token(s, &s->token);
     js_free_function_def(ctx, fd);
+    if (s->lazy_functions) {
+      /* a body delimited wrongly by the lexer only skip makes the
+         rest of the code fail to parse, and the closures of lazy
+         functions do not support 'with' or direct eval: compile
+         everything eagerly */
+      JS_FreeValue(ctx, JS_GetException(ctx));
+      return __JS_EvalInternal(ctx, this_obj, input, input_len, filename,
+                               flags & ~JS_EVAL_FLAG_LAZY_FUNCTIONS, scope_idx);
+    }
     goto fail1;
   }
 
@@ -12430,3 +12765,132 @@ fail1:
     js_free_module_def(ctx, m);
   return JS_EXCEPTION;
 }
+
+/* Compile the body of the lazy function 'b'. It is parsed as the only
+   function expression of a wrapper which has the closure variables of
+   'b', in the same way as a direct eval, so that the closure variables
+   of the result are indexes in the var_refs of the lazy function. */
+static JSValue js_compile_lazy_function(JSContext *ctx, JSFunctionBytecode *b)
+{
+  JSParseState s1, *s = &s1;
+  JSFunctionDef *fd, *child;
+  JSFunctionBytecode *b1;
+  JSValue func_obj, ret;
+  const char *filename;
+  BOOL lazy_functions = TRUE;
+  int i;
+
+  filename = JS_AtomToCString(ctx, b->debug.filename);
+  if (!filename)
+    return JS_EXCEPTION;
+retry:
+  js_parse_init(ctx, s, b->debug.source, b->debug.source_len, filename);
+  s->line_num = b->debug.line_num;
+  s->token.line_num = b->debug.line_num;
+  s->column_num_count = b->debug.column_num;
+  s->lazy_functions = lazy_functions;
+
+  fd = js_new_function_def(ctx, NULL, TRUE, FALSE, filename,
+                           b->debug.line_num, b->debug.column_num);
+  if (!fd)
+    goto fail1;
+  s->cur_func = fd;
+  fd->eval_type = JS_EVAL_TYPE_DIRECT;
+  fd->js_mode = b->js_mode;
+  fd->func_name = JS_DupAtom(ctx, JS_ATOM__eval_);
+  if (b->closure_var_count) {
+    fd->closure_var = js_malloc(ctx, sizeof(fd->closure_var[0]) * b->closure_var_count);
+    if (!fd->closure_var)
+      goto fail;
+    fd->closure_var_size = b->closure_var_count;
+    for(i = 0; i < b->closure_var_count; i++) {
+      JSClosureVar *cv0 = &b->closure_var[i];
+      JSClosureVar *cv = &fd->closure_var[fd->closure_var_count++];
+      *cv = *cv0;
+      cv->is_local = FALSE;
+      cv->var_idx = i;
+      cv->var_name = JS_DupAtom(ctx, cv0->var_name);
+    }
+  }
+
+  push_scope(s); /* body scope */
+  fd->body_scope = fd->scope_level;
+
+  if (next_token(s))
+    goto fail;
+  if (js_parse_function_decl2(s, JS_PARSE_FUNC_EXPR, JS_FUNC_NORMAL,
+                              JS_ATOM_NULL, s->token.ptr,
+                              s->token.line_num, s->token.column_num,
+                              JS_PARSE_EXPORT_NONE, &child))
+    goto fail;
+  /* a function declaration does not bind its own name */
+  child->is_func_expr = b->is_lazy_func_expr;
+  emit_op(s, OP_return);
+
+  if (s->lazy_functions && s->has_dynamic_scope &&
+      js_has_lazy_function_in_dynamic_scope(fd, FALSE)) {
+    free_token(s, &s->token);
+    js_free_function_def(ctx, fd);
+    lazy_functions = FALSE;
+    goto retry;
+  }
+
+  func_obj = js_create_function(ctx, fd);
+  if (JS_IsException(func_obj))
+    goto fail1;
+  b1 = JS_VALUE_GET_PTR(func_obj);
+  assert(b1->cpool_count == 1);
+  ret = JS_DupValue(ctx, b1->cpool[0]);
+  JS_FreeValue(ctx, func_obj);
+  JS_FreeCString(ctx, filename);
+  return ret;
+fail:
+  free_token(s, &s->token);
+  js_free_function_def(ctx, fd);
+fail1:
+  JS_FreeCString(ctx, filename);
+  return JS_EXCEPTION;
+}
+
+/* Called before the first execution of the function object 'p' whose
+   bytecode is lazy: switch it to the compiled bytecode, compiling it
+   if no other function object of the same bytecode was called. */
+int js_instantiate_lazy_function(JSContext *ctx, JSObject *p)
+{
+  JSFunctionBytecode *b, *b1;
+  JSVarRef **var_refs;
+  JSValue func_obj;
+  int i;
+
+  b = p->u.func.function_bytecode;
+  if (JS_IsNull(b->cpool[0])) {
+    func_obj = js_compile_lazy_function(ctx, b);
+    if (JS_IsException(func_obj))
+      return -1;
+    b->cpool[0] = func_obj;
+  }
+  b1 = JS_VALUE_GET_PTR(b->cpool[0]);
+
+  var_refs = NULL;
+  if (b1->closure_var_count) {
+    var_refs = js_mallocz(ctx, sizeof(var_refs[0]) * b1->closure_var_count);
+    if (!var_refs)
+      return -1;
+    for(i = 0; i < b1->closure_var_count; i++) {
+      JSClosureVar *cv = &b1->closure_var[i];
+      assert(!cv->is_local);
+      var_refs[i] = p->u.func.var_refs[cv->var_idx];
+      var_refs[i]->header.ref_count++;
+    }
+  }
+  if (p->u.func.var_refs) {
+    for(i = 0; i < b->closure_var_count; i++)
+      free_var_ref(ctx->rt, p->u.func.var_refs[i]);
+    js_free(ctx, p->u.func.var_refs);
+  }
+  p->u.func.var_refs = var_refs;
+  p->u.func.function_bytecode = b1;
+  JS_DupValue(ctx, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, b1));
+  JS_FreeValue(ctx, JS_MKPTR(JS_TAG_FUNCTION_BYTECODE, b));
+  return 0;
+}
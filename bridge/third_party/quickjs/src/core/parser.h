@@ -248,6 +248,8 @@ typedef struct JSFunctionDef {
   BOOL is_derived_class_constructor;
   BOOL in_function_body;
   BOOL backtrace_barrier;
+  BOOL is_lazy;                   /* true if the body was only pre-parsed, the
+                                     real bytecode is compiled on first call */
   JSFunctionKindEnum func_kind : 8;
   JSParseFunctionEnum func_type : 8;
   uint8_t js_mode;  /* bitmap of JS_MODE_x */
@@ -375,6 +377,7 @@ typedef struct JSParseState {
   JSToken token;
   BOOL got_lf; /* true if got line feed before the current token */
   const uint8_t *last_ptr;
+  const uint8_t *buf_start;
   const uint8_t *buf_ptr;
   const uint8_t *buf_end;
 
@@ -383,6 +386,8 @@ typedef struct JSParseState {
   BOOL is_module; /* parsing a module */
   BOOL allow_html_comments;
   BOOL ext_json; /* true if accepting JSON superset */
+  BOOL lazy_functions; /* defer the compilation of large function bodies */
+  BOOL has_dynamic_scope; /* 'with' or direct eval seen */
 } JSParseState;
 
 typedef struct JSOpCode {
@@ -438,5 +443,6 @@ JSValue js_import_meta(JSContext* ctx);
 JSValue __JS_EvalInternal(JSContext *ctx, JSValueConst this_obj,
                                  const char *input, size_t input_len,
                                  const char *filename, int flags, int scope_idx);
+int js_instantiate_lazy_function(JSContext *ctx, JSObject *p);
 
 #endif
\ No newline at end of file
@@ -32,6 +32,7 @@
 #include "builtins/js-string.h"
 #include "exception.h"
 #include "function.h"
+#include "ic.h"
 #include "malloc.h"
 #include "string.h"
 
@@ -48,6 +49,7 @@
 #include "builtins/js-number.h"
 #include "builtins/js-operator.h"
 #include "builtins/js-reflect.h"
+#include "builtins/js-regexp.h"
 #include "builtins/js-symbol.h"
 #include "convertion.h"
 #include "gc.h"
@@ -387,6 +389,7 @@ JSValueConst JS_GetPrototypePrimitive(JSContext* ctx, JSValueConst val) {
       val = ctx->class_proto[JS_CLASS_BOOLEAN];
       break;
     case JS_TAG_STRING:
+    case JS_TAG_STRING_ROPE:
       val = ctx->class_proto[JS_CLASS_STRING];
       break;
     case JS_TAG_SYMBOL:
@@ -1121,7 +1124,7 @@ const char* get_func_name(JSContext* ctx, JSValueConst func) {
   if ((prs->flags & JS_PROP_TMASK) != JS_PROP_NORMAL)
     return NULL;
   val = pr->u.value;
-  if (JS_VALUE_GET_TAG(val) != JS_TAG_STRING)
+  if (!JS_IsString(val))
     return NULL;
   return JS_ToCString(ctx, val);
 }
@@ -2594,6 +2597,7 @@ void JS_FreeRuntime(JSRuntime* rt) {
     js_free_rt(rt, e);
   }
   init_list_head(&rt->job_list);
+  js_regexp_cache_clear(rt);
 
   JS_RunGC(rt);
 
@@ -2723,6 +2727,7 @@ void JS_FreeRuntime(JSRuntime* rt) {
   js_free_rt(rt, rt->atom_array);
   js_free_rt(rt, rt->atom_hash);
   js_free_rt(rt, rt->shape_hash);
+  free_ic_stub_cache(rt);
 #ifdef DUMP_LEAKS
   if (!list_empty(&rt->string_list)) {
     if (rt->rt_info) {
@@ -2770,16 +2775,37 @@ void JS_FreeRuntime(JSRuntime* rt) {
 
 JSContext* JS_NewContextRaw(JSRuntime* rt) {
   JSContext* ctx;
+  JSMemoryAccount* acc = NULL;
+  JSMemoryAccount* prev = rt->current_account;
   int i;
 
+  if (rt->memory_accounting) {
+    acc = js_new_memory_account(rt);
+    if (!acc)
+      return NULL;
+    /* the context itself is charged to its own account */
+    rt->current_account = acc;
+  }
+
   ctx = js_mallocz_rt(rt, sizeof(JSContext));
-  if (!ctx)
+  if (!ctx) {
+    js_leave_memory_account(rt, prev);
+    if (acc)
+      js_detach_memory_account(rt, acc);
     return NULL;
+  }
   ctx->header.ref_count = 1;
   add_gc_object(rt, &ctx->header, JS_GC_OBJ_TYPE_JS_CONTEXT);
+  ctx->mem_account = acc;
+  if (acc)
+    acc->ctx = ctx;
 
   ctx->class_proto = js_malloc_rt(rt, sizeof(ctx->class_proto[0]) * rt->class_count);
   if (!ctx->class_proto) {
+    js_leave_memory_account(rt, prev);
+    remove_gc_object(&ctx->header);
+    if (acc)
+      js_detach_memory_account(rt, acc);
     js_free_rt(rt, ctx);
     return NULL;
   }
@@ -2798,6 +2824,7 @@ JSContext* JS_NewContextRaw(JSRuntime* rt) {
   init_list_head(&ctx->loaded_modules);
 
   JS_AddIntrinsicBasicObjects(ctx);
+  js_leave_memory_account(rt, prev);
   return ctx;
 }
 
@@ -2903,7 +2930,9 @@ void JS_FreeContext(JSContext* ctx) {
 
   list_del(&ctx->link);
   remove_gc_object(&ctx->header);
-  js_free_rt(ctx->rt, ctx);
+  if (ctx->mem_account)
+    js_detach_memory_account(rt, ctx->mem_account);
+  js_free_rt(rt, ctx);
 }
 
 JSRuntime* JS_GetRuntime(JSContext* ctx) {
@@ -2989,7 +3018,7 @@ int init_class_range(JSRuntime* rt, JSClassShortDef const* tab, int start, int c
   return 0;
 }
 
-JSRuntime* JS_NewRuntime2(const JSMallocFunctions* mf, void* opaque) {
+static JSRuntime* js_new_runtime(const JSMallocFunctions* mf, void* opaque, BOOL memory_accounting) {
   JSRuntime* rt;
   JSMallocState ms;
 
@@ -3002,6 +3031,7 @@ JSRuntime* JS_NewRuntime2(const JSMallocFunctions* mf, void* opaque) {
     return NULL;
   memset(rt, 0, sizeof(*rt));
   rt->mf = *mf;
+  rt->memory_accounting = memory_accounting;
   if (!rt->mf.js_malloc_usable_size) {
     /* use dummy function if none provided */
     rt->mf.js_malloc_usable_size = js_malloc_usable_size_unknown;
@@ -3026,6 +3056,8 @@ JSRuntime* JS_NewRuntime2(const JSMallocFunctions* mf, void* opaque) {
   init_list_head(&rt->string_list);
 #endif
   init_list_head(&rt->job_list);
+  init_list_head(&rt->regexp_cache_list);
+  rt->regexp_cache_capacity = JS_REGEXP_CACHE_DEFAULT_CAPACITY;
 
   if (JS_InitAtoms(rt))
     goto fail;
@@ -3056,6 +3088,10 @@ fail:
   return NULL;
 }
 
+JSRuntime* JS_NewRuntime2(const JSMallocFunctions* mf, void* opaque) {
+  return js_new_runtime(mf, opaque, FALSE);
+}
+
 /* eval */
 
 void JS_AddIntrinsicEval(JSContext* ctx) {
@@ -3088,6 +3124,10 @@ JSRuntime* JS_NewRuntime(void) {
   return JS_NewRuntime2(&def_malloc_funcs, NULL);
 }
 
+JSRuntime* JS_NewRuntimeWithMemoryAccounting(void) {
+  return js_new_runtime(&def_malloc_funcs, NULL, TRUE);
+}
+
 /* the indirection is needed to make 'eval' optional */
 JSValue JS_EvalInternal(JSContext* ctx, JSValueConst this_obj, const char* input, size_t input_len, const char* filename, int flags, int scope_idx) {
   if (unlikely(!ctx->eval_internal)) {
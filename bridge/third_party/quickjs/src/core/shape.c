@@ -25,6 +25,7 @@
 
 #include "shape.h"
 #include "gc.h"
+#include "ic.h"
 #include "malloc.h"
 #include "object.h"
 #include "string.h"
@@ -96,6 +97,9 @@ void js_shape_hash_unlink(JSRuntime* rt, JSShape* sh) {
   uint32_t h;
   JSShape** psh;
 
+  /* the shape is about to be modified or freed */
+  if (unlikely(sh->in_ic_stub_cache))
+    ic_stub_cache_remove_shape(rt, sh);
   h = get_shape_hash(sh->hash, rt->shape_hash_bits);
   psh = &rt->shape_hash[h];
   while (*psh != sh)
@@ -464,7 +468,7 @@ __maybe_unused void JS_DumpShapes(JSRuntime* rt) {
 JSValue JS_NewObjectFromShape(JSContext* ctx, JSShape* sh, JSClassID class_id) {
   JSObject* p;
 
-  js_trigger_gc(ctx->rt, sizeof(JSObject));
+  js_trigger_gc(ctx->rt, ctx->mem_account, sizeof(JSObject));
   p = js_malloc(ctx, sizeof(JSObject));
   if (unlikely(!p))
     goto fail;
@@ -0,0 +1,622 @@
+/*
+ * QuickJS Javascript Engine
+ *
+ * Copyright (c) 2017-2021 Fabrice Bellard
+ * Copyright (c) 2017-2021 Charlie Gordon
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+ * THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#ifndef QUICKJS_SIMD_H
+#define QUICKJS_SIMD_H
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "quickjs/cutils.h"
+
+/* 16 byte vector scanning helpers for the string and typed array hot
+   paths. SSE2 is part of the x86_64 baseline and NEON of arm64, other
+   targets use the scalar loops. Every helper reads only inside the given
+   range. */
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define JS_SIMD_SSE2 1
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#define JS_SIMD_NEON 1
+#endif
+
+#ifdef JS_SIMD_NEON
+/* index of the first non zero byte of a compare result, 16 if none */
+static inline int js_simd_first_set_u8(uint8x16_t m)
+{
+  uint64_t bits = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(m), 4)), 0);
+  return bits ? ctz64(bits) >> 2 : 16;
+}
+#endif
+
+/* Return the first byte in [p, end) which ends the plain part of a JSON
+   string body: '"', '\\', a control character or a non ASCII byte. */
+static inline const uint8_t *js_simd_json_string_end(const uint8_t *p, const uint8_t *end)
+{
+#if defined(JS_SIMD_SSE2)
+  const __m128i quote = _mm_set1_epi8('\"');
+  const __m128i bslash = _mm_set1_epi8('\\');
+  const __m128i space = _mm_set1_epi8(' ');
+  while (end - p >= 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)p);
+    /* signed compare: both the control and the non ASCII bytes are below ' ' */
+    __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, bslash)),
+                             _mm_cmplt_epi8(v, space));
+    int mask = _mm_movemask_epi8(m);
+    if (mask)
+      return p + ctz32(mask);
+    p += 16;
+  }
+#elif defined(JS_SIMD_NEON)
+  const uint8x16_t quote = vdupq_n_u8('\"');
+  const uint8x16_t bslash = vdupq_n_u8('\\');
+  const uint8x16_t space = vdupq_n_u8(' ');
+  const uint8x16_t ascii = vdupq_n_u8(0x7f);
+  while (end - p >= 16) {
+    uint8x16_t v = vld1q_u8(p);
+    uint8x16_t m = vorrq_u8(vorrq_u8(vceqq_u8(v, quote), vceqq_u8(v, bslash)),
+                            vorrq_u8(vcltq_u8(v, space), vcgtq_u8(v, ascii)));
+    int i = js_simd_first_set_u8(m);
+    if (i < 16)
+      return p + i;
+    p += 16;
+  }
+#endif
+  while (p < end && *p != '\"' && *p != '\\' && *p >= ' ' && *p < 0x80)
+    p++;
+  return p;
+}
+
+/* Return the first byte in [p, end) which is not a space or a tab. */
+static inline const uint8_t *js_simd_skip_blanks(const uint8_t *p, const uint8_t *end)
+{
+#if defined(JS_SIMD_SSE2)
+  const __m128i space = _mm_set1_epi8(' ');
+  const __m128i tab = _mm_set1_epi8('\t');
+  while (end - p >= 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)p);
+    int mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab))) ^ 0xffff;
+    if (mask)
+      return p + ctz32(mask);
+    p += 16;
+  }
+#elif defined(JS_SIMD_NEON)
+  const uint8x16_t space = vdupq_n_u8(' ');
+  const uint8x16_t tab = vdupq_n_u8('\t');
+  while (end - p >= 16) {
+    uint8x16_t v = vld1q_u8(p);
+    int i = js_simd_first_set_u8(vmvnq_u8(vorrq_u8(vceqq_u8(v, space), vceqq_u8(v, tab))));
+    if (i < 16)
+      return p + i;
+    p += 16;
+  }
+#endif
+  while (p < end && (*p == ' ' || *p == '\t'))
+    p++;
+  return p;
+}
+
+/* Return the index of the first character of p[0..len) which
+   JSON.stringify escapes: '"', '\\' or a control character. */
+static inline uint32_t js_simd_json_escape8(const uint8_t *p, uint32_t len)
+{
+  uint32_t i = 0;
+#if defined(JS_SIMD_SSE2)
+  const __m128i quote = _mm_set1_epi8('\"');
+  const __m128i bslash = _mm_set1_epi8('\\');
+  const __m128i ctrl = _mm_set1_epi8(0x1f);
+  for (; i + 16 <= len; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+    /* min(v, 0x1f) == v for the control characters only */
+    __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, quote), _mm_cmpeq_epi8(v, bslash)),
+                             _mm_cmpeq_epi8(_mm_min_epu8(v, ctrl), v));
+    int mask = _mm_movemask_epi8(m);
+    if (mask)
+      return i + ctz32(mask);
+  }
+#elif defined(JS_SIMD_NEON)
+  const uint8x16_t quote = vdupq_n_u8('\"');
+  const uint8x16_t bslash = vdupq_n_u8('\\');
+  const uint8x16_t space = vdupq_n_u8(' ');
+  for (; i + 16 <= len; i += 16) {
+    uint8x16_t v = vld1q_u8(p + i);
+    int k = js_simd_first_set_u8(vorrq_u8(vorrq_u8(vceqq_u8(v, quote), vceqq_u8(v, bslash)), vcltq_u8(v, space)));
+    if (k < 16)
+      return i + k;
+  }
+#endif
+  for (; i < len; i++) {
+    if (p[i] == '\"' || p[i] == '\\' || p[i] < ' ')
+      break;
+  }
+  return i;
+}
+
+/* Same as js_simd_json_escape8() for 16 bit strings, where the
+   surrogates are escaped as well. */
+static inline uint32_t js_simd_json_escape16(const uint16_t *p, uint32_t len)
+{
+  uint32_t i = 0;
+#if defined(JS_SIMD_SSE2)
+  const __m128i quote = _mm_set1_epi16('\"');
+  const __m128i bslash = _mm_set1_epi16('\\');
+  const __m128i bias = _mm_set1_epi16(-0x8000);
+  const __m128i space = _mm_set1_epi16(' ' - 0x8000);
+  const __m128i surrogate_mask = _mm_set1_epi16((short)0xf800);
+  const __m128i surrogate = _mm_set1_epi16((short)0xd800);
+  for (; i + 8 <= len; i += 8) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(p + i));
+    /* unsigned compare through the signed one by flipping the top bit */
+    __m128i m = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi16(v, quote), _mm_cmpeq_epi16(v, bslash)),
+                             _mm_or_si128(_mm_cmplt_epi16(_mm_xor_si128(v, bias), space),
+                                          _mm_cmpeq_epi16(_mm_and_si128(v, surrogate_mask), surrogate)));
+    int mask = _mm_movemask_epi8(m);
+    if (mask)
+      return i + (ctz32(mask) >> 1);
+  }
+#elif defined(JS_SIMD_NEON)
+  const uint16x8_t quote = vdupq_n_u16('\"');
+  const uint16x8_t bslash = vdupq_n_u16('\\');
+  const uint16x8_t space = vdupq_n_u16(' ');
+  const uint16x8_t surrogate_mask = vdupq_n_u16(0xf800);
+  const uint16x8_t surrogate = vdupq_n_u16(0xd800);
+  for (; i + 8 <= len; i += 8) {
+    uint16x8_t v = vld1q_u16(p + i);
+    uint16x8_t m = vorrq_u16(vorrq_u16(vceqq_u16(v, quote), vceqq_u16(v, bslash)),
+                             vorrq_u16(vcltq_u16(v, space), vceqq_u16(vandq_u16(v, surrogate_mask), surrogate)));
+    int k = js_simd_first_set_u8(vreinterpretq_u8_u16(m));
+    if (k < 16)
+      return i + (k >> 1);
+  }
+#endif
+  for (; i < len; i++) {
+    if (p[i] == '\"' || p[i] == '\\' || p[i] < ' ' || (p[i] >= 0xd800 && p[i] < 0xe000))
+      break;
+  }
+  return i;
+}
+
+/* Element search helpers of %TypedArray%.prototype.indexOf and includes:
+   return the index of the first element of p[0..len) equal to v, len if
+   none. The float versions use the IEEE comparison, v must not be a NaN. */
+static inline uint32_t js_simd_find_u16(const uint16_t *p, uint32_t len, uint16_t v)
+{
+  uint32_t i = 0;
+#if defined(JS_SIMD_SSE2)
+  const __m128i vv = _mm_set1_epi16(v);
+  for (; i + 8 <= len; i += 8) {
+    int mask = _mm_movemask_epi8(_mm_cmpeq_epi16(_mm_loadu_si128((const __m128i *)(p + i)), vv));
+    if (mask)
+      return i + (ctz32(mask) >> 1);
+  }
+#elif defined(JS_SIMD_NEON)
+  const uint16x8_t vv = vdupq_n_u16(v);
+  for (; i + 8 <= len; i += 8) {
+    int k = js_simd_first_set_u8(vreinterpretq_u8_u16(vceqq_u16(vld1q_u16(p + i), vv)));
+    if (k < 16)
+      return i + (k >> 1);
+  }
+#endif
+  while (i < len && p[i] != v)
+    i++;
+  return i;
+}
+
+static inline uint32_t js_simd_find_u32(const uint32_t *p, uint32_t len, uint32_t v)
+{
+  uint32_t i = 0;
+#if defined(JS_SIMD_SSE2)
+  const __m128i vv = _mm_set1_epi32(v);
+  for (; i + 4 <= len; i += 4) {
+    int mask = _mm_movemask_epi8(_mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)(p + i)), vv));
+    if (mask)
+      return i + (ctz32(mask) >> 2);
+  }
+#elif defined(JS_SIMD_NEON)
+  const uint32x4_t vv = vdupq_n_u32(v);
+  for (; i + 4 <= len; i += 4) {
+    int k = js_simd_first_set_u8(vreinterpretq_u8_u32(vceqq_u32(vld1q_u32(p + i), vv)));
+    if (k < 16)
+      return i + (k >> 2);
+  }
+#endif
+  while (i < len && p[i] != v)
+    i++;
+  return i;
+}
+
+static inline uint32_t js_simd_find_f32(const float *p, uint32_t len, float v)
+{
+  uint32_t i = 0;
+#if defined(JS_SIMD_SSE2)
+  const __m128 vv = _mm_set1_ps(v);
+  for (; i + 4 <= len; i += 4) {
+    int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(p + i), vv));
+    if (mask)
+      return i + ctz32(mask);
+  }
+#elif defined(JS_SIMD_NEON)
+  const float32x4_t vv = vdupq_n_f32(v);
+  for (; i + 4 <= len; i += 4) {
+    int k = js_simd_first_set_u8(vreinterpretq_u8_u32(vceqq_f32(vld1q_f32(p + i), vv)));
+    if (k < 16)
+      return i + (k >> 2);
+  }
+#endif
+  while (i < len && p[i] != v)
+    i++;
+  return i;
+}
+
+static inline uint32_t js_simd_find_f64(const double *p, uint32_t len, double v)
+{
+  uint32_t i = 0;
+#if defined(JS_SIMD_SSE2)
+  const __m128d vv = _mm_set1_pd(v);
+  for (; i + 2 <= len; i += 2) {
+    int mask = _mm_movemask_pd(_mm_cmpeq_pd(_mm_loadu_pd(p + i), vv));
+    if (mask)
+      return i + ctz32(mask);
+  }
+#elif defined(JS_SIMD_NEON)
+  const float64x2_t vv = vdupq_n_f64(v);
+  for (; i + 2 <= len; i += 2) {
+    int k = js_simd_first_set_u8(vreinterpretq_u8_u64(vceqq_f64(vld1q_f64(p + i), vv)));
+    if (k < 16)
+      return i + (k >> 3);
+  }
+#endif
+  while (i < len && p[i] != v)
+    i++;
+  return i;
+}
+
+/* Return the index of the first NaN of p[0..len), len if none. */
+static inline uint32_t js_simd_find_nan_f32(const float *p, uint32_t len)
+{
+  uint32_t i = 0;
+#if defined(JS_SIMD_SSE2)
+  for (; i + 4 <= len; i += 4) {
+    __m128 v = _mm_loadu_ps(p + i);
+    int mask = _mm_movemask_ps(_mm_cmpunord_ps(v, v));
+    if (mask)
+      return i + ctz32(mask);
+  }
+#elif defined(JS_SIMD_NEON)
+  for (; i + 4 <= len; i += 4) {
+    float32x4_t v = vld1q_f32(p + i);
+    int k = js_simd_first_set_u8(vmvnq_u8(vreinterpretq_u8_u32(vceqq_f32(v, v))));
+    if (k < 16)
+      return i + (k >> 2);
+  }
+#endif
+  while (i < len && !isnan(p[i]))
+    i++;
+  return i;
+}
+
+static inline uint32_t js_simd_find_nan_f64(const double *p, uint32_t len)
+{
+  uint32_t i = 0;
+#if defined(JS_SIMD_SSE2)
+  for (; i + 2 <= len; i += 2) {
+    __m128d v = _mm_loadu_pd(p + i);
+    int mask = _mm_movemask_pd(_mm_cmpunord_pd(v, v));
+    if (mask)
+      return i + ctz32(mask);
+  }
+#elif defined(JS_SIMD_NEON)
+  for (; i + 2 <= len; i += 2) {
+    float64x2_t v = vld1q_f64(p + i);
+    int k = js_simd_first_set_u8(vmvnq_u8(vreinterpretq_u8_u64(vceqq_f64(v, v))));
+    if (k < 16)
+      return i + (k >> 3);
+  }
+#endif
+  while (i < len && !isnan(p[i]))
+    i++;
+  return i;
+}
+
+/* Candidate positions of a substring search: return the first i of
+   [0, n) with p[i] == c0 and p[i + dist] == c1, n if none. p[0, n + dist)
+   must be readable. */
+static inline uint32_t js_simd_find_pair_u8(const uint8_t *p, uint32_t n, uint8_t c0, uint8_t c1, uint32_t dist)
+{
+  uint32_t i = 0;
+#if defined(JS_SIMD_SSE2)
+  const __m128i v0 = _mm_set1_epi8(c0);
+  const __m128i v1 = _mm_set1_epi8(c1);
+  for (; i + 16 <= n; i += 16) {
+    __m128i m = _mm_and_si128(_mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(p + i)), v0),
+                              _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *)(p + i + dist)), v1));
+    int mask = _mm_movemask_epi8(m);
+    if (mask)
+      return i + ctz32(mask);
+  }
+#elif defined(JS_SIMD_NEON)
+  const uint8x16_t v0 = vdupq_n_u8(c0);
+  const uint8x16_t v1 = vdupq_n_u8(c1);
+  for (; i + 16 <= n; i += 16) {
+    uint8x16_t m = vandq_u8(vceqq_u8(vld1q_u8(p + i), v0), vceqq_u8(vld1q_u8(p + i + dist), v1));
+    int k = js_simd_first_set_u8(m);
+    if (k < 16)
+      return i + k;
+  }
+#endif
+  for (; i < n; i++) {
+    if (p[i] == c0 && p[i + dist] == c1)
+      break;
+  }
+  return i;
+}
+
+static inline uint32_t js_simd_find_pair_u16(const uint16_t *p, uint32_t n, uint16_t c0, uint16_t c1, uint32_t dist)
+{
+  uint32_t i = 0;
+#if defined(JS_SIMD_SSE2)
+  const __m128i v0 = _mm_set1_epi16(c0);
+  const __m128i v1 = _mm_set1_epi16(c1);
+  for (; i + 8 <= n; i += 8) {
+    __m128i m = _mm_and_si128(_mm_cmpeq_epi16(_mm_loadu_si128((const __m128i *)(p + i)), v0),
+                              _mm_cmpeq_epi16(_mm_loadu_si128((const __m128i *)(p + i + dist)), v1));
+    int mask = _mm_movemask_epi8(m);
+    if (mask)
+      return i + (ctz32(mask) >> 1);
+  }
+#elif defined(JS_SIMD_NEON)
+  const uint16x8_t v0 = vdupq_n_u16(c0);
+  const uint16x8_t v1 = vdupq_n_u16(c1);
+  for (; i + 8 <= n; i += 8) {
+    uint16x8_t m = vandq_u16(vceqq_u16(vld1q_u16(p + i), v0), vceqq_u16(vld1q_u16(p + i + dist), v1));
+    int k = js_simd_first_set_u8(vreinterpretq_u8_u16(m));
+    if (k < 16)
+      return i + (k >> 1);
+  }
+#endif
+  for (; i < n; i++) {
+    if (p[i] == c0 && p[i + dist] == c1)
+      break;
+  }
+  return i;
+}
+
+/* Transcoding helpers of cutils.c. */
+
+/* Return the length of the ASCII prefix of p[0..len). */
+static inline size_t js_simd_ascii_len8(const uint8_t *p, size_t len)
+{
+  size_t i = 0;
+#if defined(JS_SIMD_SSE2)
+  for (; i + 16 <= len; i += 16) {
+    int mask = _mm_movemask_epi8(_mm_loadu_si128((const __m128i *)(p + i)));
+    if (mask)
+      return i + ctz32(mask);
+  }
+#elif defined(JS_SIMD_NEON)
+  const uint8x16_t ascii = vdupq_n_u8(0x80);
+  for (; i + 16 <= len; i += 16) {
+    int k = js_simd_first_set_u8(vcgeq_u8(vld1q_u8(p + i), ascii));
+    if (k < 16)
+      return i + k;
+  }
+#endif
+  while (i < len && p[i] < 0x80)
+    i++;
+  return i;
+}
+
+/* Return the length of the prefix of p[0..len) whose elements have none
+   of the bits of 'mask': 0xff80 for ASCII, 0xff00 for Latin-1. */
+static inline size_t js_simd_prefix_len16(const uint16_t *p, size_t len, uint16_t mask)
+{
+  size_t i = 0;
+#if defined(JS_SIMD_SSE2)
+  const __m128i vmask = _mm_set1_epi16(mask);
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 8 <= len; i += 8) {
+    __m128i v = _mm_and_si128(_mm_loadu_si128((const __m128i *)(p + i)), vmask);
+    int m = _mm_movemask_epi8(_mm_cmpeq_epi16(v, zero)) ^ 0xffff;
+    if (m)
+      return i + (ctz32(m) >> 1);
+  }
+#elif defined(JS_SIMD_NEON)
+  const uint16x8_t vmask = vdupq_n_u16(mask);
+  for (; i + 8 <= len; i += 8) {
+    int k = js_simd_first_set_u8(vreinterpretq_u8_u16(vtstq_u16(vld1q_u16(p + i), vmask)));
+    if (k < 16)
+      return i + (k >> 1);
+  }
+#endif
+  while (i < len && !(p[i] & mask))
+    i++;
+  return i;
+}
+
+/* dst[i] = src[i] for i < len. */
+static inline void js_simd_widen8(uint16_t *dst, const uint8_t *src, size_t len)
+{
+  size_t i = 0;
+#if defined(JS_SIMD_SSE2)
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= len; i += 16) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+    _mm_storeu_si128((__m128i *)(dst + i), _mm_unpacklo_epi8(v, zero));
+    _mm_storeu_si128((__m128i *)(dst + i + 8), _mm_unpackhi_epi8(v, zero));
+  }
+#elif defined(JS_SIMD_NEON)
+  for (; i + 16 <= len; i += 16) {
+    uint8x16_t v = vld1q_u8(src + i);
+    vst1q_u16(dst + i, vmovl_u8(vget_low_u8(v)));
+    vst1q_u16(dst + i + 8, vmovl_u8(vget_high_u8(v)));
+  }
+#endif
+  for (; i < len; i++)
+    dst[i] = src[i];
+}
+
+/* dst[i] = src[i] for i < len, the elements of src must be below 0x100. */
+static inline void js_simd_narrow16(uint8_t *dst, const uint16_t *src, size_t len)
+{
+  size_t i = 0;
+#if defined(JS_SIMD_SSE2)
+  for (; i + 16 <= len; i += 16) {
+    __m128i lo = _mm_loadu_si128((const __m128i *)(src + i));
+    __m128i hi = _mm_loadu_si128((const __m128i *)(src + i + 8));
+    _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(lo, hi));
+  }
+#elif defined(JS_SIMD_NEON)
+  for (; i + 16 <= len; i += 16) {
+    uint8x16_t v = vcombine_u8(vmovn_u16(vld1q_u16(src + i)), vmovn_u16(vld1q_u16(src + i + 8)));
+    vst1q_u8(dst + i, v);
+  }
+#endif
+  for (; i < len; i++)
+    dst[i] = src[i];
+}
+
+/* Base64 helpers of cutils.c, using the standard alphabet. */
+
+/* Encode the leading whole blocks of src[0..len) and return the number of
+   source bytes consumed, a multiple of 3. 4 characters are written to dst
+   for each 3 bytes. */
+static inline size_t js_simd_b64_encode(uint8_t *dst, const uint8_t *src, size_t len)
+{
+  size_t i = 0;
+#if defined(JS_SIMD_SSE2)
+  /* No byte shuffle in SSE2: the 3 byte groups are gathered with byte
+     shifts and the sextets are mapped to ASCII with range compares. */
+  const __m128i m0 = _mm_set1_epi32(0x0000003f), m1 = _mm_set1_epi32(0x00003000);
+  const __m128i m2 = _mm_set1_epi32(0x00000f00), m3 = _mm_set1_epi32(0x003c0000);
+  const __m128i m4 = _mm_set1_epi32(0x00030000), m5 = _mm_set1_epi32(0x3f000000);
+  for (; i + 16 <= len; i += 12) {
+    __m128i v = _mm_loadu_si128((const __m128i *)(src + i));
+    /* lane k holds src[3k] | src[3k + 1] << 8 | src[3k + 2] << 16 */
+    __m128i x = _mm_unpacklo_epi64(_mm_unpacklo_epi32(v, _mm_srli_si128(v, 3)),
+                                   _mm_unpacklo_epi32(_mm_srli_si128(v, 6), _mm_srli_si128(v, 9)));
+    __m128i s = _mm_and_si128(_mm_srli_epi32(x, 2), m0);
+    s = _mm_or_si128(s, _mm_and_si128(_mm_slli_epi32(x, 12), m1));
+    s = _mm_or_si128(s, _mm_and_si128(_mm_srli_epi32(x, 4), m2));
+    s = _mm_or_si128(s, _mm_and_si128(_mm_slli_epi32(x, 10), m3));
+    s = _mm_or_si128(s, _mm_and_si128(_mm_srli_epi32(x, 6), m4));
+    s = _mm_or_si128(s, _mm_and_si128(_mm_slli_epi32(x, 8), m5));
+    __m128i off = _mm_set1_epi8('A');
+    off = _mm_add_epi8(off, _mm_and_si128(_mm_cmpgt_epi8(s, _mm_set1_epi8(25)), _mm_set1_epi8(6)));
+    off = _mm_add_epi8(off, _mm_and_si128(_mm_cmpgt_epi8(s, _mm_set1_epi8(51)), _mm_set1_epi8(-75)));
+    off = _mm_add_epi8(off, _mm_and_si128(_mm_cmpeq_epi8(s, _mm_set1_epi8(62)), _mm_set1_epi8(-15)));
+    off = _mm_add_epi8(off, _mm_and_si128(_mm_cmpeq_epi8(s, _mm_set1_epi8(63)), _mm_set1_epi8(-12)));
+    _mm_storeu_si128((__m128i *)(dst + i / 3 * 4), _mm_add_epi8(s, off));
+  }
+#elif defined(JS_SIMD_NEON)
+  static const uint8_t table[64] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  const uint8x16x4_t lut = vld1q_u8_x4(table);
+  const uint8x16_t mask = vdupq_n_u8(0x3f);
+  for (; i + 48 <= len; i += 48) {
+    uint8x16x3_t v = vld3q_u8(src + i);
+    uint8x16x4_t out;
+    out.val[0] = vqtbl4q_u8(lut, vshrq_n_u8(v.val[0], 2));
+    out.val[1] = vqtbl4q_u8(lut, vandq_u8(vorrq_u8(vshlq_n_u8(v.val[0], 4), vshrq_n_u8(v.val[1], 4)), mask));
+    out.val[2] = vqtbl4q_u8(lut, vandq_u8(vorrq_u8(vshlq_n_u8(v.val[1], 2), vshrq_n_u8(v.val[2], 6)), mask));
+    out.val[3] = vqtbl4q_u8(lut, vandq_u8(v.val[2], mask));
+    vst4q_u8(dst + i / 3 * 4, out);
+  }
+#endif
+  return i;
+}
+
+/* Decode the leading blocks of src[0..len) which only contain characters
+   of the alphabet and return the number of characters consumed, a
+   multiple of 4. 3 bytes are written to dst for each 4 characters. */
+static inline size_t js_simd_b64_decode(uint8_t *dst, const uint8_t *src, size_t len)
+{
+  size_t i = 0;
+#if defined(JS_SIMD_SSE2)
+  const __m128i lo6 = _mm_set1_epi16(0x00ff), lo12 = _mm_set1_epi32(0xffff);
+  for (; i + 16 <= len; i += 16) {
+    __m128i c = _mm_loadu_si128((const __m128i *)(src + i));
+    /* the signed compares reject the non ASCII bytes */
+    __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('Z' + 1)));
+    __m128i lower = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('a' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('z' + 1)));
+    __m128i digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)), _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+    __m128i plus = _mm_cmpeq_epi8(c, _mm_set1_epi8('+'));
+    __m128i slash = _mm_cmpeq_epi8(c, _mm_set1_epi8('/'));
+    if (_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(upper, lower), _mm_or_si128(digit, _mm_or_si128(plus, slash)))) !=
+        0xffff)
+      break;
+    __m128i off = _mm_and_si128(upper, _mm_set1_epi8(-'A'));
+    off = _mm_or_si128(off, _mm_and_si128(lower, _mm_set1_epi8(26 - 'a')));
+    off = _mm_or_si128(off, _mm_and_si128(digit, _mm_set1_epi8(52 - '0')));
+    off = _mm_or_si128(off, _mm_and_si128(plus, _mm_set1_epi8(62 - '+')));
+    off = _mm_or_si128(off, _mm_and_si128(slash, _mm_set1_epi8(63 - '/')));
+    __m128i v = _mm_add_epi8(c, off);
+    /* merge the sextets of each 4 character group into 24 bits */
+    v = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(v, lo6), 6), _mm_srli_epi16(v, 8));
+    v = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(v, lo12), 12), _mm_srli_epi32(v, 16));
+    uint32_t n[4];
+    _mm_storeu_si128((__m128i *)n, v);
+    uint8_t *q = dst + i / 4 * 3;
+    for (int k = 0; k < 4; k++) {
+      q[3 * k] = n[k] >> 16;
+      q[3 * k + 1] = n[k] >> 8;
+      q[3 * k + 2] = n[k];
+    }
+  }
+#elif defined(JS_SIMD_NEON)
+  /* 0xff marks the characters out of the alphabet */
+  static const uint8_t table[128] = {
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 62,   0xff, 0xff, 0xff, 63,
+      52,   53,   54,   55,   56,   57,   58,   59,   60,   61,   0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 0,    1,    2,    3,    4,    5,    6,    7,    8,    9,    10,   11,   12,   13,   14,
+      15,   16,   17,   18,   19,   20,   21,   22,   23,   24,   25,   0xff, 0xff, 0xff, 0xff, 0xff,
+      0xff, 26,   27,   28,   29,   30,   31,   32,   33,   34,   35,   36,   37,   38,   39,   40,
+      41,   42,   43,   44,   45,   46,   47,   48,   49,   50,   51,   0xff, 0xff, 0xff, 0xff, 0xff,
+  };
+  const uint8x16x4_t lut0 = vld1q_u8_x4(table), lut1 = vld1q_u8_x4(table + 64);
+  const uint8x16_t base = vdupq_n_u8(64), high = vdupq_n_u8(0x80);
+  for (; i + 64 <= len; i += 64) {
+    uint8x16x4_t c = vld4q_u8(src + i);
+    uint8x16_t v[4], err = vdupq_n_u8(0);
+    for (int k = 0; k < 4; k++) {
+      /* out of range indexes look up 0, the non ASCII bytes are flagged
+         separately */
+      v[k] = vorrq_u8(vqtbl4q_u8(lut0, c.val[k]), vqtbl4q_u8(lut1, vsubq_u8(c.val[k], base)));
+      err = vorrq_u8(err, vorrq_u8(v[k], vandq_u8(c.val[k], high)));
+    }
+    if (vmaxvq_u8(err) >= 64)
+      break;
+    uint8x16x3_t out;
+    out.val[0] = vorrq_u8(vshlq_n_u8(v[0], 2), vshrq_n_u8(v[1], 4));
+    out.val[1] = vorrq_u8(vshlq_n_u8(v[1], 4), vshrq_n_u8(v[2], 2));
+    out.val[2] = vorrq_u8(vshlq_n_u8(v[2], 6), v[3]);
+    vst3q_u8(dst + i / 4 * 3, out);
+  }
+#endif
+  return i;
+}
+
+#endif
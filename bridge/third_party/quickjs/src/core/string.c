@@ -26,6 +26,8 @@
 #include "string.h"
 #include "convertion.h"
 #include "exception.h"
+#include "malloc.h"
+#include "simd.h"
 #include "quickjs/cutils.h"
 #include "quickjs/list.h"
 
@@ -49,7 +51,9 @@ JSString* js_alloc_string_rt(JSRuntime* rt, int max_len, int is_wide_char) {
 
 JSString* js_alloc_string(JSContext* ctx, int max_len, int is_wide_char) {
   JSString* p;
+  JSMemoryAccount* prev = js_enter_memory_account(ctx);
   p = js_alloc_string_rt(ctx->rt, max_len, is_wide_char);
+  js_leave_memory_account(ctx->rt, prev);
   if (unlikely(!p)) {
     JS_ThrowOutOfMemory(ctx);
     return NULL;
@@ -1227,6 +1231,66 @@ int string_buffer_concat(StringBuffer* s, const JSString* p, uint32_t from, uint
     return string_buffer_write8(s, p->u.str8 + from, to - from);
 }
 
+/* appending the JSON quoted form of p, the runs which need no escape are
+   located with the vector helpers and copied at once */
+int string_buffer_put_quoted(StringBuffer* s, const JSString* p) {
+  int i, j;
+  uint32_t c;
+  char buf[16];
+
+  if (string_buffer_putc8(s, '\"'))
+    return -1;
+  for (i = 0;;) {
+    if (p->is_wide_char)
+      j = i + js_simd_json_escape16(p->u.str16 + i, p->len - i);
+    else
+      j = i + js_simd_json_escape8(p->u.str8 + i, p->len - i);
+    if (string_buffer_concat(s, p, i, j))
+      return -1;
+    if (j >= p->len)
+      break;
+    i = j;
+    c = string_getc(p, &i);
+    switch (c) {
+      case '\t':
+        c = 't';
+        goto quote;
+      case '\r':
+        c = 'r';
+        goto quote;
+      case '\n':
+        c = 'n';
+        goto quote;
+      case '\b':
+        c = 'b';
+        goto quote;
+      case '\f':
+        c = 'f';
+        goto quote;
+      case '\"':
+      case '\\':
+      quote:
+        if (string_buffer_putc8(s, '\\'))
+          return -1;
+        if (string_buffer_putc8(s, c))
+          return -1;
+        break;
+      default:
+        /* lone surrogates and control characters, pairs are kept */
+        if (c < 32 || (c >= 0xd800 && c < 0xe000)) {
+          snprintf(buf, sizeof(buf), "\\u%04x", c);
+          if (string_buffer_puts8(s, buf))
+            return -1;
+        } else {
+          if (string_buffer_putc(s, c))
+            return -1;
+        }
+        break;
+    }
+  }
+  return string_buffer_putc8(s, '\"');
+}
+
 int string_buffer_concat_value(StringBuffer* s, JSValueConst v) {
   JSString* p;
   JSValue v1;
@@ -1373,64 +1437,31 @@ JSValue js_sub_string(JSContext* ctx, JSString* p, int start, int end) {
   }
 }
 
-/* create a string from a UTF-8 buffer */
+/* create a string from a UTF-8 buffer. Encoded surrogates are kept,
+   other ill-formed sequences are replaced with U+FFFD. */
 JSValue JS_NewStringLen(JSContext* ctx, const char* buf, size_t buf_len) {
-  const uint8_t *p, *p_end, *p_start, *p_next;
-  uint32_t c;
-  StringBuffer b_s, *b = &b_s;
-  size_t len1;
-
-  p_start = (const uint8_t*)buf;
-  p_end = p_start + buf_len;
-  p = p_start;
-  while (p < p_end && * p < 128)
-    p++;
-  len1 = p - p_start;
-  if (len1 > JS_STRING_LEN_MAX)
+  JSString* str;
+  size_t len;
+  int kind;
+
+  kind = utf8_scan((const uint8_t*)buf, buf_len, &len, 0);
+  if (len > JS_STRING_LEN_MAX)
     return JS_ThrowInternalError(ctx, "string too long");
-  if (p == p_end) {
-    /* ASCII string */
+  if (kind == UTF8_PLAIN_ASCII)
     return js_new_string8(ctx, (const uint8_t*)buf, buf_len);
+  if (!(kind & UTF8_HAS_16BIT)) {
+    str = js_alloc_string(ctx, len, 0);
+    if (!str)
+      return JS_EXCEPTION;
+    utf8_decode_buf8(str->u.str8, (const uint8_t*)buf, buf_len);
+    str->u.str8[len] = '\0';
   } else {
-    if (string_buffer_init(ctx, b, buf_len))
-      goto fail;
-    string_buffer_write8(b, p_start, len1);
-    while (p < p_end) {
-      if (*p < 128) {
-        string_buffer_putc8(b, *p++);
-      } else {
-        /* parse utf-8 sequence, return 0xFFFFFFFF for error */
-        c = unicode_from_utf8(p, p_end - p, &p_next);
-        if (c < 0x10000) {
-          p = p_next;
-        } else if (c <= 0x10FFFF) {
-          p = p_next;
-          /* surrogate pair */
-          c -= 0x10000;
-          string_buffer_putc16(b, (c >> 10) + 0xd800);
-          c = (c & 0x3ff) + 0xdc00;
-        } else {
-          /* invalid char */
-          c = 0xfffd;
-          /* skip the invalid chars */
-          /* XXX: seems incorrect. Why not just use c = *p++; ? */
-          while (p < p_end && (*p >= 0x80 && *p < 0xc0))
-            p++;
-          if (p < p_end) {
-            p++;
-            while (p < p_end && (*p >= 0x80 && *p < 0xc0))
-              p++;
-          }
-        }
-        string_buffer_putc16(b, c);
-      }
-    }
+    str = js_alloc_string(ctx, len, 1);
+    if (!str)
+      return JS_EXCEPTION;
+    utf8_decode_buf16(str->u.str16, (const uint8_t*)buf, buf_len, 0);
   }
-  return string_buffer_end(b);
-
-fail:
-  string_buffer_free(b);
-  return JS_EXCEPTION;
+  return JS_MKPTR(JS_TAG_STRING, str);
 }
 
 JSValue JS_ConcatString3(JSContext* ctx, const char* str1, JSValue str2, const char* str3) {
@@ -1481,7 +1512,7 @@ JSValue JS_NewAtomString(JSContext* ctx, const char* str) {
 const char* JS_ToCStringLen2(JSContext* ctx, size_t* plen, JSValueConst val1, BOOL cesu8) {
   JSValue val;
   JSString *str, *str_new;
-  int pos, len, c, c1;
+  int pos, len, c;
   uint8_t* q;
 
   if (JS_VALUE_GET_TAG(val1) != JS_TAG_STRING) {
@@ -1496,69 +1527,39 @@ const char* JS_ToCStringLen2(JSContext* ctx, size_t* plen, JSValueConst val1, BO
   len = str->len;
   if (!str->is_wide_char) {
     const uint8_t* src = str->u.str8;
-    int count;
+    size_t len8 = utf8_encode_len8(src, len);
 
-    /* count the number of non-ASCII characters */
-    /* Scanning the whole string is required for ASCII strings,
-       and computing the number of non-ASCII bytes is less expensive
-       than testing each byte, hence this method is faster for ASCII
-       strings, which is the most common case.
-     */
-    count = 0;
-    for (pos = 0; pos < len; pos++) {
-      count += src[pos] >> 7;
-    }
-    if (count == 0) {
+    if (len8 == len) {
       if (plen)
         *plen = len;
       return (const char*)src;
     }
-    str_new = js_alloc_string(ctx, len + count, 0);
+    str_new = js_alloc_string(ctx, len8, 0);
     if (!str_new)
       goto fail;
-    q = str_new->u.str8;
-    for (pos = 0; pos < len; pos++) {
-      c = src[pos];
-      if (c < 0x80) {
-        *q++ = c;
-      } else {
-        *q++ = (c >> 6) | 0xc0;
-        *q++ = (c & 0x3f) | 0x80;
-      }
-    }
-  } else {
-    const uint16_t* src = str->u.str16;
+    q = str_new->u.str8 + utf8_encode_buf8(str_new->u.str8, src, len);
+  } else if (!cesu8) {
     /* Allocate 3 bytes per 16 bit code point. Surrogate pairs may
        produce 4 bytes but use 2 code points.
      */
     str_new = js_alloc_string(ctx, len * 3, 0);
+    if (!str_new)
+      goto fail;
+    /* unmatched surrogate code points are kept */
+    q = str_new->u.str8 + utf8_encode_buf16(str_new->u.str8, str->u.str16, len, 0);
+  } else {
+    const uint16_t* src = str->u.str16;
+    str_new = js_alloc_string(ctx, len * 3, 0);
     if (!str_new)
       goto fail;
     q = str_new->u.str8;
-    pos = 0;
-    while (pos < len) {
-      c = src[pos++];
-      if (c < 0x80) {
+    /* surrogate pairs are encoded as two 3 byte sequences */
+    for (pos = 0; pos < len; pos++) {
+      c = src[pos];
+      if (c < 0x80)
         *q++ = c;
-      } else {
-        if (c >= 0xd800 && c < 0xdc00) {
-          if (pos < len && !cesu8) {
-            c1 = src[pos];
-            if (c1 >= 0xdc00 && c1 < 0xe000) {
-              pos++;
-              /* surrogate pair */
-              c = (((c & 0x3ff) << 10) | (c1 & 0x3ff)) + 0x10000;
-            } else {
-              /* Keep unmatched surrogate code points */
-              /* c = 0xfffd; */ /* error */
-            }
-          } else {
-            /* Keep unmatched surrogate code points */
-            /* c = 0xfffd; */ /* error */
-          }
-        }
+      else
         q += unicode_to_utf8(q, c);
-      }
     }
   }
 
@@ -1583,49 +1584,257 @@ void JS_FreeCString(JSContext* ctx, const char* ptr) {
   JS_FreeValue(ctx, JS_MKPTR(JS_TAG_STRING, p));
 }
 
+/* Append p2 at the end of p1 when p1 is not shared and has enough
+   spare room in its allocation. */
+static BOOL js_string_append_in_place(JSContext* ctx, JSString* p1, const JSString* p2) {
+  if (p1->header.ref_count != 1 || p1->atom_type != 0 || p1->is_wide_char != p2->is_wide_char ||
+      js_malloc_usable_size(ctx, p1) < sizeof(*p1) + ((p1->len + p2->len) << p2->is_wide_char) + 1 - p1->is_wide_char)
+    return FALSE;
+  if (p1->is_wide_char) {
+    memcpy(p1->u.str16 + p1->len, p2->u.str16, p2->len << 1);
+    p1->len += p2->len;
+  } else {
+    memcpy(p1->u.str8 + p1->len, p2->u.str8, p2->len);
+    p1->len += p2->len;
+    p1->u.str8[p1->len] = '\0';
+  }
+  return TRUE;
+}
+
+BOOL js_concat_string_in_place(JSContext* ctx, JSValueConst op1, JSValueConst op2) {
+  JSStringRope* r;
+  JSString* p2;
+
+  if (JS_VALUE_GET_TAG(op2) != JS_TAG_STRING)
+    return FALSE;
+  p2 = JS_VALUE_GET_STRING(op2);
+  if (JS_VALUE_GET_TAG(op1) == JS_TAG_STRING)
+    return js_string_append_in_place(ctx, JS_VALUE_GET_STRING(op1), p2);
+  if (JS_VALUE_GET_TAG(op1) != JS_TAG_STRING_ROPE)
+    return FALSE;
+  /* extend the last leaf of an unshared rope */
+  r = JS_VALUE_GET_PTR(op1);
+  if (r->header.ref_count != 1 || r->flat || JS_VALUE_GET_TAG(r->right) != JS_TAG_STRING ||
+      r->len + p2->len > JS_STRING_LEN_MAX)
+    return FALSE;
+  if (!js_string_append_in_place(ctx, JS_VALUE_GET_STRING(r->right), p2))
+    return FALSE;
+  r->len += p2->len;
+  return TRUE;
+}
+
+static void js_string_rope_write(JSString* dst, uint32_t pos, JSValueConst val) {
+  JSStringRope* r;
+  JSString* p;
+
+  for (;;) {
+    if (JS_VALUE_GET_TAG(val) == JS_TAG_STRING_ROPE) {
+      r = JS_VALUE_GET_PTR(val);
+      if (!r->flat) {
+        /* only the right children recurse: the left spine built by
+           repeated '+=' can be arbitrarily long */
+        js_string_rope_write(dst, pos + js_string_value_len(r->left), r->right);
+        val = r->left;
+        continue;
+      }
+      p = r->flat;
+    } else {
+      p = JS_VALUE_GET_STRING(val);
+    }
+    if (dst->is_wide_char)
+      copy_str16(dst->u.str16 + pos, p, 0, p->len);
+    else
+      memcpy(dst->u.str8 + pos, p->u.str8, p->len);
+    return;
+  }
+}
+
+JSString* js_string_rope_flatten(JSContext* ctx, JSValueConst val) {
+  JSStringRope* r = JS_VALUE_GET_PTR(val);
+  JSString* p;
+
+  if (r->flat)
+    return r->flat;
+  p = js_alloc_string(ctx, r->len, r->is_wide_char);
+  if (!p)
+    return NULL;
+  js_string_rope_write(p, 0, val);
+  if (!p->is_wide_char)
+    p->u.str8[p->len] = '\0';
+  /* the rope is immutable, later readers share the flat copy */
+  JS_FreeValue(ctx, r->left);
+  JS_FreeValue(ctx, r->right);
+  r->left = JS_UNDEFINED;
+  r->right = JS_UNDEFINED;
+  r->flat = p;
+  return p;
+}
+
+JSValue js_string_flatten_free(JSContext* ctx, JSValue val) {
+  JSString* p;
+
+  if (JS_VALUE_GET_TAG(val) != JS_TAG_STRING_ROPE)
+    return val;
+  p = js_string_rope_flatten(ctx, val);
+  if (p)
+    JS_DupValue(ctx, JS_MKPTR(JS_TAG_STRING, p));
+  JS_FreeValue(ctx, val);
+  if (!p)
+    return JS_EXCEPTION;
+  return JS_MKPTR(JS_TAG_STRING, p);
+}
+
+BOOL js_string_value_eq(JSContext* ctx, JSValueConst op1, JSValueConst op2) {
+  JSString *p1, *p2;
+
+  if (js_string_value_len(op1) != js_string_value_len(op2))
+    return FALSE;
+  if (JS_VALUE_GET_PTR(op1) == JS_VALUE_GET_PTR(op2))
+    return TRUE;
+  p1 = JS_VALUE_GET_TAG(op1) == JS_TAG_STRING_ROPE ? js_string_rope_flatten(ctx, op1) : JS_VALUE_GET_STRING(op1);
+  p2 = JS_VALUE_GET_TAG(op2) == JS_TAG_STRING_ROPE ? js_string_rope_flatten(ctx, op2) : JS_VALUE_GET_STRING(op2);
+  if (!p1 || !p2) {
+    /* out of memory, the callers cannot report it */
+    JS_FreeValue(ctx, JS_GetException(ctx));
+    return FALSE;
+  }
+  return js_string_compare(ctx, p1, p2) == 0;
+}
+
+int js_string_flatten2(JSContext* ctx, JSValue* pop1, JSValue* pop2) {
+  if (likely(JS_VALUE_GET_TAG(*pop1) != JS_TAG_STRING_ROPE && JS_VALUE_GET_TAG(*pop2) != JS_TAG_STRING_ROPE))
+    return 0;
+  *pop1 = js_string_flatten_free(ctx, *pop1);
+  if (JS_IsException(*pop1)) {
+    JS_FreeValue(ctx, *pop2);
+    return -1;
+  }
+  *pop2 = js_string_flatten_free(ctx, *pop2);
+  if (JS_IsException(*pop2)) {
+    JS_FreeValue(ctx, *pop1);
+    return -1;
+  }
+  return 0;
+}
+
+void js_free_string_rope(JSRuntime* rt, JSStringRope* r) {
+  JSValue left;
+
+  for (;;) {
+    left = r->left;
+    if (r->flat)
+      js_free_string(rt, r->flat);
+    JS_FreeValueRT(rt, r->right);
+    js_free_rt(rt, r);
+    /* iterate on the left spine for the same reason as js_string_rope_write() */
+    if (JS_VALUE_GET_TAG(left) != JS_TAG_STRING_ROPE) {
+      JS_FreeValueRT(rt, left);
+      return;
+    }
+    r = JS_VALUE_GET_PTR(left);
+    if (--r->header.ref_count > 0)
+      return;
+  }
+}
+
+static inline uint32_t js_string_value_depth(JSValueConst val) {
+  if (JS_VALUE_GET_TAG(val) == JS_TAG_STRING_ROPE)
+    return ((JSStringRope*)JS_VALUE_GET_PTR(val))->depth;
+  return 0;
+}
+
+/* op1 and op2 are freed */
+static JSValue js_new_string_rope(JSContext* ctx, JSValue op1, JSValue op2) {
+  JSStringRope* r;
+  JSString *p2, *leaf;
+  uint32_t len, depth2;
+
+  len = js_string_value_len(op1) + js_string_value_len(op2);
+  if (len > JS_STRING_LEN_MAX) {
+    JS_ThrowInternalError(ctx, "string too long");
+    goto fail;
+  }
+  depth2 = js_string_value_depth(op2);
+  if (depth2 >= JS_STRING_ROPE_MAX_DEPTH) {
+    op2 = js_string_flatten_free(ctx, op2);
+    if (JS_IsException(op2))
+      goto fail;
+    depth2 = 0;
+  }
+  if (JS_VALUE_GET_TAG(op2) == JS_TAG_STRING && JS_VALUE_GET_STRING(op2)->len < JS_STRING_ROPE_LEAF_LEN) {
+    /* give short leaves some room so that the next appends to the
+       rope are done in place, see js_concat_string_in_place() */
+    p2 = JS_VALUE_GET_STRING(op2);
+    leaf = js_alloc_string(ctx, JS_STRING_ROPE_LEAF_LEN, p2->is_wide_char);
+    if (!leaf)
+      goto fail;
+    leaf->len = p2->len;
+    if (p2->is_wide_char) {
+      memcpy(leaf->u.str16, p2->u.str16, p2->len << 1);
+    } else {
+      memcpy(leaf->u.str8, p2->u.str8, p2->len);
+      leaf->u.str8[p2->len] = '\0';
+    }
+    JS_FreeValue(ctx, op2);
+    op2 = JS_MKPTR(JS_TAG_STRING, leaf);
+  }
+  r = js_malloc(ctx, sizeof(*r));
+  if (!r)
+    goto fail;
+  r->header.ref_count = 1;
+  r->len = len;
+  r->is_wide_char = js_string_value_is_wide_char(op1) | js_string_value_is_wide_char(op2);
+  r->depth = max_uint32(js_string_value_depth(op1), depth2 + 1);
+  r->left = op1;
+  r->right = op2;
+  r->flat = NULL;
+  return JS_MKPTR(JS_TAG_STRING_ROPE, r);
+fail:
+  JS_FreeValue(ctx, op1);
+  JS_FreeValue(ctx, op2);
+  return JS_EXCEPTION;
+}
+
 /* op1 and op2 are converted to strings. For convience, op1 or op2 =
    JS_EXCEPTION are accepted and return JS_EXCEPTION.  */
 JSValue JS_ConcatString(JSContext* ctx, JSValue op1, JSValue op2) {
   JSValue ret;
   JSString *p1, *p2;
 
-  if (unlikely(JS_VALUE_GET_TAG(op1) != JS_TAG_STRING)) {
+  if (unlikely(!JS_IsString(op1))) {
     op1 = JS_ToStringFree(ctx, op1);
     if (JS_IsException(op1)) {
       JS_FreeValue(ctx, op2);
       return JS_EXCEPTION;
     }
   }
-  if (unlikely(JS_VALUE_GET_TAG(op2) != JS_TAG_STRING)) {
+  if (unlikely(!JS_IsString(op2))) {
     op2 = JS_ToStringFree(ctx, op2);
     if (JS_IsException(op2)) {
       JS_FreeValue(ctx, op1);
       return JS_EXCEPTION;
     }
   }
-  p1 = JS_VALUE_GET_STRING(op1);
-  p2 = JS_VALUE_GET_STRING(op2);
 
-  /* XXX: could also check if p1 is empty */
-  if (p2->len == 0) {
+  if (js_string_value_len(op2) == 0)
     goto ret_op1;
+  if (js_string_value_len(op1) == 0) {
+    JS_FreeValue(ctx, op1);
+    return op2;
   }
-  if (p1->header.ref_count == 1 && p1->is_wide_char == p2->is_wide_char && js_malloc_usable_size(ctx, p1) >= sizeof(*p1) + ((p1->len + p2->len) << p2->is_wide_char) + 1 - p1->is_wide_char) {
-    /* Concatenate in place in available space at the end of p1 */
-    if (p1->is_wide_char) {
-      memcpy(p1->u.str16 + p1->len, p2->u.str16, p2->len << 1);
-      p1->len += p2->len;
-    } else {
-      memcpy(p1->u.str8 + p1->len, p2->u.str8, p2->len);
-      p1->len += p2->len;
-      p1->u.str8[p1->len] = '\0';
-    }
-  ret_op1:
-    JS_FreeValue(ctx, op2);
-    return op1;
-  }
+  if (js_concat_string_in_place(ctx, op1, op2))
+    goto ret_op1;
+  if (JS_VALUE_GET_TAG(op1) == JS_TAG_STRING_ROPE || JS_VALUE_GET_TAG(op2) == JS_TAG_STRING_ROPE ||
+      js_string_value_len(op1) + js_string_value_len(op2) >= JS_STRING_ROPE_MIN_LEN)
+    return js_new_string_rope(ctx, op1, op2);
+
+  p1 = JS_VALUE_GET_STRING(op1);
+  p2 = JS_VALUE_GET_STRING(op2);
   ret = JS_ConcatString1(ctx, p1, p2);
   JS_FreeValue(ctx, op1);
   JS_FreeValue(ctx, op2);
   return ret;
+ret_op1:
+  JS_FreeValue(ctx, op2);
+  return op1;
 }
\ No newline at end of file
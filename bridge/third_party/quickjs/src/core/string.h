@@ -219,6 +219,7 @@ int string_buffer_write16(StringBuffer* s, const uint16_t* p, int len);
 /* appending an ASCII string */
 int string_buffer_puts8(StringBuffer* s, const char* str);
 int string_buffer_concat(StringBuffer* s, const JSString* p, uint32_t from, uint32_t to);
+int string_buffer_put_quoted(StringBuffer* s, const JSString* p);
 int string_buffer_concat_value(StringBuffer* s, JSValueConst v);
 int string_buffer_concat_value_free(StringBuffer* s, JSValue v);
 int string_buffer_fill(StringBuffer* s, int c, int count);
@@ -233,6 +234,43 @@ JSValue JS_ConcatString3(JSContext* ctx, const char* str1, JSValue str2, const c
    JS_EXCEPTION are accepted and return JS_EXCEPTION.  */
 JSValue JS_ConcatString(JSContext* ctx, JSValue op1, JSValue op2);
 
+/* Concatenations shorter than this are copied, longer ones make a rope */
+#define JS_STRING_ROPE_MIN_LEN 256
+/* Capacity of the short leaves appended to a rope */
+#define JS_STRING_ROPE_LEAF_LEN 256
+/* A right operand nested deeper than this is flattened first */
+#define JS_STRING_ROPE_MAX_DEPTH 64
+
+static inline BOOL tag_is_string(uint32_t tag) {
+  return tag == JS_TAG_STRING || tag == JS_TAG_STRING_ROPE;
+}
+/* 'val' is a JS_TAG_STRING or JS_TAG_STRING_ROPE value */
+static inline uint32_t js_string_value_len(JSValueConst val) {
+  if (JS_VALUE_GET_TAG(val) == JS_TAG_STRING_ROPE)
+    return ((JSStringRope*)JS_VALUE_GET_PTR(val))->len;
+  return JS_VALUE_GET_STRING(val)->len;
+}
+static inline int js_string_value_is_wide_char(JSValueConst val) {
+  if (JS_VALUE_GET_TAG(val) == JS_TAG_STRING_ROPE)
+    return ((JSStringRope*)JS_VALUE_GET_PTR(val))->is_wide_char;
+  return JS_VALUE_GET_STRING(val)->is_wide_char;
+}
+/* Append op2 to op1 if op1 is not shared and can hold it without
+   reallocation. Return TRUE if done, op2 is never freed. */
+BOOL js_concat_string_in_place(JSContext* ctx, JSValueConst op1, JSValueConst op2);
+/* Return the flat string of a rope, computed on first use. NULL if
+   exception. The result is owned by the rope. */
+JSString* js_string_rope_flatten(JSContext* ctx, JSValueConst val);
+/* Replace a rope by its flat string, other values are returned
+   unchanged. 'val' is freed. */
+JSValue js_string_flatten_free(JSContext* ctx, JSValue val);
+/* Equality of two strings or ropes, for the callers which cannot fail */
+BOOL js_string_value_eq(JSContext* ctx, JSValueConst op1, JSValueConst op2);
+/* js_string_flatten_free() on both operands of an operator. Return -1
+   with both operands freed if exception. */
+int js_string_flatten2(JSContext* ctx, JSValue* pop1, JSValue* pop2);
+void js_free_string_rope(JSRuntime* rt, JSStringRope* r);
+
 /* return a string atom containing name concatenated with str1 */
 JSAtom js_atom_concat_str(JSContext* ctx, JSAtom name, const char* str1);
 JSAtom js_atom_concat_num(JSContext* ctx, JSAtom name, uint32_t n);
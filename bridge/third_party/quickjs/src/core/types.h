@@ -162,6 +162,22 @@ typedef struct {
 } JSNumericOperations;
 #endif
 
+/* Per-context allocation bookkeeping. Every block allocated by a runtime
+   created with JS_NewRuntimeWithMemoryAccounting() is prefixed with a
+   pointer to the account it was charged to, so that it can be credited back
+   when freed, whichever context or runtime frees it. */
+typedef struct JSMemoryAccount {
+    size_t malloc_size;
+    size_t malloc_count;
+    size_t soft_limit; /* 0 if no limit */
+    size_t hard_limit; /* 0 if no limit */
+    size_t gc_threshold; /* next soft limit GC trigger */
+    JSContext *ctx; /* NULL once the context has been freed */
+} JSMemoryAccount;
+
+/* keep the user pointer aligned like the underlying allocator does */
+#define JS_MEMORY_ACCOUNT_HEADER_SIZE 16
+
 typedef enum {
     JS_RUNTIME_STATE_INIT,
     JS_RUNTIME_STATE_RUNNING,
@@ -171,6 +187,10 @@ typedef enum {
 struct JSRuntime {
     JSMallocFunctions mf;
     JSMallocState malloc_state;
+    /* TRUE if every allocation is charged to a JSMemoryAccount */
+    BOOL memory_accounting : 8;
+    /* account charged by allocations without an explicit context */
+    JSMemoryAccount *current_account;
     const char *rt_info;
 
     int atom_hash_size; /* power of two */
@@ -229,6 +249,14 @@ struct JSRuntime {
     int shape_hash_size;
     int shape_hash_count; /* number of hashed shapes */
     JSShape **shape_hash;
+    struct InlineCacheStubEntry *ic_stub_cache; /* IC_STUB_CACHE_SIZE entries, allocated on first use */
+    /* compiled RegExp cache, see js-regexp.c */
+    struct list_head regexp_cache_list; /* least recently used last */
+    struct JSRegExpCacheEntry **regexp_cache_hash; /* allocated on first use */
+    uint32_t regexp_cache_count;
+    uint32_t regexp_cache_capacity;
+    uint64_t regexp_cache_hits;
+    uint64_t regexp_cache_misses;
 #ifdef CONFIG_BIGNUM
     bf_context_t bf_ctx;
     JSNumericOperations bigint_ops;
@@ -358,6 +386,8 @@ struct JSContext {
 
     JSShape *array_shape;   /* initial shape for Array objects */
 
+    JSMemoryAccount *mem_account; /* NULL if memory accounting is disabled */
+
     JSValue *class_proto;
     JSValue function_proto;
     JSValue function_ctor;
@@ -442,6 +472,21 @@ struct JSString {
     } u;
 };
 
+/* Result of a long string concatenation, the characters are only copied
+   when the string is first read (see js_string_rope_flatten()) so that
+   building a string with repeated '+' is linear. */
+typedef struct JSStringRope {
+    JSRefCountHeader header; /* must come first, 32-bit */
+    uint32_t len : 31;
+    uint8_t is_wide_char : 1;
+    /* nesting of the right children, bounds the recursion when flattening */
+    uint32_t depth;
+    JSValue left; /* JS_TAG_STRING or JS_TAG_STRING_ROPE */
+    JSValue right;
+    /* set by the first flattening, the children are released then */
+    JSString *flat;
+} JSStringRope;
+
 typedef struct JSClosureVar {
     uint8_t is_local : 1;
     uint8_t is_arg : 1;
@@ -517,6 +562,9 @@ typedef struct JSVarDef {
 #define PC2COLUMN_OP_FIRST 1
 #define PC2COLUMN_DIFF_PC_MAX ((255 - PC2COLUMN_OP_FIRST) / PC2COLUMN_RANGE)
 #define IC_CACHE_ITEM_CAPACITY 8
+/* runtime wide cache used by sites which overflowed their ring */
+#define IC_STUB_CACHE_BITS 10
+#define IC_STUB_CACHE_SIZE (1 << IC_STUB_CACHE_BITS)
 
 typedef enum JSFunctionKindEnum {
     JS_FUNC_NORMAL = 0,
@@ -547,8 +595,26 @@ typedef struct InlineCacheRingSlot {
     JSAtom atom;
     InlineCacheRingItem buffer[IC_CACHE_ITEM_CAPACITY];
     uint8_t index;
+    /* the ring overflowed: new shapes go to JSRuntime.ic_stub_cache */
+    uint8_t megamorphic;
 } InlineCacheRingSlot;
 
+/* megamorphic stub cache entry, only caches own data properties of hashed
+   shapes. The entry does not own the shape, js_free_shape0() clears it. */
+typedef struct InlineCacheStubEntry {
+    JSShape *shape;
+    JSAtom atom;
+    uint32_t prop_offset;
+} InlineCacheStubEntry;
+
+#ifdef CONFIG_IC_STATS
+typedef struct InlineCacheStats {
+    int64_t hit_count;
+    int64_t miss_count;
+    int64_t megamorphic_count;
+} InlineCacheStats;
+#endif
+
 typedef struct InlineCacheHashSlot {
     JSAtom atom;
     uint32_t index;
@@ -564,6 +630,9 @@ typedef struct InlineCache {
     InlineCacheRingSlot *cache;
     uint32_t updated_offset;
     BOOL updated;
+#ifdef CONFIG_IC_STATS
+    InlineCacheStats stats;
+#endif
 } InlineCache;
 
 typedef struct JSFunctionBytecode {
@@ -582,7 +651,11 @@ typedef struct JSFunctionBytecode {
     uint8_t has_debug : 1;
     uint8_t backtrace_barrier : 1; /* stop backtrace on this function */
     uint8_t read_only_bytecode : 1;
-    /* XXX: 4 bits available */
+    /* true if only the closure layout is known, the body is compiled from
+       debug.source on the first call and kept in cpool[0] */
+    uint8_t is_lazy : 1;
+    uint8_t is_lazy_func_expr : 1;
+    /* XXX: 2 bits available */
     uint8_t *byte_code_buf; /* (self pointer) */
     int byte_code_len;
     JSAtom func_name;
@@ -841,6 +914,8 @@ struct JSShape {
        <= n <= 2^31-1. If false, the shape is guaranteed not to have
        small array index properties */
     uint8_t has_small_array_index;
+    /* true if the shape may be referenced by JSRuntime.ic_stub_cache */
+    uint8_t in_ic_stub_cache;
     uint32_t hash; /* current hash value */
     uint32_t prop_hash_mask;
     int prop_size; /* allocated properties */
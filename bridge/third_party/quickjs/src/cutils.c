@@ -28,6 +28,7 @@
 #include <string.h>
 
 #include "quickjs/cutils.h"
+#include "core/simd.h"
 
 void pstrcpy(char *buf, int buf_size, const char *str)
 {
@@ -319,6 +320,457 @@ int utf8_str_len(const uint8_t *p_start, const uint8_t *p_end) {
     return count;
 }
 
+/* Decode the UTF-8 sequence starting with the non ASCII byte p[0].
+   Return the code point, or -1 if the sequence is ill-formed, in which
+   case *pp points after its maximal subpart. */
+static force_inline int utf8_decode_seq(const uint8_t *p, const uint8_t *end,
+                           const uint8_t **pp, int flags)
+{
+    int c, n, lo, hi;
+
+    c = *p;
+    /* fast path for the well-formed 2 and 3 byte sequences */
+    if (c >= 0xc2 && c <= 0xdf) {
+        if (end - p >= 2 && (p[1] & 0xc0) == 0x80) {
+            *pp = p + 2;
+            return ((c & 0x1f) << 6) | (p[1] & 0x3f);
+        }
+    } else if (c >= 0xe1 && c <= 0xec) {
+        if (end - p >= 3 && (p[1] & 0xc0) == 0x80 && (p[2] & 0xc0) == 0x80) {
+            *pp = p + 3;
+            return ((c & 0x0f) << 12) | ((p[1] & 0x3f) << 6) | (p[2] & 0x3f);
+        }
+    }
+    p++;
+    lo = 0x80;
+    hi = 0xbf;
+    if (c >= 0xc2 && c <= 0xdf) {
+        n = 1;
+        c &= 0x1f;
+    } else if (c >= 0xe0 && c <= 0xef) {
+        n = 2;
+        if (c == 0xe0)
+            lo = 0xa0;
+        else if (c == 0xed && (flags & UTF8_STRICT))
+            hi = 0x9f;
+        c &= 0x0f;
+    } else if (c >= 0xf0 && c <= 0xf4) {
+        n = 3;
+        if (c == 0xf0)
+            lo = 0x90;
+        else if (c == 0xf4)
+            hi = 0x8f;
+        c &= 0x07;
+    } else {
+        *pp = p;
+        return -1;
+    }
+    while (n-- > 0) {
+        if (p >= end || *p < lo || *p > hi) {
+            *pp = p;
+            return -1;
+        }
+        c = (c << 6) | (*p++ & 0x3f);
+        lo = 0x80;
+        hi = 0xbf;
+    }
+    *pp = p;
+    return c;
+}
+
+int utf8_scan(const uint8_t *src, size_t len, size_t *plen16, int flags)
+{
+    const uint8_t *p = src, *end = src + len;
+    size_t len16 = 0, n;
+    int kind = UTF8_PLAIN_ASCII, c;
+
+    while (p < end) {
+        if (*p < 0x80) {
+            if (end - p < 4 || (p[1] | p[2] | p[3]) >= 0x80) {
+                p++;
+                len16++;
+                continue;
+            }
+            n = js_simd_ascii_len8(p, end - p);
+            p += n;
+            len16 += n;
+            continue;
+        }
+        kind |= UTF8_NON_ASCII;
+        c = utf8_decode_seq(p, end, &p, flags);
+        if (c < 0) {
+            kind |= UTF8_HAS_ERRORS | UTF8_HAS_16BIT;
+            len16++;
+        } else if (c > 0xffff) {
+            kind |= UTF8_HAS_16BIT;
+            len16 += 2;
+        } else {
+            if (c > 0xff)
+                kind |= UTF8_HAS_16BIT;
+            len16++;
+        }
+    }
+    *plen16 = len16;
+    return kind;
+}
+
+size_t utf8_decode_buf8(uint8_t *dst, const uint8_t *src, size_t len)
+{
+    const uint8_t *p = src, *end = src + len;
+    uint8_t *q = dst;
+    size_t n;
+
+    while (p < end) {
+        if (*p < 0x80) {
+            n = js_simd_ascii_len8(p, end - p);
+            memcpy(q, p, n);
+            p += n;
+            q += n;
+        } else {
+            /* only 2 byte sequences encode Latin-1 */
+            *q++ = ((p[0] & 0x1f) << 6) | (p[1] & 0x3f);
+            p += 2;
+        }
+    }
+    return q - dst;
+}
+
+size_t utf8_decode_buf16(uint16_t *dst, const uint8_t *src, size_t len, int flags)
+{
+    const uint8_t *p = src, *end = src + len;
+    uint16_t *q = dst;
+    size_t n;
+    int c;
+
+    while (p < end) {
+        if (*p < 0x80) {
+            /* short runs, such as the spaces between words of CJK text,
+               are not worth the SIMD setup */
+            if (end - p < 4 || (p[1] | p[2] | p[3]) >= 0x80) {
+                *q++ = *p++;
+                continue;
+            }
+            n = js_simd_ascii_len8(p, end - p);
+            js_simd_widen8(q, p, n);
+            p += n;
+            q += n;
+            continue;
+        }
+        c = utf8_decode_seq(p, end, &p, flags);
+        if (c < 0) {
+            *q++ = 0xfffd;
+        } else if (c > 0xffff) {
+            c -= 0x10000;
+            *q++ = 0xd800 | (c >> 10);
+            *q++ = 0xdc00 | (c & 0x3ff);
+        } else {
+            *q++ = c;
+        }
+    }
+    return q - dst;
+}
+
+size_t utf8_encode_len8(const uint8_t *src, size_t len)
+{
+    size_t i = 0, n = len;
+
+    for (;;) {
+        i += js_simd_ascii_len8(src + i, len - i);
+        if (i >= len)
+            break;
+        n++;
+        i++;
+    }
+    return n;
+}
+
+size_t utf8_encode_buf8(uint8_t *dst, const uint8_t *src, size_t len)
+{
+    uint8_t *q = dst;
+    size_t i = 0, n;
+    int c;
+
+    while (i < len) {
+        n = js_simd_ascii_len8(src + i, len - i);
+        memcpy(q, src + i, n);
+        q += n;
+        i += n;
+        if (i >= len)
+            break;
+        c = src[i++];
+        *q++ = (c >> 6) | 0xc0;
+        *q++ = (c & 0x3f) | 0x80;
+    }
+    return q - dst;
+}
+
+size_t utf8_encode_len16(const uint16_t *src, size_t len)
+{
+    size_t i = 0, n = 0, k;
+    int c;
+
+    while (i < len) {
+        c = src[i];
+        if (c < 0x80) {
+            k = js_simd_prefix_len16(src + i, len - i, 0xff80);
+            i += k;
+            n += k;
+            continue;
+        }
+        i++;
+        if (c < 0x800) {
+            n += 2;
+        } else if (c >= 0xd800 && c < 0xdc00 && i < len &&
+                   src[i] >= 0xdc00 && src[i] < 0xe000) {
+            i++;
+            n += 4;
+        } else {
+            n += 3;
+        }
+    }
+    return n;
+}
+
+size_t utf8_encode_buf16(uint8_t *dst, const uint16_t *src, size_t len, int flags)
+{
+    uint8_t *q = dst;
+    size_t i = 0, k;
+    int c;
+
+    while (i < len) {
+        c = src[i];
+        if (c < 0x80) {
+            k = js_simd_prefix_len16(src + i, len - i, 0xff80);
+            js_simd_narrow16(q, src + i, k);
+            i += k;
+            q += k;
+            continue;
+        }
+        i++;
+        if (c < 0x800) {
+            *q++ = (c >> 6) | 0xc0;
+            *q++ = (c & 0x3f) | 0x80;
+            continue;
+        }
+        if (c >= 0xd800 && c < 0xe000) {
+            if (c < 0xdc00 && i < len && src[i] >= 0xdc00 && src[i] < 0xe000) {
+                c = (((c & 0x3ff) << 10) | (src[i++] & 0x3ff)) + 0x10000;
+                *q++ = (c >> 18) | 0xf0;
+                *q++ = ((c >> 12) & 0x3f) | 0x80;
+                *q++ = ((c >> 6) & 0x3f) | 0x80;
+                *q++ = (c & 0x3f) | 0x80;
+                continue;
+            }
+            if (flags & UTF8_STRICT)
+                c = 0xfffd;
+        }
+        *q++ = (c >> 12) | 0xe0;
+        *q++ = ((c >> 6) & 0x3f) | 0x80;
+        *q++ = (c & 0x3f) | 0x80;
+    }
+    return q - dst;
+}
+
+size_t utf8_encode_buf8_partial(uint8_t *dst, size_t dst_len,
+                                const uint8_t *src, size_t len, size_t *pread)
+{
+    uint8_t *q = dst, *q_end = dst + dst_len;
+    size_t i = 0, n;
+    int c;
+
+    while (i < len) {
+        n = len - i;
+        if (n > (size_t)(q_end - q))
+            n = q_end - q;
+        n = js_simd_ascii_len8(src + i, n);
+        memcpy(q, src + i, n);
+        q += n;
+        i += n;
+        /* src[i] is not ASCII unless the output is full */
+        if (i >= len || q_end - q < 2)
+            break;
+        c = src[i++];
+        *q++ = (c >> 6) | 0xc0;
+        *q++ = (c & 0x3f) | 0x80;
+    }
+    *pread = i;
+    return q - dst;
+}
+
+size_t utf8_encode_buf16_partial(uint8_t *dst, size_t dst_len,
+                                 const uint16_t *src, size_t len,
+                                 size_t *pread, int flags)
+{
+    uint8_t *q = dst, *q_end = dst + dst_len;
+    size_t i = 0, k;
+    int c;
+
+    while (i < len && q < q_end) {
+        c = src[i];
+        if (c < 0x80) {
+            k = len - i;
+            if (k > (size_t)(q_end - q))
+                k = q_end - q;
+            k = js_simd_prefix_len16(src + i, k, 0xff80);
+            js_simd_narrow16(q, src + i, k);
+            i += k;
+            q += k;
+            continue;
+        }
+        if (c < 0x800) {
+            if (q_end - q < 2)
+                break;
+            i++;
+            *q++ = (c >> 6) | 0xc0;
+            *q++ = (c & 0x3f) | 0x80;
+            continue;
+        }
+        if (c >= 0xd800 && c < 0xe000) {
+            if (c < 0xdc00 && i + 1 < len && src[i + 1] >= 0xdc00 && src[i + 1] < 0xe000) {
+                if (q_end - q < 4)
+                    break;
+                c = (((c & 0x3ff) << 10) | (src[i + 1] & 0x3ff)) + 0x10000;
+                i += 2;
+                *q++ = (c >> 18) | 0xf0;
+                *q++ = ((c >> 12) & 0x3f) | 0x80;
+                *q++ = ((c >> 6) & 0x3f) | 0x80;
+                *q++ = (c & 0x3f) | 0x80;
+                continue;
+            }
+            if (flags & UTF8_STRICT)
+                c = 0xfffd;
+        }
+        if (q_end - q < 3)
+            break;
+        i++;
+        *q++ = (c >> 12) | 0xe0;
+        *q++ = ((c >> 6) & 0x3f) | 0x80;
+        *q++ = (c & 0x3f) | 0x80;
+    }
+    *pread = i;
+    return q - dst;
+}
+
+size_t utf16_latin1_len(const uint16_t *src, size_t len)
+{
+    return js_simd_prefix_len16(src, len, 0xff00);
+}
+
+void latin1_to_utf16(uint16_t *dst, const uint8_t *src, size_t len)
+{
+    js_simd_widen8(dst, src, len);
+}
+
+void utf16_to_latin1(uint8_t *dst, const uint16_t *src, size_t len)
+{
+    js_simd_narrow16(dst, src, len);
+}
+
+/* base64 */
+
+static const char b64_chars[64] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/* 64 for '=', 65 for ASCII whitespace and 0xff for the other characters
+   out of the alphabet */
+static const uint8_t b64_values[256] = {
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 65,   65,   0xff, 65,   65,   0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    65,   0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 62,   0xff, 0xff, 0xff, 63,
+    52,   53,   54,   55,   56,   57,   58,   59,   60,   61,   0xff, 0xff, 0xff, 64,   0xff, 0xff,
+    0xff, 0,    1,    2,    3,    4,    5,    6,    7,    8,    9,    10,   11,   12,   13,   14,
+    15,   16,   17,   18,   19,   20,   21,   22,   23,   24,   25,   0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 26,   27,   28,   29,   30,   31,   32,   33,   34,   35,   36,   37,   38,   39,   40,
+    41,   42,   43,   44,   45,   46,   47,   48,   49,   50,   51,   0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+size_t b64_encode(uint8_t *dst, const uint8_t *src, size_t len)
+{
+    size_t i = js_simd_b64_encode(dst, src, len);
+    uint8_t *q = dst + i / 3 * 4;
+    uint32_t n;
+
+    for (; i + 3 <= len; i += 3) {
+        n = (src[i] << 16) | (src[i + 1] << 8) | src[i + 2];
+        *q++ = b64_chars[n >> 18];
+        *q++ = b64_chars[(n >> 12) & 0x3f];
+        *q++ = b64_chars[(n >> 6) & 0x3f];
+        *q++ = b64_chars[n & 0x3f];
+    }
+    if (i < len) {
+        n = src[i] << 16;
+        if (i + 1 < len)
+            n |= src[i + 1] << 8;
+        *q++ = b64_chars[n >> 18];
+        *q++ = b64_chars[(n >> 12) & 0x3f];
+        *q++ = i + 1 < len ? b64_chars[(n >> 6) & 0x3f] : '=';
+        *q++ = '=';
+    }
+    return q - dst;
+}
+
+size_t b64_decode(uint8_t *dst, const uint8_t *src, size_t len)
+{
+    uint8_t *q = dst;
+    size_t i = 0;
+    uint32_t n = 0;
+    int count = 0, pad = 0, v;
+
+    for (;;) {
+        if (count == 0) {
+            size_t k = js_simd_b64_decode(q, src + i, len - i);
+            q += k / 4 * 3;
+            i += k;
+        }
+        if (i >= len)
+            break;
+        v = b64_values[src[i++]];
+        if (v < 64) {
+            n = (n << 6) | v;
+            if (++count == 4) {
+                *q++ = n >> 16;
+                *q++ = n >> 8;
+                *q++ = n;
+                n = 0;
+                count = 0;
+            }
+        } else if (v == 64) {
+            /* only padding and whitespace may follow */
+            pad = 1;
+            for (; i < len; i++) {
+                v = b64_values[src[i]];
+                if (v == 64)
+                    pad++;
+                else if (v != 65)
+                    return B64_ERROR;
+            }
+            break;
+        } else if (v != 65) {
+            return B64_ERROR;
+        }
+    }
+    /* the padding completes the last group, or is absent */
+    if (pad && (pad > 2 || count + pad != 4))
+        return B64_ERROR;
+    if (count == 1)
+        return B64_ERROR;
+    if (count == 2) {
+        *q++ = n >> 4;
+    } else if (count == 3) {
+        *q++ = n >> 10;
+        *q++ = n >> 2;
+    }
+    return q - dst;
+}
+
 #if 0
 
 #if defined(EMSCRIPTEN) || defined(__ANDROID__)
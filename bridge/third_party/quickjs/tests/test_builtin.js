@@ -193,6 +193,26 @@ function test_array()
         err = true;
     }
     assert(err && a.toString() === "1,2,3,4");
+
+    a = [10, 9, 1, -5, -10, 100, 0, -2147483648, 2147483647];
+    a.sort();
+    assert(a.join(), "-10,-2147483648,-5,0,1,10,100,2147483647,9", "sort");
+    a = [3, 1.5, 2];
+    a.sort();
+    assert(a.join(), "1.5,2,3", "sort");
+
+    a = [1, 2.5, NaN, -0, {}, "3"];
+    assert(a.indexOf(2.5), 1);
+    assert(a.indexOf(0), 3);
+    assert(a.indexOf(NaN), -1);
+    assert(a.includes(NaN), true);
+    assert(a.indexOf(a[4]), 4);
+    assert(a.indexOf(3), -1);
+    assert(a.includes("3"), true);
+
+    a = [1, 2, 3, 4];
+    a.fill(0, 1, 3);
+    assert(a.join(), "1,0,0,4", "fill");
 }
 
 function test_string()
@@ -299,11 +319,56 @@ function test_string()
     assert("aaaa".split("aaaaa", 0), [  ]);
     assert("aaaa".split("aaaaa", 1), [ "aaaa" ]);
 
+    /* long and periodic patterns */
+    a = "a".repeat(1000);
+    assert(a.indexOf("a".repeat(100) + "b"), -1);
+    assert((a + "b").indexOf("a".repeat(100) + "b"), 900);
+    assert(("ab".repeat(100) + "abc").indexOf("ababc"), 198);
+    assert(("中".repeat(100) + "文").indexOf("中中文"), 98);
+    assert(("x中".repeat(20) + "xy").includes("xy"), true);
+    assert("a-b--c".split("--"), [ "a-b", "c" ]);
+    assert("a.b.c".replaceAll(".", "$$"), "a$b$c");
+    assert("a.b.c".replaceAll(".", "::"), "a::b::c");
+    assert("a.b.c".replace(".", "<$&>"), "a<.>b.c");
+
     assert(eval('"\0"'), "\0");
 
     assert("abc".padStart(Infinity, ""), "abc");
 }
 
+function test_string_rope()
+{
+    var a, b, c, i, m;
+
+    /* long concatenations are kept as ropes until they are read */
+    a = "";
+    for(i = 0; i < 1000; i++)
+        a += "ab";
+    assert(a.length, 2000);
+    assert(a[1999], "b");
+    assert(a === "ab".repeat(1000), true);
+
+    b = "";
+    for(i = 0; i < 1000; i++)
+        b = "x" + b + "y";
+    assert(b.length, 2000);
+    assert(b.indexOf("y"), 1000);
+    assert(typeof b, "string");
+
+    /* appending in place must not change the other references */
+    c = a;
+    a += "c";
+    assert(c.length, 2000);
+    assert(a.length, 2001);
+
+    m = new Map();
+    m.set(c, 1);
+    assert(m.get("ab".repeat(1000)), 1);
+    assert(JSON.parse(JSON.stringify({ v: b })).v, b);
+    assert(+("0".repeat(300) + "7"), 7);
+    assert(("\u4e00".repeat(200) + "a".repeat(100))[299], "a");
+}
+
 function test_math()
 {
     var a;
@@ -452,6 +517,41 @@ function test_typed_array()
     assert(a.toString(), "1,2,3,4");
     a.set([10, 11], 2);
     assert(a.toString(), "1,2,10,11");
+
+    a = new Float64Array(3);
+    a.set(new Int16Array([-1, 2]), 1);
+    assert(a.toString(), "0,-1,2");
+    a = new Uint8ClampedArray(3);
+    a.set(new Int32Array([-5, 300, 7]));
+    assert(a.toString(), "0,255,7");
+
+    a = new Int32Array(100);
+    for(i = 0; i < a.length; i++)
+        a[i] = (i * 37) % 100 - 50;
+    a.sort();
+    for(i = 1; i < a.length; i++)
+        assert(a[i - 1] <= a[i], true, "sort");
+    a = new Float64Array(100);
+    a[0] = NaN;
+    a[1] = -0;
+    a[2] = -Infinity;
+    a[99] = -1;
+    a.sort();
+    assert(a[0], -Infinity);
+    assert(a[1], -1);
+    assert(Object.is(a[2], -0), true);
+    assert(Object.is(a[3], 0), true);
+    assert(isNaN(a[99]), true);
+
+    a = new Uint16Array(100);
+    a.fill(0x1234, 1, 99);
+    assert(a[0] === 0 && a[1] === 0x1234 && a[98] === 0x1234 && a[99] === 0, true, "fill");
+    assert(a.indexOf(0x1234), 1);
+    assert(a.lastIndexOf(0x1234), 98);
+    a = new Float32Array([1, 2, NaN, 0.5]);
+    assert(a.indexOf(0.5), 3);
+    assert(a.indexOf(NaN), -1);
+    assert(a.includes(NaN), true);
 }
 
 function test_json()
@@ -477,6 +577,21 @@ function test_json()
   3
  ]
 ]`);
+
+    /* escapes on both sides of the vectorized runs */
+    s = "0123456789abcdef\"0123456789abcdef\\\n\u0001\ud800\ud83d\ude00\u4e00";
+    assert(JSON.stringify(s),
+           '"0123456789abcdef\\"0123456789abcdef\\\\\\n\\u0001\\ud800\ud83d\ude00\u4e00"');
+    assert(JSON.parse(JSON.stringify(s)), s);
+    assert(JSON.parse('  \t  {  "0123456789abcdefgh" :  "0123456789abcdefgh\\t" }  ')["0123456789abcdefgh"],
+           "0123456789abcdefgh\t");
+
+    /* objects sharing a shape, changed while being serialized */
+    a = [{x:1, y:2}, {x:3, y:4}];
+    Object.defineProperty(a[1], "y", { enumerable: false });
+    assert(JSON.stringify(a), '[{"x":1,"y":2},{"x":3}]');
+    a = { x: { toJSON: function() { delete a.y; return 0; } }, y: 1, z: 2 };
+    assert(JSON.stringify(a), '{"x":0,"z":2}');
 }
 
 function test_date()
@@ -672,6 +787,7 @@ test_function();
 test_enum();
 test_array();
 test_string();
+test_string_rope();
 test_math();
 test_number();
 test_eval();
@@ -134,9 +134,22 @@ void evaluateScripts(void* page_,
 #endif
   auto page = reinterpret_cast<webf::WebFPage*>(page_);
   Dart_PersistentHandle persistent_handle = Dart_NewPersistentHandle_DL(dart_handle);
-  page->executingContext()->dartIsolateContext()->dispatcher()->PostToJs(
-      page->isDedicated(), page->contextId(), webf::evaluateScriptsInternal, page_, code, code_len, parsed_bytecodes,
-      bytecode_len, bundleFilename, startLine, persistent_handle, result_callback);
+  auto* dart_isolate_context = page->executingContext()->dartIsolateContext();
+  if (!page->isDedicated()) {
+    dart_isolate_context->dispatcher()->PostToJs(page->isDedicated(), page->contextId(), webf::evaluateScriptsInternal,
+                                                 page_, code, code_len, parsed_bytecodes, bytecode_len, bundleFilename,
+                                                 startLine, persistent_handle, result_callback);
+    return;
+  }
+
+  // Parse on a helper thread while the JS thread of the page runs the tasks queued before the script. The script is
+  // still evaluated in the order it was posted, relative to the other scripts and tasks of the page.
+  std::shared_ptr<webf::ScriptCompileJob> job =
+      dart_isolate_context->scriptCompiler()->Compile(code, code_len, bundleFilename);
+  dart_isolate_context->dispatcher()->PostToJs(page->isDedicated(), page->contextId(),
+                                               webf::evaluateCompiledScriptInternal, page_, job, code, code_len,
+                                               parsed_bytecodes, bytecode_len, bundleFilename, startLine,
+                                               persistent_handle, result_callback);
 }
 
 void evaluateQuickjsByteCode(void* page_,
@@ -163,6 +176,31 @@ void parseHTML(void* page_, const char* code, int32_t length) {
                                                                          webf::parseHTMLInternal, page_, code, length);
 }
 
+void getPageMemoryUsage(void* page_, NativePageMemoryUsage* usage) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  // The counters are written by the JS thread of the page, read them there.
+  page->dartIsolateContext()->dispatcher()->PostToJsSync(
+      page->isDedicated(), page->contextId(),
+      [](bool cancel, void* page, NativePageMemoryUsage* usage) {
+        if (cancel)
+          return;
+        webf::getPageMemoryUsageInternal(page, usage);
+      },
+      page_, usage);
+}
+
+void setPageMemoryLimit(void* page_, int64_t soft_limit, int64_t hard_limit) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  page->dartIsolateContext()->dispatcher()->PostToJs(page->isDedicated(), page->contextId(),
+                                                     webf::setPageMemoryLimitInternal, page_, soft_limit, hard_limit);
+}
+
+void setPageLazyFunctionCompilation(void* page_, int8_t enabled) {
+  auto page = reinterpret_cast<webf::WebFPage*>(page_);
+  page->dartIsolateContext()->dispatcher()->PostToJs(page->isDedicated(), page->contextId(),
+                                                     webf::setPageLazyFunctionCompilationInternal, page_, enabled);
+}
+
 void registerPluginByteCode(uint8_t* bytes, int32_t length, const char* pluginName) {
   webf::ExecutingContext::plugin_byte_code[pluginName] = webf::NativeByteCode{bytes, length};
 }
@@ -0,0 +1,53 @@
+describe('TextDecoder', () => {
+  const bytes = (...values: number[]) => new Uint8Array(values);
+
+  it('decode', () => {
+    const decoder = new TextDecoder();
+    expect(decoder.encoding).toBe('utf-8');
+    expect(decoder.fatal).toBeFalse();
+    expect(decoder.ignoreBOM).toBeFalse();
+    expect(decoder.decode()).toBe('');
+    expect(decoder.decode(bytes(0x61, 0xc3, 0xa9, 0xe4, 0xb8, 0x96, 0xf0, 0x9f, 0x98, 0x80))).toBe('aé世😀');
+    expect(decoder.decode(bytes(0x61, 0xc3, 0xa9).buffer)).toBe('aé');
+    expect(decoder.decode(new DataView(bytes(0x78, 0x61, 0x79).buffer, 1, 1))).toBe('a');
+  });
+
+  it('replaces ill-formed sequences', () => {
+    const decoder = new TextDecoder();
+    expect(decoder.decode(bytes(0x61, 0xff, 0x62))).toBe('a�b');
+    expect(decoder.decode(bytes(0xed, 0xa0, 0x80))).toBe('���');
+    expect(decoder.decode(bytes(0xf0, 0x9f, 0x98))).toBe('�');
+  });
+
+  it('fatal', () => {
+    const decoder = new TextDecoder('utf-8', { fatal: true });
+    expect(decoder.fatal).toBeTrue();
+    expect(() => decoder.decode(bytes(0x61, 0xff))).toThrowError(TypeError);
+    expect(decoder.decode(bytes(0x61))).toBe('a');
+  });
+
+  it('BOM', () => {
+    expect(new TextDecoder().decode(bytes(0xef, 0xbb, 0xbf, 0x61))).toBe('a');
+    expect(new TextDecoder('utf-8', { ignoreBOM: true }).decode(bytes(0xef, 0xbb, 0xbf, 0x61))).toBe('﻿a');
+  });
+
+  it('stream', () => {
+    const decoder = new TextDecoder();
+    const data = bytes(0xef, 0xbb, 0xbf, 0xe4, 0xb8, 0x96, 0xf0, 0x9f, 0x98, 0x80, 0x21);
+    let text = '';
+    for (let i = 0; i < data.length; i++) {
+      text += decoder.decode(data.subarray(i, i + 1), { stream: true });
+    }
+    text += decoder.decode();
+    expect(text).toBe('世😀!');
+
+    // A truncated sequence at the end of the stream is replaced.
+    expect(decoder.decode(bytes(0xe4, 0xb8), { stream: true })).toBe('');
+    expect(decoder.decode()).toBe('�');
+  });
+
+  it('labels', () => {
+    expect(new TextDecoder(' UTF8 ').encoding).toBe('utf-8');
+    expect(() => new TextDecoder('latin2')).toThrowError(RangeError);
+  });
+});
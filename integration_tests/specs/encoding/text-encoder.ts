@@ -0,0 +1,32 @@
+describe('TextEncoder', () => {
+  it('encode', () => {
+    const encoder = new TextEncoder();
+    expect(encoder.encoding).toBe('utf-8');
+    expect(Array.from(encoder.encode())).toEqual([]);
+    expect(Array.from(encoder.encode('aé世😀'))).toEqual([
+      0x61, 0xc3, 0xa9, 0xe4, 0xb8, 0x96, 0xf0, 0x9f, 0x98, 0x80,
+    ]);
+    // Lone surrogates are encoded as U+FFFD.
+    expect(Array.from(encoder.encode('\ud800'))).toEqual([0xef, 0xbf, 0xbd]);
+  });
+
+  it('encodeInto writes whole code points', () => {
+    const encoder = new TextEncoder();
+    const buffer = new Uint8Array(8);
+    let result = encoder.encodeInto('aé世😀', buffer);
+    expect(result.read).toBe(3);
+    expect(result.written).toBe(6);
+    expect(Array.from(buffer.subarray(0, 6))).toEqual([0x61, 0xc3, 0xa9, 0xe4, 0xb8, 0x96]);
+
+    result = encoder.encodeInto('hi', buffer.subarray(6));
+    expect(result.read).toBe(2);
+    expect(result.written).toBe(2);
+    expect(buffer[7]).toBe(0x69);
+  });
+
+  it('encodeInto requires a Uint8Array', () => {
+    const encoder = new TextEncoder();
+    // @ts-ignore
+    expect(() => encoder.encodeInto('a', new ArrayBuffer(4))).toThrowError(TypeError);
+  });
+});
@@ -208,6 +208,25 @@ describe('URlSearchParams delete', () => {
       }
     }, );
   });
+  it('Constructor with iterables', function () {
+    var params = new URLSearchParams(new Map([['a', '1'], ['b', '2']]));
+    expect(params.toString()).toBe('a=1&b=2');
+    params = new URLSearchParams((function* () {
+      yield ['c', 'd'];
+      yield new Set(['e', 'f']);
+    })());
+    expect(params.toString()).toBe('c=d&e=f');
+    params = new URLSearchParams(new URLSearchParams('g=h').entries());
+    expect(params.get('g')).toBe('h');
+  });
+  it('Constructor with invalid pairs', function () {
+    expect(() => new URLSearchParams([['a', 'b', 'c']])).toThrowError(TypeError);
+    expect(() => new URLSearchParams(new Map([['a', 'b']]).keys())).toThrowError(TypeError);
+    expect(() => new URLSearchParams({ [Symbol.iterator]: 1 })).toThrowError(TypeError);
+    expect(() => new URLSearchParams((function* () {
+      throw new RangeError('iteration');
+    })())).toThrowError(RangeError);
+  });
   xit('Custom [Symbol.iterator]', () => {
     var params = new URLSearchParams();
     params[Symbol.iterator] = function* () {
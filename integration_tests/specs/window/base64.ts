@@ -243,4 +243,31 @@ describe('Base64', () => {
   }
 
   runAtobTests(base64Json);
-});
\ No newline at end of file
+
+  it('__webf_base64_decode__ returns the bytes decoded by atob', () => {
+    for (let i = 0; i < base64Json.length; i++) {
+      const input = base64Json[i][0] as string,
+        output = base64Json[i][1] as number[] | null;
+      if (output === null) {
+        // @ts-ignore
+        expect(() => window.__webf_base64_decode__(input)).toThrow();
+      } else {
+        // @ts-ignore
+        const result = window.__webf_base64_decode__(input);
+        expect(result instanceof Uint8Array).toBe(true);
+        expect(Array.from(result)).toEqual(output);
+      }
+    }
+  });
+
+  it('encodes and decodes large binary strings', () => {
+    let input = '';
+    for (let i = 0; i < 100000; i++) {
+      input += String.fromCharCode((i * 7) & 0xff);
+    }
+    const encoded = btoa(input);
+    expect(encoded.length).toBe(133336);
+    expect(atob(encoded)).toBe(input);
+    expect(atob(encoded.replace(/.{76}/g, '$&\n'))).toBe(input);
+  });
+});
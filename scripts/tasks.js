@@ -102,6 +102,10 @@ task('build-darwin-webf-lib', done => {
     externCmakeArgs.push('-DUSE_SYSTEM_MALLOC=true');
   }
 
+  if (process.env.ENABLE_SUPERINSTRUCTIONS === 'true') {
+    externCmakeArgs.push('-DENABLE_SUPERINSTRUCTIONS=true');
+  }
+
   // Bundle quickjs into webf.
   if (program.staticQuickjs) {
     externCmakeArgs.push('-DSTATIC_QUICKJS=true');
@@ -493,6 +497,10 @@ task('build-linux-webf-lib', (done) => {
     externCmakeArgs.push('-DUSE_SYSTEM_MALLOC=true');
   }
 
+  if (process.env.ENABLE_SUPERINSTRUCTIONS === 'true') {
+    externCmakeArgs.push('-DENABLE_SUPERINSTRUCTIONS=true');
+  }
+
   if (program.enableLog) {
     externCmakeArgs.push('-DENABLE_LOG=true');
   }
@@ -17,6 +17,10 @@ String uint16ToString(Pointer<Uint16> pointer, int length) {
   return String.fromCharCodes(pointer.asTypedList(length));
 }
 
+String latin1ToString(Pointer<Uint8> pointer, int length) {
+  return String.fromCharCodes(pointer.asTypedList(length));
+}
+
 Pointer<Uint16> _stringToUint16(String string) {
   final units = string.codeUnits;
   final Pointer<Uint16> result = malloc.allocate<Uint16>(units.length * sizeOf<Uint16>());
@@ -29,6 +33,7 @@ Pointer<NativeString> stringToNativeString(String string) {
   Pointer<NativeString> nativeString = malloc.allocate<NativeString>(sizeOf<NativeString>());
   nativeString.ref.string = _stringToUint16(string);
   nativeString.ref.length = string.length;
+  nativeString.ref.isOneByte = 0;
   return nativeString;
 }
 
@@ -59,6 +64,9 @@ double uInt64ToDouble(int value) {
 }
 
 String nativeStringToString(Pointer<NativeString> pointer) {
+  if (pointer.ref.isOneByte != 0) {
+    return latin1ToString(pointer.ref.string.cast<Uint8>(), pointer.ref.length);
+  }
   return uint16ToString(pointer.ref.string, pointer.ref.length);
 }
 
@@ -20,12 +20,33 @@ class NativeWebFInfo extends Struct {
   external Pointer<Utf8> system_name;
 }
 
+class NativePageMemoryUsage extends Struct {
+  @Int64()
+  external int malloc_size;
+
+  @Int64()
+  external int malloc_count;
+
+  @Int64()
+  external int soft_limit;
+
+  @Int64()
+  external int hard_limit;
+
+  @Int8()
+  external int soft_limit_exceeded;
+}
+
 // An native struct can be directly convert to javaScript String without any conversion cost.
 class NativeString extends Struct {
   external Pointer<Uint16> string;
 
   @Uint32()
   external int length;
+
+  // Non zero when string holds one byte (Latin-1) characters instead of UTF-16 code units.
+  @Uint32()
+  external int isOneByte;
 }
 
 // For memory compatibility between NativeEvent and other struct which inherit NativeEvent(exp: NativeTouchEvent, NativeGestureEvent),
@@ -594,9 +594,24 @@ enum UICommandType {
   // perf optimize
   createSVGElement,
   createElementNS,
+  insertAdjacentNodes,
+  removeAllChildren,
+  cloneNodes,
+  setTextData,
+  addClass,
+  removeClass,
   finishRecordingCommand,
 }
 
+// Carried in args_01_length of the insertAdjacentNode commands, keep in sync with AdjacentPosition in
+// bridge/foundation/ui_command_buffer.h.
+enum AdjacentPosition {
+  beforeBegin,
+  afterBegin,
+  beforeEnd,
+  afterEnd,
+}
+
 class UICommandItem extends Struct {
   @Int64()
   external int type;
@@ -669,6 +684,61 @@ bool isJSThreadBlocked(double contextId) {
   return _isJSThreadBlocked(dartContext!.pointer, contextId) == 1;
 }
 
+typedef NativeGetPageMemoryUsage = Void Function(Pointer<Void>, Pointer<NativePageMemoryUsage>);
+typedef DartGetPageMemoryUsage = void Function(Pointer<Void>, Pointer<NativePageMemoryUsage>);
+
+final DartGetPageMemoryUsage _getPageMemoryUsage =
+    WebFDynamicLibrary.ref.lookup<NativeFunction<NativeGetPageMemoryUsage>>('getPageMemoryUsage').asFunction();
+
+typedef NativeSetPageMemoryLimit = Void Function(Pointer<Void>, Int64, Int64);
+typedef DartSetPageMemoryLimit = void Function(Pointer<Void>, int, int);
+
+final DartSetPageMemoryLimit _setPageMemoryLimit =
+    WebFDynamicLibrary.ref.lookup<NativeFunction<NativeSetPageMemoryLimit>>('setPageMemoryLimit').asFunction();
+
+typedef NativeSetPageLazyFunctionCompilation = Void Function(Pointer<Void>, Int8);
+typedef DartSetPageLazyFunctionCompilation = void Function(Pointer<Void>, int);
+
+final DartSetPageLazyFunctionCompilation _setPageLazyFunctionCompilation = WebFDynamicLibrary.ref
+    .lookup<NativeFunction<NativeSetPageLazyFunctionCompilation>>('setPageLazyFunctionCompilation')
+    .asFunction();
+
+class PageMemoryUsage {
+  final int mallocSize;
+  final int mallocCount;
+  final int softLimit;
+  final int hardLimit;
+  final bool softLimitExceeded;
+
+  PageMemoryUsage(this.mallocSize, this.mallocCount, this.softLimit, this.hardLimit, this.softLimitExceeded);
+}
+
+// Memory allocated by the JavaScript of one page. Pages on the same JS thread share one runtime, this reports the
+// share of the page with the given contextId so the heaviest page can be reloaded or evicted.
+PageMemoryUsage getPageMemoryUsage(double contextId) {
+  assert(_allocatedPages.containsKey(contextId));
+  Pointer<NativePageMemoryUsage> nativeUsage = malloc.allocate(sizeOf<NativePageMemoryUsage>());
+  _getPageMemoryUsage(_allocatedPages[contextId]!, nativeUsage);
+  PageMemoryUsage usage = PageMemoryUsage(nativeUsage.ref.malloc_size, nativeUsage.ref.malloc_count,
+      nativeUsage.ref.soft_limit, nativeUsage.ref.hard_limit, nativeUsage.ref.soft_limit_exceeded == 1);
+  malloc.free(nativeUsage);
+  return usage;
+}
+
+// Crossing the soft limit makes the JS runtime collect garbage earlier for this page, allocations beyond the hard
+// limit throw an out of memory error in the page. Pass 0 to disable a limit.
+void setPageMemoryLimit(double contextId, int softLimit, int hardLimit) {
+  assert(_allocatedPages.containsKey(contextId));
+  _setPageMemoryLimit(_allocatedPages[contextId]!, softLimit, hardLimit);
+}
+
+// Compile the function bodies of the scripts evaluated afterwards on their first call, which speeds up the startup of
+// large bundles. Syntax errors inside a function body are then only thrown when the function is called.
+void setPageLazyFunctionCompilation(double contextId, bool enabled) {
+  assert(_allocatedPages.containsKey(contextId));
+  _setPageLazyFunctionCompilation(_allocatedPages[contextId]!, enabled ? 1 : 0);
+}
+
 void clearUICommand(double contextId) {
   assert(_allocatedPages.containsKey(contextId));
 
@@ -14,12 +14,14 @@ import 'package:webf/dom.dart';
 class UICommand {
   late final UICommandType type;
   late final String args;
+  // The args_01_length slot, which holds an integer argument when the command has no string.
+  late final int args01Length;
   late final Pointer nativePtr;
   late final Pointer nativePtr2;
 
   @override
   String toString() {
-    return 'UICommand(type: $type, args: $args, nativePtr: $nativePtr, nativePtr2: $nativePtr2)';
+    return 'UICommand(type: $type, args: $args, args01Length: $args01Length, nativePtr: $nativePtr, nativePtr2: $nativePtr2)';
   }
 }
 
@@ -63,6 +65,8 @@ bool isFlushUICommandReasonDependsLayoutStyle(int reason) {
 //   void* nativePtr2;         // offset: 3
 // };
 const int nativeCommandSize = 4;
+// Set in type when string_01 holds one byte (Latin-1) characters, see UI_COMMAND_ONE_BYTE_ARGS_FLAG.
+const int oneByteArgs01Flag = 1 << 16;
 const int typeAndArgs01LenMemOffset = 0;
 const int args01StringMemOffset = 1;
 const int nativePtrMemOffset = 2;
@@ -89,13 +93,20 @@ List<UICommand> nativeUICommandToDart(List<int> rawMemory, int commandLength, do
     int args01Length = (typeArgs01Combine >> 32).toSigned(32);
     int type = (typeArgs01Combine ^ (args01Length << 32)).toSigned(32);
 
-    command.type = UICommandType.values[type];
+    command.type = UICommandType.values[type & ~oneByteArgs01Flag];
+    command.args01Length = args01Length;
 
     int args01StringMemory = rawMemory[i + args01StringMemOffset];
     if (args01StringMemory != 0) {
-      Pointer<Uint16> args_01 = Pointer.fromAddress(args01StringMemory);
-      command.args = uint16ToString(args_01, args01Length);
-      malloc.free(args_01);
+      if (type & oneByteArgs01Flag != 0) {
+        Pointer<Uint8> args_01 = Pointer.fromAddress(args01StringMemory);
+        command.args = latin1ToString(args_01, args01Length);
+        malloc.free(args_01);
+      } else {
+        Pointer<Uint16> args_01 = Pointer.fromAddress(args01StringMemory);
+        command.args = uint16ToString(args_01, args01Length);
+        malloc.free(args_01);
+      }
     } else {
       command.args = '';
     }
@@ -157,8 +168,13 @@ void execUICommands(WebFViewController view, List<UICommand> commands) {
           printMsg = 'nativePtr: ${command.nativePtr} type: ${command.type} key: ${nativeStringToString(command.nativePtr2.cast<NativeString>())} value: ${command.args}';
           break;
         case UICommandType.createTextNode:
+        case UICommandType.setTextData:
           printMsg = 'nativePtr: ${command.nativePtr} type: ${command.type} data: ${command.args}';
           break;
+        case UICommandType.insertAdjacentNode:
+        case UICommandType.insertAdjacentNodes:
+          printMsg = 'nativePtr: ${command.nativePtr} type: ${command.type} position: ${AdjacentPosition.values[command.args01Length]} nativePtr2: ${command.nativePtr2}';
+          break;
         default:
           printMsg = 'nativePtr: ${command.nativePtr} type: ${command.type} args: ${command.args} nativePtr2: ${command.nativePtr2}';
       }
@@ -199,15 +215,25 @@ void execUICommands(WebFViewController view, List<UICommand> commands) {
           view.removeEvent(nativePtr.cast<NativeBindingObject>(), command.args, isCapture: isCapture);
           break;
         case UICommandType.insertAdjacentNode:
-          view.insertAdjacentNode(
-              nativePtr.cast<NativeBindingObject>(), command.args, command.nativePtr2.cast<NativeBindingObject>());
+          view.insertAdjacentNode(nativePtr.cast<NativeBindingObject>(), AdjacentPosition.values[command.args01Length],
+              command.nativePtr2.cast<NativeBindingObject>());
+          break;
+        case UICommandType.insertAdjacentNodes:
+          view.insertAdjacentNodes(nativePtr.cast<NativeBindingObject>(), AdjacentPosition.values[command.args01Length],
+              command.nativePtr2.cast<Pointer<NativeBindingObject>>());
           break;
         case UICommandType.removeNode:
           view.removeNode(nativePtr.cast<NativeBindingObject>());
           break;
+        case UICommandType.removeAllChildren:
+          view.removeAllChildren(nativePtr.cast<NativeBindingObject>());
+          break;
         case UICommandType.cloneNode:
           view.cloneNode(nativePtr.cast<NativeBindingObject>(), command.nativePtr2.cast<NativeBindingObject>());
           break;
+        case UICommandType.cloneNodes:
+          view.cloneNodes(nativePtr.cast<NativeBindingObject>(), command.nativePtr2.cast<Pointer<NativeBindingObject>>());
+          break;
         case UICommandType.setStyle:
           String value;
           if (command.nativePtr2 != nullptr) {
@@ -231,6 +257,15 @@ void execUICommands(WebFViewController view, List<UICommand> commands) {
           view.setAttribute(nativePtr.cast<NativeBindingObject>(), key, command.args);
           pendingRecalculateTargets.add(nativePtr.address);
           break;
+        case UICommandType.setTextData:
+          view.setTextData(nativePtr.cast<NativeBindingObject>(), command.args);
+          break;
+        case UICommandType.addClass:
+          view.addClass(nativePtr.cast<NativeBindingObject>(), command.args);
+          break;
+        case UICommandType.removeClass:
+          view.removeClass(nativePtr.cast<NativeBindingObject>(), command.args);
+          break;
         case UICommandType.removeAttribute:
           String key = command.args;
           view.removeAttribute(nativePtr, key);
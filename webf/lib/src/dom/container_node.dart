@@ -234,19 +234,47 @@ abstract class ContainerNode extends Node {
     return newChild;
   }
 
+  // Removes every child at once, the parent is marked dirty and told about the change only once.
   void removeChildren() {
     if (firstChild == null) {
       return;
     }
 
-    Node? child = firstChild;
-    while (child != null) {
+    if (this is Element) {
+      ownerDocument.styleDirtyElements.add(this as Element);
+    }
+
+    bool isChildrenConnected = isConnected;
+    bool hasElementChild = false;
+    List<Node> removedNodes = [];
+    while (firstChild != null) {
+      Node child = firstChild!;
+      if (child.isRendererAttached) {
+        child.unmountRenderObject();
+      }
+      if (child is Element) {
+        hasElementChild = true;
+        if (this is Element) {
+          child.renderStyle.detach();
+        }
+      }
       removeBetween(null, child.nextSibling, child);
       notifyNodeRemoved(child);
+      removedNodes.add(child);
+    }
+
+    if (isChildrenConnected) {
+      for (Node removedNode in removedNodes) {
+        removedNode.disconnectedCallback();
+      }
     }
 
-    ContainerNode thisNode = this;
-    thisNode.ensureNodeData().ensureChildNodeList(thisNode).invalidateCache();
+    childrenChanged(ChildrenChange(
+      type: ChildrenChangeType.ALL_CHILDREN_REMOVED,
+      byParser: ChildrenChangeSource.API,
+      affectsElements: hasElementChild ? ChildrenChangeAffectsElements.YES : ChildrenChangeAffectsElements.NO,
+      removedNodes: removedNodes,
+    ));
   }
 
   void notifyNodeRemoved(Node node) {
@@ -166,6 +166,23 @@ abstract class Element extends ContainerNode with ElementBase, ElementEventMixin
 
   String get className => _classList.join(_ONE_SPACE);
 
+  /// Adds a token changed through classList on the native side, only the styles depending on it are recalculated.
+  void addClass(String token) {
+    if (_classList.contains(token)) return;
+    _classList.add(token);
+    attributes[_CLASS_NAME] = className;
+    recalculateStyle(rebuildNested: _checkRecalculateStyle([token]));
+  }
+
+  /// Removes a token changed through classList on the native side.
+  void removeClass(String token) {
+    int length = _classList.length;
+    _classList.removeWhere((key) => key == token);
+    if (_classList.length == length) return;
+    attributes[_CLASS_NAME] = className;
+    recalculateStyle(rebuildNested: _checkRecalculateStyle([token]));
+  }
+
   PseudoElement? _beforeElement;
   PseudoElement? _afterElement;
 
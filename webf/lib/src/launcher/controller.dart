@@ -465,20 +465,58 @@ class WebFViewController implements WidgetsBindingObserver {
 
     // Current only element clone will process in dart.
     if (originalTarget is Element) {
-      Element newElement = newTarget as Element;
-      // Copy inline style.
-      originalTarget.inlineStyle.forEach((key, value) {
-        newElement.setInlineStyle(key, value);
-      });
-      // Copy element attributes.
-      originalTarget.attributes.forEach((key, value) {
-        newElement.setAttribute(key, value);
-      });
-      newElement.className = originalTarget.className;
-      newElement.id = originalTarget.id;
+      _copyElement(originalTarget, newTarget as Element);
     }
   }
 
+  // Builds the deep clone of a subtree, the list holds the pointers of the clones in tree order and ends with null.
+  void cloneNodes(Pointer<NativeBindingObject> selfPtr, Pointer<Pointer<NativeBindingObject>> list) {
+    assert(hasBindingObject(selfPtr), 'selfPtr: $selfPtr');
+    Node original = getBindingObject<Node>(selfPtr)!;
+
+    int index = 0;
+    Node cloneTree(Node node) {
+      BindingContext context = BindingContext(document.controller.view, _contextId, list[index++]);
+      Node copy;
+      if (node is Element) {
+        copy = document.createElementNS(node.namespaceURI, node.tagName, context);
+        _copyElement(node, copy as Element);
+      } else if (node is TextNode) {
+        copy = document.createTextNode(node.data, context);
+      } else if (node is Comment) {
+        copy = document.createComment(context);
+      } else {
+        copy = document.createDocumentFragment(context);
+      }
+
+      if (node is ContainerNode) {
+        for (Node? child = node.firstChild; child != null; child = child.nextSibling) {
+          // Nodes which only exist in Dart, such as pseudo elements, are not cloned.
+          if (child.pointer == null) continue;
+          copy.appendChild(cloneTree(child));
+        }
+      }
+      return copy;
+    }
+
+    cloneTree(original);
+    assert(list[index] == nullptr);
+    malloc.free(list);
+  }
+
+  void _copyElement(Element originalElement, Element newElement) {
+    // Copy inline style.
+    originalElement.inlineStyle.forEach((key, value) {
+      newElement.setInlineStyle(key, value);
+    });
+    // Copy element attributes.
+    originalElement.attributes.forEach((key, value) {
+      newElement.setAttribute(key, value);
+    });
+    newElement.className = originalElement.className;
+    newElement.id = originalElement.id;
+  }
+
   void removeNode(Pointer pointer) {
     assert(hasBindingObject(pointer), 'pointer: $pointer');
 
@@ -488,6 +526,15 @@ class WebFViewController implements WidgetsBindingObserver {
     _debugDOMTreeChanged();
   }
 
+  void removeAllChildren(Pointer<NativeBindingObject> pointer) {
+    assert(hasBindingObject(pointer), 'pointer: $pointer');
+
+    ContainerNode target = getBindingObject<ContainerNode>(pointer)!;
+    target.removeChildren();
+
+    _debugDOMTreeChanged();
+  }
+
   /// <!-- beforebegin -->
   /// <p>
   ///   <!-- afterbegin -->
@@ -495,37 +542,69 @@ class WebFViewController implements WidgetsBindingObserver {
   ///   <!-- beforeend -->
   /// </p>
   /// <!-- afterend -->
-  void insertAdjacentNode(Pointer<NativeBindingObject> selfPointer, String position, Pointer<NativeBindingObject> newPointer) {
+  void insertAdjacentNode(Pointer<NativeBindingObject> selfPointer, AdjacentPosition position, Pointer<NativeBindingObject> newPointer) {
     assert(hasBindingObject(selfPointer), 'targetId: $selfPointer position: $position newTargetId: $newPointer');
-    assert(hasBindingObject(selfPointer), 'newTargetId: $newPointer position: $position');
+    assert(hasBindingObject(newPointer), 'newTargetId: $newPointer position: $position');
 
     Node target = getBindingObject<Node>(selfPointer)!;
     Node newNode = getBindingObject<Node>(newPointer)!;
+    _insertAdjacentNodes(target, position, [newNode]);
+
+    _debugDOMTreeChanged();
+  }
+
+  // Inserts a null terminated list of nodes in one go, the list is allocated by the bridge and freed here.
+  void insertAdjacentNodes(Pointer<NativeBindingObject> selfPointer, AdjacentPosition position, Pointer<Pointer<NativeBindingObject>> list) {
+    assert(hasBindingObject(selfPointer), 'targetId: $selfPointer position: $position');
+
+    List<Node> newNodes = [];
+    for (int i = 0; list[i] != nullptr; i++) {
+      assert(hasBindingObject(list[i]), 'newTargetId: ${list[i]} position: $position');
+      newNodes.add(getBindingObject<Node>(list[i])!);
+    }
+    malloc.free(list);
+
+    Node target = getBindingObject<Node>(selfPointer)!;
+    _insertAdjacentNodes(target, position, newNodes);
+
+    _debugDOMTreeChanged();
+  }
+
+  void _insertAdjacentNodes(Node target, AdjacentPosition position, List<Node> newNodes) {
     Node? targetParentNode = target.parentNode;
 
     switch (position) {
-      case 'beforebegin':
-        targetParentNode!.insertBefore(newNode, target);
+      case AdjacentPosition.beforeBegin:
+        for (Node newNode in newNodes) {
+          targetParentNode!.insertBefore(newNode, target);
+        }
         break;
-      case 'afterbegin':
-        target.insertBefore(newNode, target.firstChild!);
+      case AdjacentPosition.afterBegin:
+        Node? firstChild = target.firstChild;
+        for (Node newNode in newNodes) {
+          if (firstChild == null) {
+            target.appendChild(newNode);
+          } else {
+            target.insertBefore(newNode, firstChild);
+          }
+        }
         break;
-      case 'beforeend':
-        target.appendChild(newNode);
+      case AdjacentPosition.beforeEnd:
+        for (Node newNode in newNodes) {
+          target.appendChild(newNode);
+        }
         break;
-      case 'afterend':
-        if (targetParentNode!.lastChild == target) {
-          targetParentNode.appendChild(newNode);
-        } else {
-          targetParentNode.insertBefore(
-            newNode,
-            target.nextSibling!
-          );
+      case AdjacentPosition.afterEnd:
+        Node? nextSibling = target.nextSibling;
+        for (Node newNode in newNodes) {
+          if (nextSibling == null) {
+            targetParentNode!.appendChild(newNode);
+          } else {
+            targetParentNode!.insertBefore(newNode, nextSibling);
+          }
         }
         break;
     }
-
-    _debugDOMTreeChanged();
   }
 
   void setAttribute(Pointer<NativeBindingObject> selfPtr, String key, String value) {
@@ -542,6 +621,28 @@ class WebFViewController implements WidgetsBindingObserver {
     }
   }
 
+  void setTextData(Pointer<NativeBindingObject> selfPtr, String data) {
+    assert(hasBindingObject(selfPtr), 'selfPtr: $selfPtr data: $data');
+    Node target = getBindingObject<Node>(selfPtr)!;
+
+    // Comments share the command with text nodes, but have no data on the Dart side.
+    if (target is TextNode) {
+      target.data = data;
+    }
+  }
+
+  void addClass(Pointer<NativeBindingObject> selfPtr, String token) {
+    assert(hasBindingObject(selfPtr), 'selfPtr: $selfPtr token: $token');
+    Element target = getBindingObject<Element>(selfPtr)!;
+    target.addClass(token);
+  }
+
+  void removeClass(Pointer<NativeBindingObject> selfPtr, String token) {
+    assert(hasBindingObject(selfPtr), 'selfPtr: $selfPtr token: $token');
+    Element target = getBindingObject<Element>(selfPtr)!;
+    target.removeClass(token);
+  }
+
   String? getAttribute(Pointer selfPtr, String key) {
     assert(hasBindingObject(selfPtr), 'targetId: $selfPtr key: $key');
     Node target = getBindingObject<Node>(selfPtr)!;